@@ -3,6 +3,8 @@
 
 #include "HOOMDMath.h"
 #include "VectorMath.h"
+#include <algorithm>
+#include <limits>
 #include <stack>
 #include <vector>
 
@@ -30,6 +32,7 @@ namespace detail
     {
 const unsigned int NODE_CAPACITY = 16;        //!< Maximum number of particles in a node
 const unsigned int INVALID_NODE = 0xffffffff; //!< Invalid node index sentinel
+const unsigned int SAH_BINS = 16;             //!< Number of bins in the SAH tree builder
 
 #ifndef __HIPCC__
 
@@ -73,6 +76,9 @@ struct PYBIND11_EXPORT AABBNode
    periodically instead of continually updated.
     - buildTree : build an efficiently arranged tree given a complete set of AABBs, one for each
    particle.
+    - Refit : Recompute the AABBs of all nodes bottom up from a new set of particle AABBs, keeping
+   the tree topology. Runs in O(N) time. The quality of the tree degrades as particles move away
+   from the positions it was built for, which getCost() measures.
 
     **Implementation details**
 
@@ -161,9 +167,35 @@ class PYBIND11_EXPORT AABBTree
     //! Update the AABB of a particle
     inline void update(unsigned int idx, const AABB& aabb);
 
+    //! Refit the tree to new particle AABBs
+    inline void refit(const AABB* aabbs, unsigned int N);
+
+    //! Estimate the cost of a query
+    inline Scalar getCost() const;
+
     //! Get the height of a given particle's leaf node
     inline unsigned int height(unsigned int idx);
 
+    //! Split a list of AABBs in two with the binned surface area heuristic
+    static inline unsigned int partitionSAH(AABB* aabbs,
+                                            unsigned int* idx,
+                                            unsigned int len,
+                                            std::vector<AABB>& aabb_right,
+                                            std::vector<unsigned int>& idx_right);
+
+    //! Compute the surface area of an AABB
+    static inline Scalar surfaceArea(const AABB& aabb)
+        {
+        vec3<Scalar> d = aabb.getUpper() - aabb.getLower();
+        return Scalar(2.0) * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+
+    //! Get the number of particles in the tree
+    inline unsigned int getNumParticles() const
+        {
+        return (unsigned int)m_mapping.size();
+        }
+
     //! Get the number of nodes
     inline unsigned int getNumNodes() const
         {
@@ -264,6 +296,12 @@ class PYBIND11_EXPORT AABBTree
     //! Allocate a new node
     inline unsigned int allocateNode();
 
+    //! Get one component of a vector
+    static inline Scalar getComponent(const vec3<Scalar>& v, unsigned int axis)
+        {
+        return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+        }
+
     //! Update the skip value for a node
     inline unsigned int updateSkip(unsigned int idx);
     };
@@ -357,6 +395,65 @@ inline void AABBTree::update(unsigned int idx, const AABB& aabb)
         }
     }
 
+/*! \param aabbs List of AABBs for each particle, in the original particle order
+    \param N Number of AABBs in the list (must match the number the tree was built with)
+
+    Set the AABB of every leaf node to enclose its particles' AABBs, then the AABB of every internal
+   node to enclose its children. The tree topology is unchanged. Nodes are allocated in depth first
+   order, so every child has a larger index than its parent and one reverse pass over the node array
+   visits the children before the parents. Unlike buildTree(), refit() does not modify \a aabbs.
+*/
+inline void AABBTree::refit(const AABB* aabbs, unsigned int N)
+    {
+    assert(N == m_mapping.size());
+
+    for (unsigned int node_idx = m_num_nodes; node_idx-- > 0;)
+        {
+        AABBNode& node = m_nodes[node_idx];
+        if (node.left == INVALID_NODE)
+            {
+            if (node.num_particles == 0)
+                continue;
+
+            node.aabb = aabbs[node.particles[0]];
+            for (unsigned int i = 1; i < node.num_particles; i++)
+                node.aabb = merge(node.aabb, aabbs[node.particles[i]]);
+            }
+        else
+            {
+            node.aabb = merge(m_nodes[node.left].aabb, m_nodes[node.right].aabb);
+            }
+        }
+    }
+
+/*! \returns The expected number of box overlap checks and particle checks made by a query, relative
+   to the root
+
+    Following the surface area heuristic, the probability that a query visits a node is
+   approximately the ratio of the node's surface area to the root's. getCost() sums this ratio over
+   all internal nodes, weighting leaf nodes by the number of particles they hold. Compare the cost
+   of a refit tree to the cost after the last build to decide when to rebuild.
+*/
+inline Scalar AABBTree::getCost() const
+    {
+    if (m_num_nodes == 0)
+        return Scalar(0.0);
+
+    Scalar root_area = surfaceArea(m_nodes[m_root].aabb);
+    if (root_area <= Scalar(0.0))
+        return Scalar(0.0);
+
+    Scalar cost(0.0);
+    for (unsigned int node_idx = 0; node_idx < m_num_nodes; node_idx++)
+        {
+        const AABBNode& node = m_nodes[node_idx];
+        Scalar weight = node.left == INVALID_NODE ? Scalar(node.num_particles) : Scalar(1.0);
+        cost += weight * surfaceArea(node.aabb);
+        }
+
+    return cost / root_area;
+    }
+
 /*! \param idx Particle to get height for
     \returns Height of the node
 */
@@ -403,6 +500,167 @@ inline void AABBTree::buildTree(AABB* aabbs, unsigned int N)
     updateSkip(m_root);
     }
 
+/*! \param aabbs List of AABBs
+    \param idx List of indices, permuted along with \a aabbs
+    \param len Number of AABBs in the list
+    \param aabb_right Temporary list of AABBs
+    \param idx_right Temporary list of indices
+    \returns The number of AABBs in the left list, between 1 and len - 1
+
+    The AABB centers are sorted into SAH_BINS bins along the axis of largest spread and the list is
+   split at the bin boundary that minimizes the surface area heuristic: the sum over both lists of
+   the surface area of the merged AABBs times the number of AABBs in the list. partitionSAH()
+   partitions \a aabbs and \a idx in place so that the left list comes first.
+*/
+inline unsigned int AABBTree::partitionSAH(AABB* aabbs,
+                                           unsigned int* idx,
+                                           unsigned int len,
+                                           std::vector<AABB>& aabb_right,
+                                           std::vector<unsigned int>& idx_right)
+    {
+    unsigned int left_insert_point = 0;
+    idx_right.clear();
+    aabb_right.clear();
+
+    // if there are only 2 aabbs, put one on each side
+    if (len == 2)
+        {
+        // nothing to do, already partitioned
+        }
+    else
+        {
+        // Otherwise, we need to split them based on a heuristic. Bin the AABB centers along the
+        // axis where they are spread the most and choose the bin boundary that minimizes the
+        // surface area heuristic (SAH) cost. Use a stable partition to keep particles in index
+        // order.
+        vec3<Scalar> center_lower = aabbs[0].getPosition();
+        vec3<Scalar> center_upper = center_lower;
+        for (unsigned int i = 1; i < len; i++)
+            {
+            vec3<Scalar> center = aabbs[i].getPosition();
+            center_lower.x = std::min(center_lower.x, center.x);
+            center_lower.y = std::min(center_lower.y, center.y);
+            center_lower.z = std::min(center_lower.z, center.z);
+            center_upper.x = std::max(center_upper.x, center.x);
+            center_upper.y = std::max(center_upper.y, center.y);
+            center_upper.z = std::max(center_upper.z, center.z);
+            }
+        vec3<Scalar> center_extent = center_upper - center_lower;
+
+        unsigned int axis = 2;
+        if (center_extent.x > center_extent.y && center_extent.x > center_extent.z)
+            axis = 0;
+        else if (center_extent.y > center_extent.z)
+            axis = 1;
+
+        Scalar axis_lower = getComponent(center_lower, axis);
+        Scalar axis_extent = getComponent(center_extent, axis);
+
+        if (axis_extent <= Scalar(0.0))
+            {
+            // all centers coincide, split the list in half
+            left_insert_point = len / 2;
+            }
+        else
+            {
+            Scalar bin_scale = Scalar(SAH_BINS) / axis_extent;
+            auto bin_of = [&](const AABB& box)
+            {
+                unsigned int bin = (unsigned int)((getComponent(box.getPosition(), axis)
+                                                   - axis_lower)
+                                                  * bin_scale);
+                return std::min(bin, SAH_BINS - 1);
+            };
+
+            AABB bin_aabb[SAH_BINS];
+            unsigned int bin_count[SAH_BINS] = {};
+            for (unsigned int i = 0; i < len; i++)
+                {
+                unsigned int bin = bin_of(aabbs[i]);
+                bin_aabb[bin] = bin_count[bin] ? merge(bin_aabb[bin], aabbs[i])
+                                               : aabbs[i];
+                bin_count[bin]++;
+                }
+
+            // sweep from the right to get the area and count on the right of each boundary
+            Scalar right_area[SAH_BINS];
+            unsigned int right_count[SAH_BINS];
+            AABB sweep_aabb;
+            unsigned int sweep_count = 0;
+            for (unsigned int b = SAH_BINS - 1; b > 0; b--)
+                {
+                if (bin_count[b])
+                    {
+                    sweep_aabb = sweep_count ? merge(sweep_aabb, bin_aabb[b]) : bin_aabb[b];
+                    sweep_count += bin_count[b];
+                    }
+                right_area[b] = sweep_count ? surfaceArea(sweep_aabb) : Scalar(0.0);
+                right_count[b] = sweep_count;
+                }
+
+            // sweep from the left and evaluate the cost of splitting after bin b
+            unsigned int split_bin = 0;
+            Scalar split_cost = std::numeric_limits<Scalar>::max();
+            sweep_count = 0;
+            for (unsigned int b = 0; b < SAH_BINS - 1; b++)
+                {
+                if (bin_count[b])
+                    {
+                    sweep_aabb = sweep_count ? merge(sweep_aabb, bin_aabb[b]) : bin_aabb[b];
+                    sweep_count += bin_count[b];
+                    }
+                if (sweep_count == 0 || right_count[b + 1] == 0)
+                    continue;
+
+                Scalar cost = surfaceArea(sweep_aabb) * Scalar(sweep_count)
+                              + right_area[b + 1] * Scalar(right_count[b + 1]);
+                if (cost < split_cost)
+                    {
+                    split_cost = cost;
+                    split_bin = b;
+                    }
+                }
+
+            for (unsigned int i = 0; i < len; i++)
+                {
+                if (bin_of(aabbs[i]) <= split_bin)
+                    {
+                    if (left_insert_point != i)
+                        {
+                        // Set the AABB and index at the insert point.
+                        aabbs[left_insert_point] = aabbs[i];
+                        idx[left_insert_point] = idx[i];
+                        }
+                    left_insert_point++;
+                    }
+                else
+                    {
+                    // Add the right side AABBs to a temporary list.
+                    aabb_right.push_back(aabbs[i]);
+                    idx_right.push_back(idx[i]);
+                    }
+                }
+
+            assert(aabb_right.size() == idx_right.size());
+            assert(left_insert_point + aabb_right.size() == len);
+
+            // Copy the right AABBs back into the list.
+            std::copy(aabb_right.begin(), aabb_right.end(), aabbs + left_insert_point);
+            std::copy(idx_right.begin(), idx_right.end(), idx + left_insert_point);
+            }
+        }
+
+    // sanity check. The left or right tree may have ended up empty. If so, just borrow one particle
+    // from it
+    unsigned int start_right = left_insert_point;
+    if (start_right == len)
+        start_right = len - 1;
+    if (start_right == 0)
+        start_right = 1;
+
+    return start_right;
+    }
+
 /*! \param aabbs List of AABBs
     \param idx List of indices
     \param start Start point in aabbs and idx to examine
@@ -411,8 +669,10 @@ inline void AABBTree::buildTree(AABB* aabbs, unsigned int N)
 
     buildNode is the main driver of the smart AABB tree build algorithm. Each call produces a node,
    given a set of AABBs. If there are fewer AABBs than fit in a leaf, a leaf is generated. If there
-   are too many, the total AABB is computed and split on the largest length axis. The total tree is
-   built by recursive splitting.
+   are too many, the AABB centers are sorted into SAH_BINS bins along the axis of largest spread and
+   the list is split at the bin boundary that minimizes the surface area heuristic: the sum over
+   both children of the child surface area times the number of AABBs in the child. The total tree
+   is built by recursive splitting.
 
     The aabbs and idx lists are passed in by reference. Each node is given a subrange of the list to
    own (start to start + len). When building the node, it partitions its subrange into two sides
@@ -430,7 +690,6 @@ inline unsigned int AABBTree::buildNode(AABB* aabbs,
         {
         my_aabb = merge(my_aabb, aabbs[start + i]);
         }
-    vec3<Scalar> my_radius = my_aabb.getUpper() - my_aabb.getLower();
 
     // handle the case of a leaf node creation
     if (len <= NODE_CAPACITY)
@@ -456,73 +715,9 @@ inline unsigned int AABBTree::buildNode(AABB* aabbs,
     // otherwise, we are creating an internal node - allocate an index
     unsigned int my_idx = allocateNode();
 
-    // need to split the list of aabbs into two sets for left and right
-    unsigned int left_insert_point = 0;
-    m_idx_right.clear();
-    m_aabb_right.clear();
-
-    // if there are only 2 aabbs, put one on each side
-    if (len == 2)
-        {
-        // nothing to do, already partitioned
-        }
-    else
-        {
-        // Otherwise, we need to split them based on a heuristic. Split the longest dimension in
-        // half. Use a stable partition to keep particles in index order.
-
-        for (unsigned int i = 0; i < len; i++)
-            {
-            bool on_left = false;
-            if (my_radius.x > my_radius.y && my_radius.x > my_radius.z)
-                {
-                // split on x direction
-                on_left = aabbs[start + i].getPosition().x < my_aabb.getPosition().x;
-                }
-            else if (my_radius.y > my_radius.z)
-                {
-                // split on y direction
-                on_left = aabbs[start + i].getPosition().y < my_aabb.getPosition().y;
-                }
-            else
-                {
-                // split on z direction
-                on_left = aabbs[start + i].getPosition().z < my_aabb.getPosition().z;
-                }
-
-            if (on_left)
-                {
-                if (left_insert_point != i)
-                    {
-                    // Set the AABB and index at the insert point.
-                    aabbs[start + left_insert_point] = aabbs[start + i];
-                    idx[start + left_insert_point] = idx[start + i];
-                    }
-                left_insert_point++;
-                }
-            else
-                {
-                // Add the right side AABBs to a temporary list.
-                m_aabb_right.push_back(aabbs[start + i]);
-                m_idx_right.push_back(idx[start + i]);
-                }
-            }
-
-        assert(m_aabb_right.size() == m_idx_right.size());
-        assert(left_insert_point + m_aabb_right.size() == len);
-
-        // Copy the right AABBs back into the list.
-        std::copy(m_aabb_right.begin(), m_aabb_right.end(), aabbs + start + left_insert_point);
-        std::copy(m_idx_right.begin(), m_idx_right.end(), idx.begin() + start + left_insert_point);
-        }
-
-    // sanity check. The left or right tree may have ended up empty. If so, just borrow one particle
-    // from it
-    unsigned int start_right = left_insert_point;
-    if (start_right == len)
-        start_right = len - 1;
-    if (start_right == 0)
-        start_right = 1;
+    // split the list of aabbs into two sets for left and right
+    unsigned int start_right
+        = partitionSAH(aabbs + start, idx.data() + start, len, m_aabb_right, m_idx_right);
 
     // note: calling buildNode has side effects, the m_nodes array may be reallocated. So we need to
     // determine the left and right children, then build our node (can't say m_nodes[my_idx].left =
@@ -3,6 +3,8 @@
 
 #include "Action.h"
 
+#include <pybind11/stl.h>
+
 namespace hoomd
     {
 
@@ -11,7 +13,10 @@ namespace detail
 void export_Action(pybind11::module& m)
     {
     pybind11::class_<Action, Autotuned, std::shared_ptr<Action>>(m, "Action")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
+        .def("setProfileName", &Action::setProfileName)
+        .def("getProfileName", &Action::getProfileName)
+        .def("getLoggableNames", &Action::getLoggableNames);
     }
     } // end namespace detail
 
@@ -7,8 +7,13 @@
 #error This header cannot be compiled by nvcc
 #endif
 
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <pybind11/pybind11.h>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "Autotuned.h"
@@ -18,6 +23,23 @@
 namespace hoomd
     {
 
+/// A quantity that LogBuffer samples without calling into Python
+/*! Loggable quantities are fixed width arrays of floating point or integer values. Exactly one of
+    get_float and get_int is set. The getters receive the current timestep so that they can
+    compute the quantity when needed.
+*/
+struct LoggableQuantity
+    {
+    /// Number of values in the quantity
+    unsigned int width = 1;
+
+    /// Write the floating point values of the quantity to out
+    std::function<void(uint64_t timestep, double* out)> get_float;
+
+    /// Write the integer values of the quantity to out
+    std::function<void(uint64_t timestep, int64_t* out)> get_int;
+    };
+
 /// Base class for actions that act on the simulation state
 /*! Compute, Updater, Analyzer, and Tuner inherit common methods from Action.
 
@@ -34,6 +56,36 @@ class Action : public Autotuned
         {
         }
 
+    /// Set the name that identifies this action in the profiler.
+    void setProfileName(const std::string& name)
+        {
+        m_profile_name = name;
+        }
+
+    /// Get the name that identifies this action in the profiler.
+    const std::string& getProfileName() const
+        {
+        return m_profile_name;
+        }
+
+    /// Get the names of the quantities that LogBuffer can sample.
+    std::vector<std::string> getLoggableNames() const
+        {
+        std::vector<std::string> names;
+        for (const auto& loggable : m_loggables)
+            names.push_back(loggable.first);
+        return names;
+        }
+
+    /// Get a quantity that LogBuffer can sample.
+    const LoggableQuantity& getLoggable(const std::string& name) const
+        {
+        auto it = m_loggables.find(name);
+        if (it == m_loggables.end())
+            throw std::runtime_error("No native loggable quantity named " + name + ".");
+        return it->second;
+        }
+
     protected:
     /// The system definition this action is associated with.
     const std::shared_ptr<SystemDefinition> m_sysdef;
@@ -47,6 +99,27 @@ class Action : public Autotuned
     /// Stored shared ptr to the system signals
     std::vector<std::shared_ptr<hoomd::detail::SignalSlot>> m_slots;
 
+    /// Name that identifies this action in the profiler.
+    std::string m_profile_name = "Action";
+
+    /// Quantities that LogBuffer can sample, by the name of the matching Python loggable.
+    std::map<std::string, LoggableQuantity> m_loggables;
+
+    /// Register a quantity that LogBuffer can sample.
+    void registerLoggable(const std::string& name, const LoggableQuantity& quantity)
+        {
+        m_loggables[name] = quantity;
+        }
+
+    /// Register a scalar floating point quantity that LogBuffer can sample.
+    void registerLoggable(const std::string& name, std::function<double(uint64_t)> getter)
+        {
+        LoggableQuantity quantity;
+        quantity.get_float = [getter](uint64_t timestep, double* out)
+        { out[0] = getter(timestep); };
+        registerLoggable(name, quantity);
+        }
+
     void addSlot(std::shared_ptr<hoomd::detail::SignalSlot> slot)
         {
         m_slots.push_back(slot);
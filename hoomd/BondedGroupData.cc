@@ -6,6 +6,7 @@
  */
 
 #include "BondedGroupData.h"
+#include "Checkpoint.h"
 #include "Index1D.h"
 #include "ParticleData.h"
 
@@ -318,6 +319,300 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initializeFromS
         }
     }
 
+#ifdef ENABLE_MPI
+/*! \param snapshot The slice of the groups read by this rank
+    \param particle_owners The rank that owns each particle in the slice of the particle data
+           read by this rank, as returned by ParticleData::initializeFromDistributedSnapshot()
+
+    Group tags follow the order of the slices, as do particle tags. Only the rank that read a
+    particle knows its owner, so the groups are routed in two all-to-all exchanges: first to the
+    ranks that read their members, then from there to the ranks that own their members.
+
+    \pre The particle data is initialized with ParticleData::initializeFromDistributedSnapshot()
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::initializeFromDistributedSnapshot(
+    const Snapshot& snapshot,
+    const std::vector<unsigned int>& particle_owners)
+    {
+    snapshot.validate();
+    initialize();
+
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+    const unsigned int my_rank = m_exec_conf->getRank();
+
+    // all ranks read the same types, use the ones from the root for consistency
+    m_type_mapping = snapshot.type_mapping;
+    bcast(m_type_mapping, 0, mpi_comm);
+
+    unsigned int slice_size = (unsigned int)snapshot.groups.size();
+    unsigned int first_tag = 0;
+    unsigned int nglobal = 0;
+    MPI_Exscan(&slice_size, &first_tag, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+    if (my_rank == 0)
+        first_tag = 0;
+    MPI_Allreduce(&slice_size, &nglobal, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+
+    // first particle tag in the slice of each rank
+    std::vector<unsigned int> particle_slice_sizes(n_ranks);
+    unsigned int particle_slice_size = (unsigned int)particle_owners.size();
+    MPI_Allgather(&particle_slice_size,
+                  1,
+                  MPI_UNSIGNED,
+                  particle_slice_sizes.data(),
+                  1,
+                  MPI_UNSIGNED,
+                  mpi_comm);
+    std::vector<unsigned int> particle_slice_first(n_ranks + 1, 0);
+    std::partial_sum(particle_slice_sizes.begin(),
+                     particle_slice_sizes.end(),
+                     particle_slice_first.begin() + 1);
+    const unsigned int n_particles = particle_slice_first[n_ranks];
+
+    auto reader_rank = [&](unsigned int tag)
+    {
+        return (unsigned int)(std::upper_bound(particle_slice_first.begin(),
+                                               particle_slice_first.end(),
+                                               tag)
+                              - particle_slice_first.begin() - 1);
+    };
+
+    struct group_element
+        {
+        members_t members;
+        typeval_t typeval;
+        unsigned int tag;
+        };
+
+    // send each group once to each of the distinct ranks in a list
+    std::vector<std::vector<group_element>> send(n_ranks);
+    auto send_to_ranks = [&](const group_element& g, unsigned int* ranks)
+    {
+        std::sort(ranks, ranks + group_size);
+        unsigned int* end = std::unique(ranks, ranks + group_size);
+        for (unsigned int* r = ranks; r != end; r++)
+            send[*r].push_back(g);
+    };
+
+    std::ostringstream error_message;
+    int error = 0;
+    for (unsigned int group_idx = 0; group_idx < slice_size; group_idx++)
+        {
+        group_element g;
+        g.members = snapshot.groups[group_idx];
+        if (has_type_mapping)
+            g.typeval.type = snapshot.type_id[group_idx];
+        else
+            g.typeval.val = snapshot.val[group_idx];
+        g.tag = first_tag + group_idx;
+
+        bool valid = !has_type_mapping || g.typeval.type < m_type_mapping.size();
+        for (unsigned int i = 0; i < group_size; ++i)
+            {
+            valid = valid && g.members.tag[i] < n_particles;
+            for (unsigned int j = 0; j < i; ++j)
+                valid = valid && g.members.tag[i] != g.members.tag[j];
+            }
+
+        if (!valid)
+            {
+            if (!error)
+                {
+                error_message << "Invalid " << name << " " << g.tag << ": ";
+                for (unsigned int j = 0; j < group_size; ++j)
+                    error_message << g.members.tag[j] << ((j != group_size - 1) ? "," : "");
+                if (has_type_mapping)
+                    error_message << " with typeid " << g.typeval.type;
+                error_message << ".";
+                }
+            error = 1;
+            continue;
+            }
+
+        unsigned int ranks[group_size];
+        for (unsigned int i = 0; i < group_size; ++i)
+            ranks[i] = reader_rank(g.members.tag[i]);
+        send_to_ranks(g, ranks);
+        }
+
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_INT, MPI_MAX, mpi_comm);
+    if (error)
+        {
+        std::string message = error_message.str();
+        throw std::runtime_error(message.empty() ? std::string("Invalid ") + name
+                                                       + " on another rank."
+                                                 : message);
+        }
+
+    // route the groups to the owners of the members read by this rank
+    std::vector<group_element> recv;
+    all_to_all_v(send, recv, mpi_comm);
+    for (auto& s : send)
+        s.clear();
+
+    const unsigned int my_first = particle_slice_first[my_rank];
+    const unsigned int my_last = particle_slice_first[my_rank + 1];
+    for (const group_element& g : recv)
+        {
+        unsigned int ranks[group_size];
+        unsigned int n = 0;
+        for (unsigned int i = 0; i < group_size; ++i)
+            {
+            unsigned int tag = g.members.tag[i];
+            if (tag >= my_first && tag < my_last)
+                ranks[n++] = particle_owners[tag - my_first];
+            }
+        // pad with a duplicate so that all group_size entries are set
+        for (unsigned int i = n; i < group_size; ++i)
+            ranks[i] = ranks[0];
+        send_to_ranks(g, ranks);
+        }
+
+    all_to_all_v(send, recv, mpi_comm);
+    send.clear();
+
+    // several ranks may forward the same group
+    std::sort(recv.begin(),
+              recv.end(),
+              [](const group_element& a, const group_element& b) { return a.tag < b.tag; });
+    recv.erase(std::unique(recv.begin(),
+                           recv.end(),
+                           [](const group_element& a, const group_element& b)
+                           { return a.tag == b.tag; }),
+               recv.end());
+
+    m_group_rtag.resize(nglobal, GROUP_NOT_LOCAL);
+    for (const group_element& g : recv)
+        {
+        m_group_rtag[g.tag] = (unsigned int)m_groups.size();
+        m_groups.push_back(g.members);
+        m_group_typeval.push_back(g.typeval);
+        m_group_tag.push_back(g.tag);
+
+        ranks_t r;
+        for (unsigned int i = 0; i < group_size; ++i)
+            r.idx[i] = 0;
+        m_group_ranks.push_back(r);
+        }
+
+    for (unsigned int tag = 0; tag < nglobal; tag++)
+        m_tag_set.insert(m_tag_set.end(), tag);
+    m_invalid_cached_tags = true;
+
+    m_n_groups = (unsigned int)recv.size();
+    m_nglobal = nglobal;
+
+    // notify observers
+    m_group_num_change_signal.emit();
+    notifyGroupReorder();
+    }
+#endif
+
+/*! \param out Stream to write to
+
+    Writes the groups owned by this rank, followed by the global tag bookkeeping needed to restore
+    the groups without communication.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::writeCheckpoint(std::ostream& out)
+    {
+    detail::writeCheckpointValue(out, m_nglobal);
+    detail::writeCheckpointValue(out, (unsigned int)m_group_rtag.size());
+    detail::writeCheckpointNames(out, m_type_mapping);
+
+    std::vector<unsigned int> recycled_tags;
+    std::stack<unsigned int> tmp = m_recycled_tags;
+    while (!tmp.empty())
+        {
+        recycled_tags.push_back(tmp.top());
+        tmp.pop();
+        }
+    std::reverse(recycled_tags.begin(), recycled_tags.end());
+    detail::writeCheckpointArray(out, recycled_tags.data(), recycled_tags.size());
+
+    // ghost groups follow the local groups and are not written
+    ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_group_typeval, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_group_tag, access_location::host, access_mode::read);
+    detail::writeCheckpointArray(out, h_groups.data, m_n_groups);
+    detail::writeCheckpointArray(out, h_typeval.data, m_n_groups);
+    detail::writeCheckpointArray(out, h_tag.data, m_n_groups);
+    }
+
+/*! \param in Stream to read from
+
+    Replaces the local groups with the ones written by writeCheckpoint().
+
+    \pre The particle data is read from the same checkpoint.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::readCheckpoint(std::istream& in)
+    {
+    initialize();
+
+    unsigned int nglobal, rtag_size;
+    detail::readCheckpointValue(in, nglobal);
+    detail::readCheckpointValue(in, rtag_size);
+    detail::readCheckpointNames(in, m_type_mapping);
+
+    std::vector<unsigned int> recycled_tags;
+    std::vector<members_t> groups;
+    std::vector<typeval_t> typeval;
+    std::vector<unsigned int> tags;
+    detail::readCheckpointArray(in, recycled_tags);
+    detail::readCheckpointArray(in, groups);
+    detail::readCheckpointArray(in, typeval);
+    detail::readCheckpointArray(in, tags);
+    if (typeval.size() != groups.size() || tags.size() != groups.size())
+        {
+        throw std::runtime_error(std::string("Inconsistent ") + name
+                                 + " array sizes in checkpoint file.");
+        }
+
+    std::vector<bool> recycled(rtag_size, false);
+    for (unsigned int t : recycled_tags)
+        {
+        if (t >= rtag_size)
+            throw std::runtime_error(std::string("Invalid ") + name + " tag in checkpoint file.");
+        recycled[t] = true;
+        m_recycled_tags.push(t);
+        }
+    for (unsigned int t = 0; t < rtag_size; t++)
+        {
+        if (!recycled[t])
+            m_tag_set.insert(m_tag_set.end(), t);
+        }
+
+    m_group_rtag.resize(rtag_size, GROUP_NOT_LOCAL);
+    for (unsigned int group_idx = 0; group_idx < groups.size(); group_idx++)
+        {
+        if (tags[group_idx] >= rtag_size)
+            throw std::runtime_error(std::string("Invalid ") + name + " tag in checkpoint file.");
+        m_group_rtag[tags[group_idx]] = group_idx;
+        m_groups.push_back(groups[group_idx]);
+        m_group_typeval.push_back(typeval[group_idx]);
+        m_group_tag.push_back(tags[group_idx]);
+#ifdef ENABLE_MPI
+        if (m_pdata->getDomainDecomposition())
+            {
+            // the communicator fills in the member ranks
+            ranks_t r;
+            for (unsigned int i = 0; i < group_size; ++i)
+                r.idx[i] = 0;
+            m_group_ranks.push_back(r);
+            }
+#endif
+        }
+
+    m_n_groups = (unsigned int)groups.size();
+    m_nglobal = nglobal;
+
+    // notify observers
+    m_group_num_change_signal.emit();
+    notifyGroupReorder();
+    }
+
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 unsigned int BondedGroupData<group_size, Group, name, has_type_mapping>::addBondedGroup(Group g)
     {
@@ -1006,49 +1301,54 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::takeSnapshot(Snapsho
         // gather local data
         std::vector<typeval_t> typevals; // Group types or constraint values
         std::vector<members_t> members;  // Group members
+        std::vector<unsigned int> tags;  // Group tags
 
         for (unsigned int group_idx = 0; group_idx < getN(); ++group_idx)
             {
             typevals.push_back(m_group_typeval[group_idx]);
             members.push_back(m_groups[group_idx]);
+            tags.push_back(m_group_tag[group_idx]);
             }
 
         std::vector<std::vector<typeval_t>> typevals_proc; // Group types of every processor
         std::vector<std::vector<members_t>> members_proc;  // Group members of every processor
-
-        std::vector<std::map<unsigned int, unsigned int>>
-            rtag_map_proc; // List of reverse-lookup maps
+        std::vector<std::vector<unsigned int>> tags_proc;  // Group tags of every processor
 
         unsigned int size = m_exec_conf->getNRanks();
 
         // resize arrays to accumulate group data of all ranks
         typevals_proc.resize(size);
         members_proc.resize(size);
-        rtag_map_proc.resize(size);
+        tags_proc.resize(size);
 
         // gather all processors' data
         gather_v(typevals, typevals_proc, 0, m_exec_conf->getMPICommunicator());
         gather_v(members, members_proc, 0, m_exec_conf->getMPICommunicator());
-        gather_v(rtag_map, rtag_map_proc, 0, m_exec_conf->getMPICommunicator());
+        gather_v(tags, tags_proc, 0, m_exec_conf->getMPICommunicator());
 
         if (m_exec_conf->getRank() == 0)
             {
             // allocate memory in snapshot
             snapshot.resize(getNGlobal());
 
-            assert(rtag_map_proc.size() == size);
+            assert(tags_proc.size() == size);
 
-            // create single map of all group ranks and indices
+            // look up the rank and index of every group by tag
             // groups present on more than one processor will count as one group
-            std::map<unsigned int, std::pair<unsigned int, unsigned int>> rank_rtag_map;
-            std::map<unsigned int, unsigned int>::iterator it;
+            const unsigned int n_tags = (unsigned int)m_group_rtag.size();
+            std::vector<unsigned int> tag_rank(n_tags, GROUP_NOT_LOCAL);
+            std::vector<unsigned int> tag_idx(n_tags, GROUP_NOT_LOCAL);
             for (unsigned int irank = 0; irank < size; ++irank)
-                for (it = rtag_map_proc[irank].begin(); it != rtag_map_proc[irank].end(); ++it)
-                    rank_rtag_map.insert(
-                        std::make_pair(it->first, std::make_pair(irank, it->second)));
-
-            // add groups to snapshot
-            std::map<unsigned int, std::pair<unsigned int, unsigned int>>::iterator rank_rtag_it;
+                for (unsigned int idx = 0; idx < tags_proc[irank].size(); ++idx)
+                    {
+                    unsigned int tag = tags_proc[irank][idx];
+                    assert(tag < n_tags);
+                    if (tag_rank[tag] == GROUP_NOT_LOCAL)
+                        {
+                        tag_rank[tag] = irank;
+                        tag_idx[tag] = idx;
+                        }
+                    }
 
             // index in snapshot
             unsigned int snap_id = 0;
@@ -1059,8 +1359,7 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::takeSnapshot(Snapsho
                  ++active_tag_it)
                 {
                 unsigned int group_tag = *active_tag_it;
-                rank_rtag_it = rank_rtag_map.find(group_tag);
-                if (rank_rtag_it == rank_rtag_map.end())
+                if (group_tag >= n_tags || tag_rank[group_tag] == GROUP_NOT_LOCAL)
                     {
                     std::ostringstream s;
                     s << "Could not find " << name << " " << group_tag << " on any processor.";
@@ -1071,9 +1370,8 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::takeSnapshot(Snapsho
                 index.insert(std::make_pair(group_tag, snap_id));
 
                 // rank contains the processor rank on which the particle was found
-                std::pair<unsigned int, unsigned int> rank_idx = rank_rtag_it->second;
-                unsigned int rank = rank_idx.first;
-                unsigned int idx = rank_idx.second;
+                unsigned int rank = tag_rank[group_tag];
+                unsigned int idx = tag_idx[group_tag];
 
                 if (has_type_mapping)
                     {
@@ -34,7 +34,9 @@ const unsigned int GROUP_NOT_LOCAL((unsigned int)0xffffffff);
 #include <pybind11/pybind11.h>
 #endif
 
+#include <istream>
 #include <map>
+#include <ostream>
 #include <set>
 #include <sstream>
 #include <stack>
@@ -271,6 +273,18 @@ class BondedGroupData
     //! Initialize from a snapshot
     virtual void initializeFromSnapshot(const Snapshot& snapshot);
 
+#ifdef ENABLE_MPI
+    //! Initialize from the slices of a snapshot distributed over all ranks
+    void initializeFromDistributedSnapshot(const Snapshot& snapshot,
+                                           const std::vector<unsigned int>& particle_owners);
+#endif
+
+    //! Write the local groups to a checkpoint
+    void writeCheckpoint(std::ostream& out);
+
+    //! Read the local groups from a checkpoint
+    void readCheckpoint(std::istream& in);
+
     //! Take a snapshot
     std::map<unsigned int, unsigned int> takeSnapshot(Snapshot& snapshot) const;
 
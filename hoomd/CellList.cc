@@ -10,6 +10,11 @@
 
 #include <algorithm>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 using namespace std;
 
 namespace hoomd
@@ -401,6 +406,74 @@ void CellList::initializeCellAdj()
                 }
     }
 
+/*! \param n Index of the particle
+    \param p Position of the particle
+    \param box Local simulation box
+    \param ghost_width Width of the ghost layer
+    \param conditions Condition flags to update when the particle cannot be binned
+    \returns The cell that particle \a n belongs in, or NOT_BINNED when it should be skipped
+*/
+unsigned int CellList::computeParticleBin(unsigned int n,
+                                          const Scalar3& p,
+                                          const BoxDim& box,
+                                          const Scalar3& ghost_width,
+                                          uint3& conditions) const
+    {
+    if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z))
+        {
+        conditions.y = max((unsigned int)conditions.y, n + 1);
+        return NOT_BINNED;
+        }
+
+    // find the bin each particle belongs in
+    Scalar3 f = box.makeFraction(p, ghost_width);
+    int ib = (int)(f.x * m_dim.x);
+    int jb = (int)(f.y * m_dim.y);
+    int kb = (int)(f.z * m_dim.z);
+
+    // check if the particle is inside the unit cell + ghost layer in all dimensions
+    if ((f.x < Scalar(-0.00001) || f.x >= Scalar(1.00001))
+        || (f.y < Scalar(-0.00001) || f.y >= Scalar(1.00001))
+        || (f.z < Scalar(-0.00001) || f.z >= Scalar(1.00001)))
+        {
+        // if a ghost particle is out of bounds, silently ignore it
+        if (n < m_pdata->getN())
+            conditions.z = max((unsigned int)conditions.z, n + 1);
+        return NOT_BINNED;
+        }
+
+    // need to handle the case where the particle is exactly at the box hi
+    uchar3 periodic = box.getPeriodic();
+    if (ib == (int)m_dim.x && periodic.x)
+        ib = 0;
+    if (jb == (int)m_dim.y && periodic.y)
+        jb = 0;
+    if (kb == (int)m_dim.z && periodic.z)
+        kb = 0;
+
+    // sanity check
+    assert((ib < (int)(m_dim.x) && jb < (int)(m_dim.y) && kb < (int)(m_dim.z))
+           || n >= m_pdata->getN());
+
+    // all particles should be in a valid cell
+    if (ib < 0 || ib >= (int)m_dim.x || jb < 0 || jb >= (int)m_dim.y || kb < 0
+        || kb >= (int)m_dim.z)
+        {
+        // but ghost particles that are out of range should not produce an error
+        if (n < m_pdata->getN())
+            conditions.z = max((unsigned int)conditions.z, n + 1);
+        return NOT_BINNED;
+        }
+
+    return m_cell_indexer(ib, jb, kb);
+    }
+
+/*! Particles are stored in each cell in order of increasing particle index. When TBB is enabled
+    and more than one CPU thread is in use, the particles are split into one contiguous chunk per
+    thread. Each chunk counts its particles per cell, an exclusive scan over the chunks gives each
+    chunk its first slot in every cell, and then the chunks fill their slots concurrently. The
+    resulting cell list is identical to the serial one for any number of threads.
+*/
 void CellList::computeCellList()
     {
     // acquire the particle data
@@ -427,7 +500,6 @@ void CellList::computeCellList()
     uint3 conditions = make_uint3(0, 0, 0);
 
     // shorthand copies of the indexers
-    Index3D ci = m_cell_indexer;
     Index2D cli = m_cell_list_indexer;
 
     // clear the bin sizes to 0
@@ -435,106 +507,173 @@ void CellList::computeCellList()
 
     Scalar3 ghost_width = getGhostWidth();
 
-    // get periodic flags
-    uchar3 periodic = box.getPeriodic();
+    // store particle n in slot offset of the given bin
+    auto store_particle = [&](unsigned int n, unsigned int offset, unsigned int bin)
+    {
+        // setup the flag value to store
+        Scalar flag;
+        if (m_flag_charge)
+            flag = h_charge.data[n];
+        else if (m_flag_type)
+            flag = h_pos.data[n].w;
+        else
+            flag = __int_as_scalar(n);
 
-    // for each particle
-    unsigned n_tot_particles = m_pdata->getN() + m_pdata->getNGhosts();
+        if (m_compute_xyzf)
+            {
+            h_xyzf.data[cli(offset, bin)]
+                = make_scalar4(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z, flag);
+            }
 
-    for (unsigned int n = 0; n < n_tot_particles; n++)
-        {
-        Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
-        if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z))
+        if (m_compute_type_body)
             {
-            conditions.y = n + 1;
-            continue;
+            h_type_body.data[cli(offset, bin)]
+                = make_uint2(__scalar_as_int(h_pos.data[n].w), h_body.data[n]);
             }
 
-        // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(p, ghost_width);
-        int ib = (int)(f.x * m_dim.x);
-        int jb = (int)(f.y * m_dim.y);
-        int kb = (int)(f.z * m_dim.z);
+        if (m_compute_orientation)
+            {
+            h_cell_orientation.data[cli(offset, bin)] = h_orientation.data[n];
+            }
 
-        // check if the particle is inside the unit cell + ghost layer in all dimensions
-        if ((f.x < Scalar(-0.00001) || f.x >= Scalar(1.00001))
-            || (f.y < Scalar(-0.00001) || f.y >= Scalar(1.00001))
-            || (f.z < Scalar(-0.00001) || f.z >= Scalar(1.00001)))
+        if (m_compute_idx)
             {
-            // if a ghost particle is out of bounds, silently ignore it
-            if (n < m_pdata->getN())
-                conditions.z = n + 1;
-            continue;
+            h_cell_idx.data[cli(offset, bin)] = n;
             }
+    };
 
-        // need to handle the case where the particle is exactly at the box hi
-        if (ib == (int)m_dim.x && periodic.x)
-            ib = 0;
-        if (jb == (int)m_dim.y && periodic.y)
-            jb = 0;
-        if (kb == (int)m_dim.z && periodic.z)
-            kb = 0;
+    // for each particle
+    unsigned n_tot_particles = m_pdata->getN() + m_pdata->getNGhosts();
 
-        // sanity check
-        assert((ib < (int)(m_dim.x) && jb < (int)(m_dim.y) && kb < (int)(m_dim.z))
-               || n >= m_pdata->getN());
+#ifdef ENABLE_TBB
+    const unsigned int n_threads = m_exec_conf->getNumThreads();
+    if (n_threads > 1)
+        {
+        const unsigned int n_cells = m_cell_indexer.getNumElements();
+        m_particle_bin.resize(n_tot_particles);
+        m_chunk_cell_offset.resize(size_t(n_threads) * n_cells);
+        std::vector<uint3> chunk_conditions(n_threads, make_uint3(0, 0, 0));
 
-        // record its bin
-        unsigned int bin = ci(ib, jb, kb);
+        auto chunk_begin = [&](unsigned int chunk)
+        { return (unsigned int)(uint64_t(n_tot_particles) * chunk / n_threads); };
 
-        // all particles should be in a valid cell
-        if (ib < 0 || ib >= (int)m_dim.x || jb < 0 || jb >= (int)m_dim.y || kb < 0
-            || kb >= (int)m_dim.z)
+        m_exec_conf->getTaskArena()->execute(
+            [&]
             {
-            // but ghost particles that are out of range should not produce an error
-            if (n < m_pdata->getN())
-                conditions.z = n + 1;
-            continue;
-            }
-
-        // setup the flag value to store
-        Scalar flag;
-        if (m_flag_charge)
-            flag = h_charge.data[n];
-        else if (m_flag_type)
-            flag = h_pos.data[n].w;
-        else
-            flag = __int_as_scalar(n);
-
-        // store the bin entries
-        unsigned int offset = h_cell_size.data[bin];
+                // count the particles of each chunk in every cell
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_threads, 1),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        for (unsigned int chunk = r.begin(); chunk != r.end(); ++chunk)
+                            {
+                            unsigned int* count
+                                = m_chunk_cell_offset.data() + size_t(chunk) * n_cells;
+                            std::fill(count, count + n_cells, 0);
+
+                            for (unsigned int n = chunk_begin(chunk); n < chunk_begin(chunk + 1);
+                                 n++)
+                                {
+                                Scalar3 p = make_scalar3(h_pos.data[n].x,
+                                                         h_pos.data[n].y,
+                                                         h_pos.data[n].z);
+                                unsigned int bin = computeParticleBin(n,
+                                                                      p,
+                                                                      box,
+                                                                      ghost_width,
+                                                                      chunk_conditions[chunk]);
+                                m_particle_bin[n] = bin;
+                                if (bin != NOT_BINNED)
+                                    count[bin]++;
+                                }
+                            }
+                    },
+                    tbb::static_partitioner());
+
+                // exclusive scan over the chunks gives the first slot of each chunk in each cell
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_cells),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      for (unsigned int bin = r.begin(); bin != r.end(); ++bin)
+                                          {
+                                          unsigned int offset = 0;
+                                          for (unsigned int chunk = 0; chunk < n_threads; ++chunk)
+                                              {
+                                              unsigned int& chunk_offset
+                                                  = m_chunk_cell_offset[size_t(chunk) * n_cells
+                                                                        + bin];
+                                              unsigned int count = chunk_offset;
+                                              chunk_offset = offset;
+                                              offset += count;
+                                              }
+                                          h_cell_size.data[bin] = offset;
+                                          }
+                                  });
+
+                // fill the cell list
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_threads, 1),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        for (unsigned int chunk = r.begin(); chunk != r.end(); ++chunk)
+                            {
+                            unsigned int* chunk_offset
+                                = m_chunk_cell_offset.data() + size_t(chunk) * n_cells;
+                            for (unsigned int n = chunk_begin(chunk); n < chunk_begin(chunk + 1);
+                                 n++)
+                                {
+                                unsigned int bin = m_particle_bin[n];
+                                if (bin == NOT_BINNED)
+                                    continue;
+
+                                unsigned int offset = chunk_offset[bin]++;
+                                if (offset < m_Nmax)
+                                    {
+                                    store_particle(n, offset, bin);
+                                    }
+                                else
+                                    {
+                                    chunk_conditions[chunk].x
+                                        = max((unsigned int)chunk_conditions[chunk].x, offset + 1);
+                                    }
+                                }
+                            }
+                    },
+                    tbb::static_partitioner());
+            });
 
-        if (offset < m_Nmax)
+        for (const uint3& c : chunk_conditions)
             {
-            if (m_compute_xyzf)
-                {
-                h_xyzf.data[cli(offset, bin)]
-                    = make_scalar4(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z, flag);
-                }
+            conditions.x = max((unsigned int)conditions.x, (unsigned int)c.x);
+            conditions.y = max((unsigned int)conditions.y, (unsigned int)c.y);
+            conditions.z = max((unsigned int)conditions.z, (unsigned int)c.z);
+            }
+        }
+    else
+#endif
+        {
+        for (unsigned int n = 0; n < n_tot_particles; n++)
+            {
+            Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
+            unsigned int bin = computeParticleBin(n, p, box, ghost_width, conditions);
+            if (bin == NOT_BINNED)
+                continue;
 
-            if (m_compute_type_body)
-                {
-                h_type_body.data[cli(offset, bin)]
-                    = make_uint2(__scalar_as_int(h_pos.data[n].w), h_body.data[n]);
-                }
+            // store the bin entries
+            unsigned int offset = h_cell_size.data[bin];
 
-            if (m_compute_orientation)
+            if (offset < m_Nmax)
                 {
-                h_cell_orientation.data[cli(offset, bin)] = h_orientation.data[n];
+                store_particle(n, offset, bin);
                 }
-
-            if (m_compute_idx)
+            else
                 {
-                h_cell_idx.data[cli(offset, bin)] = n;
+                conditions.x = max((unsigned int)conditions.x, offset + 1);
                 }
-            }
-        else
-            {
-            conditions.x = max((unsigned int)conditions.x, offset + 1);
-            }
 
-        // increment the cell occupancy counter
-        h_cell_size.data[bin]++;
+            // increment the cell occupancy counter
+            h_cell_size.data[bin]++;
+            }
         }
 
         {
@@ -9,6 +9,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <vector>
 
 /*! \file CellList.h
     \brief Declares the CellList class
@@ -391,6 +392,14 @@ class PYBIND11_EXPORT CellList : public Compute
     bool m_sort_cell_list;   //!< If true, sort cell list
     bool m_compute_adj_list; //!< If true, compute the cell adjacency lists
 
+#ifdef ENABLE_TBB
+    std::vector<unsigned int> m_particle_bin;      //!< Cell of each particle (threaded build)
+    std::vector<unsigned int> m_chunk_cell_offset; //!< Per chunk cell counts (threaded build)
+#endif
+
+    //! Bin index for particles that are not placed in any cell
+    static constexpr unsigned int NOT_BINNED = 0xffffffff;
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
@@ -414,6 +423,13 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Compute the cell list
     virtual void computeCellList();
 
+    //! Find the cell that a particle belongs in
+    unsigned int computeParticleBin(unsigned int n,
+                                    const Scalar3& p,
+                                    const BoxDim& box,
+                                    const Scalar3& ghost_width,
+                                    uint3& conditions) const;
+
     //! Check the status of the conditions
     bool checkConditions();
 
@@ -0,0 +1,337 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Checkpoint.cc
+    \brief Defines the N-to-N binary checkpoint reader and writer
+*/
+
+#include "Checkpoint.h"
+
+#ifdef ENABLE_MPI
+#include "HOOMDMPI.h"
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace detail
+    {
+/// Identifies checkpoint files
+const char checkpoint_magic[8] = {'H', 'O', 'O', 'M', 'D', 'C', 'K', 'P'};
+
+/// Version of the checkpoint format
+const uint32_t checkpoint_version = 1;
+
+void writeCheckpointNames(std::ostream& out, const std::vector<std::string>& names)
+    {
+    writeCheckpointValue(out, (uint64_t)names.size());
+    for (const std::string& name : names)
+        writeCheckpointArray(out, name.data(), name.size());
+    }
+
+void readCheckpointNames(std::istream& in, std::vector<std::string>& names)
+    {
+    uint64_t n;
+    readCheckpointValue(in, n);
+    names.resize(n);
+    std::vector<char> buffer;
+    for (std::string& name : names)
+        {
+        readCheckpointArray(in, buffer);
+        name.assign(buffer.begin(), buffer.end());
+        }
+    }
+
+void CheckpointHeader::write(std::ostream& out) const
+    {
+    out.write(checkpoint_magic, sizeof(checkpoint_magic));
+    writeCheckpointValue(out, checkpoint_version);
+    writeCheckpointValue(out, (uint32_t)sizeof(Scalar));
+    writeCheckpointValue(out, n_ranks);
+    writeCheckpointValue(out, domain);
+    writeCheckpointValue(out, dimensions);
+    writeCheckpointValue(out, timestep);
+    writeCheckpointValue(out, seed);
+    writeCheckpointValue(out, grid);
+    writeCheckpointValue(out, box);
+    for (unsigned int dir = 0; dir < 3; dir++)
+        writeCheckpointArray(out, fractions[dir].data(), fractions[dir].size());
+    }
+
+void CheckpointHeader::read(std::istream& in)
+    {
+    char magic[sizeof(checkpoint_magic)];
+    uint32_t version, scalar_size;
+    in.read(magic, sizeof(magic));
+    if (!in || memcmp(magic, checkpoint_magic, sizeof(magic)) != 0)
+        throw runtime_error("Not a HOOMD-blue checkpoint file.");
+    readCheckpointValue(in, version);
+    if (version != checkpoint_version)
+        {
+        ostringstream s;
+        s << "Unsupported checkpoint version " << version << ".";
+        throw runtime_error(s.str());
+        }
+    readCheckpointValue(in, scalar_size);
+    if (scalar_size != sizeof(Scalar))
+        throw runtime_error("Checkpoint was written with a different floating point precision.");
+
+    readCheckpointValue(in, n_ranks);
+    readCheckpointValue(in, domain);
+    readCheckpointValue(in, dimensions);
+    readCheckpointValue(in, timestep);
+    readCheckpointValue(in, seed);
+    readCheckpointValue(in, grid);
+    readCheckpointValue(in, box);
+    for (unsigned int dir = 0; dir < 3; dir++)
+        readCheckpointArray(in, fractions[dir]);
+    }
+
+/// Name of the file that stores a given domain
+static std::string checkpointFileName(const std::string& filename, unsigned int domain)
+    {
+    return filename + "." + std::to_string(domain);
+    }
+
+#ifdef ENABLE_MPI
+/// Index of the domain of this rank
+static unsigned int getDomain(std::shared_ptr<DomainDecomposition> decomposition)
+    {
+    if (!decomposition)
+        return 0;
+
+    uint3 grid_pos = decomposition->getGridPos();
+    return decomposition->getDomainIndexer()(grid_pos.x, grid_pos.y, grid_pos.z);
+    }
+#endif
+
+/// Throw on all ranks when an error occurred on any rank
+/*! \param exec_conf The execution configuration
+    \param error_message Error message on this rank, empty when there is no error
+*/
+static void checkCheckpointError(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                                 const std::string& error_message)
+    {
+    int error = !error_message.empty();
+#ifdef ENABLE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_INT, MPI_MAX, exec_conf->getMPICommunicator());
+#endif
+    if (error)
+        {
+        throw runtime_error(error_message.empty() ? "Error in checkpoint on another rank."
+                                                  : error_message);
+        }
+    }
+
+    } // end namespace detail
+
+/*! The files start with the same header and store the local particles followed by the local bonds,
+    angles, dihedrals, impropers, constraints, and special pairs.
+
+    Errors are reduced over all ranks before throwing to avoid deadlocks.
+*/
+void writeCheckpoint(std::shared_ptr<SystemDefinition> sysdef,
+                     uint64_t timestep,
+                     const std::string& filename)
+    {
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+    std::shared_ptr<const ExecutionConfiguration> exec_conf = pdata->getExecConf();
+
+    detail::CheckpointHeader header;
+    header.n_ranks = exec_conf->getNRanks();
+    header.dimensions = sysdef->getNDimensions();
+    header.timestep = timestep;
+    header.seed = sysdef->getSeed();
+
+    const BoxDim box = pdata->getGlobalBox();
+    Scalar3 L = box.getL();
+    header.box = {L.x,
+                  L.y,
+                  L.z,
+                  box.getTiltFactorXY(),
+                  box.getTiltFactorXZ(),
+                  box.getTiltFactorYZ()};
+
+#ifdef ENABLE_MPI
+    std::shared_ptr<DomainDecomposition> decomposition = pdata->getDomainDecomposition();
+    header.domain = detail::getDomain(decomposition);
+    if (decomposition)
+        {
+        header.grid = decomposition->getGridSize();
+        for (unsigned int dir = 0; dir < 3; dir++)
+            header.fractions[dir] = decomposition->getCumulativeFractions(dir);
+        }
+#endif
+
+    std::string error_message;
+    std::string name = detail::checkpointFileName(filename, header.domain);
+    try
+        {
+        std::ofstream out(name, std::ios::binary | std::ios::trunc);
+        if (!out)
+            throw runtime_error("Unable to open " + name + " for writing.");
+
+        header.write(out);
+        pdata->writeCheckpoint(out);
+        sysdef->getBondData()->writeCheckpoint(out);
+        sysdef->getAngleData()->writeCheckpoint(out);
+        sysdef->getDihedralData()->writeCheckpoint(out);
+        sysdef->getImproperData()->writeCheckpoint(out);
+        sysdef->getConstraintData()->writeCheckpoint(out);
+        sysdef->getPairData()->writeCheckpoint(out);
+
+        out.close();
+        if (!out)
+            throw runtime_error("Error writing " + name + ".");
+        }
+    catch (const std::exception& e)
+        {
+        error_message = e.what();
+        }
+
+    detail::checkCheckpointError(exec_conf, error_message);
+    }
+
+/*! \param exec_conf The execution configuration
+    \param filename Base name of the checkpoint files
+
+    The root rank reads the header of the first file and broadcasts it to all ranks.
+*/
+CheckpointReader::CheckpointReader(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                   const std::string& filename)
+    : m_exec_conf(exec_conf), m_filename(filename)
+    {
+    std::string error_message;
+    std::string header_bytes;
+    if (m_exec_conf->isRoot())
+        {
+        std::string name = detail::checkpointFileName(m_filename, 0);
+        try
+            {
+            std::ifstream in(name, std::ios::binary);
+            if (!in)
+                throw runtime_error("Unable to open " + name + " for reading.");
+            m_header.read(in);
+
+            std::ostringstream out;
+            m_header.write(out);
+            header_bytes = out.str();
+            }
+        catch (const std::exception& e)
+            {
+            error_message = e.what();
+            }
+        }
+
+    detail::checkCheckpointError(m_exec_conf, error_message);
+
+#ifdef ENABLE_MPI
+    bcast(header_bytes, 0, m_exec_conf->getMPICommunicator());
+    std::istringstream in(header_bytes);
+    m_header.read(in);
+#endif
+
+    if (m_header.n_ranks != m_exec_conf->getNRanks())
+        {
+        ostringstream s;
+        s << "Checkpoint " << m_filename << " was written by " << m_header.n_ranks
+          << " ranks and must be read by the same number of ranks, not "
+          << m_exec_conf->getNRanks() << ".";
+        throw runtime_error(s.str());
+        }
+    }
+
+/*! Restores the domain decomposition of the checkpoint. Each rank reads the particles and groups
+    of its domain from the matching file.
+*/
+std::shared_ptr<SystemDefinition> CheckpointReader::getSystemDefinition()
+    {
+    auto box = std::make_shared<BoxDim>(m_header.box);
+    std::shared_ptr<SystemDefinition> sysdef;
+    unsigned int domain = 0;
+
+#ifdef ENABLE_MPI
+    std::shared_ptr<DomainDecomposition> decomposition;
+    if (m_header.n_ranks > 1)
+        {
+        // the constructor takes the fractions of the first n-1 domains in each direction
+        std::vector<Scalar> fractions[3];
+        for (unsigned int dir = 0; dir < 3; dir++)
+            {
+            const std::vector<Scalar>& cumulative = m_header.fractions[dir];
+            for (size_t i = 1; i + 1 < cumulative.size(); i++)
+                fractions[dir].push_back(cumulative[i] - cumulative[i - 1]);
+            }
+
+        Scalar3 L = make_scalar3(m_header.box[0], m_header.box[1], m_header.box[2]);
+        decomposition = std::make_shared<DomainDecomposition>(m_exec_conf,
+                                                              L,
+                                                              fractions[0],
+                                                              fractions[1],
+                                                              fractions[2]);
+        }
+
+    sysdef = std::make_shared<SystemDefinition>(0, box, 1, 0, 0, 0, 0, m_exec_conf, decomposition);
+    domain = detail::getDomain(decomposition);
+#else
+    sysdef = std::make_shared<SystemDefinition>(0, box, 1, 0, 0, 0, 0, m_exec_conf);
+#endif
+
+    std::string error_message;
+    std::string name = detail::checkpointFileName(m_filename, domain);
+    try
+        {
+        std::ifstream in(name, std::ios::binary);
+        if (!in)
+            throw runtime_error("Unable to open " + name + " for reading.");
+
+        detail::CheckpointHeader header;
+        header.read(in);
+        if (header.domain != domain || header.timestep != m_header.timestep
+            || header.n_ranks != m_header.n_ranks)
+            {
+            throw runtime_error(name + " does not belong to the same checkpoint as "
+                                + detail::checkpointFileName(m_filename, 0) + ".");
+            }
+
+        sysdef->getParticleData()->readCheckpoint(in);
+        sysdef->getBondData()->readCheckpoint(in);
+        sysdef->getAngleData()->readCheckpoint(in);
+        sysdef->getDihedralData()->readCheckpoint(in);
+        sysdef->getImproperData()->readCheckpoint(in);
+        sysdef->getConstraintData()->readCheckpoint(in);
+        sysdef->getPairData()->readCheckpoint(in);
+        }
+    catch (const std::exception& e)
+        {
+        error_message = e.what();
+        }
+
+    detail::checkCheckpointError(m_exec_conf, error_message);
+
+    sysdef->setNDimensions(m_header.dimensions);
+    sysdef->setSeed(m_header.seed);
+    return sysdef;
+    }
+
+namespace detail
+    {
+void export_Checkpoint(pybind11::module& m)
+    {
+    m.def("write_checkpoint", &writeCheckpoint);
+
+    pybind11::class_<CheckpointReader, std::shared_ptr<CheckpointReader>>(m, "CheckpointReader")
+        .def(pybind11::init<std::shared_ptr<ExecutionConfiguration>, const std::string&>())
+        .def("getTimeStep", &CheckpointReader::getTimeStep)
+        .def("getSeed", &CheckpointReader::getSeed)
+        .def("getSystemDefinition", &CheckpointReader::getSystemDefinition);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,149 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Checkpoint.h
+    \brief Declares the N-to-N binary checkpoint reader and writer
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "SystemDefinition.h"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <pybind11/pybind11.h>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hoomd
+    {
+namespace detail
+    {
+/// Write a trivially copyable value to a checkpoint stream
+template<class T> void writeCheckpointValue(std::ostream& out, const T& value)
+    {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint values must be POD types");
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+/// Read a trivially copyable value from a checkpoint stream
+template<class T> void readCheckpointValue(std::istream& in, T& value)
+    {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint values must be POD types");
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!in)
+        throw std::runtime_error("Unexpected end of checkpoint file.");
+    }
+
+/// Write an array of trivially copyable values to a checkpoint stream, preceded by its length
+template<class T> void writeCheckpointArray(std::ostream& out, const T* data, uint64_t n)
+    {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint values must be POD types");
+    writeCheckpointValue(out, n);
+    out.write(reinterpret_cast<const char*>(data), n * sizeof(T));
+    }
+
+/// Read an array written by writeCheckpointArray()
+template<class T> void readCheckpointArray(std::istream& in, std::vector<T>& data)
+    {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint values must be POD types");
+    uint64_t n;
+    readCheckpointValue(in, n);
+    data.resize(n);
+    in.read(reinterpret_cast<char*>(data.data()), n * sizeof(T));
+    if (!in)
+        throw std::runtime_error("Unexpected end of checkpoint file.");
+    }
+
+/// Write a list of names to a checkpoint stream
+void writeCheckpointNames(std::ostream& out, const std::vector<std::string>& names);
+
+/// Read a list of names written by writeCheckpointNames()
+void readCheckpointNames(std::istream& in, std::vector<std::string>& names);
+
+/// Global information stored at the start of every checkpoint file
+struct CheckpointHeader
+    {
+    unsigned int n_ranks = 1;    //!< Number of ranks that wrote the checkpoint
+    unsigned int domain = 0;     //!< Index of the domain stored in the file
+    unsigned int dimensions = 3; //!< Dimensionality of the system
+    uint64_t timestep = 0;       //!< Timestep of the checkpoint
+    uint16_t seed = 0;           //!< Simulation seed
+    uint3 grid = {1, 1, 1};      //!< Number of domains in each direction
+
+    /// Box lengths and tilt factors
+    std::array<Scalar, 6> box = {0, 0, 0, 0, 0, 0};
+
+    /// Cumulative domain fractions in each direction
+    std::vector<Scalar> fractions[3];
+
+    /// Write the header to a stream
+    void write(std::ostream& out) const;
+
+    /// Read the header from a stream
+    void read(std::istream& in);
+    };
+
+    } // end namespace detail
+
+/// Write an N-to-N binary checkpoint
+/*! \param sysdef System definition to write
+    \param timestep Current timestep
+    \param filename Base name of the checkpoint files
+
+    Every rank writes the particles and bonded groups it owns to its own file, named after the
+    index of its domain: <filename>.<domain>. No data is communicated between the ranks.
+*/
+void writeCheckpoint(std::shared_ptr<SystemDefinition> sysdef,
+                     uint64_t timestep,
+                     const std::string& filename);
+
+/// Read an N-to-N binary checkpoint written by writeCheckpoint()
+/*! The checkpoint must be read with the same number of ranks that wrote it. CheckpointReader
+    restores the domain decomposition of the checkpoint, then each rank reads the file of its
+    domain.
+*/
+class PYBIND11_EXPORT CheckpointReader
+    {
+    public:
+    /// Read the header of the checkpoint
+    CheckpointReader(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                     const std::string& filename);
+
+    /// Get the timestep of the checkpoint
+    uint64_t getTimeStep() const
+        {
+        return m_header.timestep;
+        }
+
+    /// Get the simulation seed of the checkpoint
+    uint16_t getSeed() const
+        {
+        return m_header.seed;
+        }
+
+    /// Read the system definition from the checkpoint
+    std::shared_ptr<SystemDefinition> getSystemDefinition();
+
+    private:
+    std::shared_ptr<ExecutionConfiguration> m_exec_conf; //!< The execution configuration
+    std::string m_filename;                              //!< Base name of the checkpoint files
+    detail::CheckpointHeader m_header;                   //!< Header of the checkpoint
+    };
+
+namespace detail
+    {
+/// Export the checkpoint reader and writer to python
+void export_Checkpoint(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -1512,6 +1512,9 @@ void Communicator::communicate(uint64_t timestep)
     // Guard to prevent recursive triggering of migration
     m_is_communicating = true;
 
+    Profiler* profiler = m_exec_conf->getProfiler();
+    ProfilerScope scope(profiler, "Communicator");
+
     // update ghost communication flags
     m_flags = CommFlags(0);
     m_requested_flags.emit_accumulate([&](CommFlags f) { m_flags |= f; }, timestep);
@@ -1519,8 +1522,15 @@ void Communicator::communicate(uint64_t timestep)
     if (!m_force_migrate && !m_compute_callbacks.empty() && m_has_ghost_particles)
         {
         // do an obligatory update before determining whether to migrate
-        beginUpdateGhosts(timestep);
-        finishUpdateGhosts(timestep);
+            {
+            ProfilerScope update_scope(profiler, "updateGhosts");
+            beginUpdateGhosts(timestep);
+
+            // compute with local particle data while the ghost update is in flight
+            m_ghost_update_overlap_callbacks.emit(timestep);
+
+            finishUpdateGhosts(timestep);
+            }
 
         // call subscribers after ghost update, but before distance check
         m_compute_callbacks.emit(timestep);
@@ -1543,6 +1553,7 @@ void Communicator::communicate(uint64_t timestep)
     // Update ghosts if we are not migrating
     if (!migrate && m_compute_callbacks.empty())
         {
+        ProfilerScope update_scope(profiler, "updateGhosts");
         beginUpdateGhosts(timestep);
 
         finishUpdateGhosts(timestep);
@@ -1554,10 +1565,16 @@ void Communicator::communicate(uint64_t timestep)
         m_force_migrate = false;
 
         // If so, migrate atoms
-        migrateParticles();
+            {
+            ProfilerScope migrate_scope(profiler, "migrateParticles");
+            migrateParticles();
+            }
 
         // Construct ghost send lists, exchange ghost atom data
-        exchangeGhosts();
+            {
+            ProfilerScope exchange_scope(profiler, "exchangeGhosts");
+            exchangeGhosts();
+            }
 
         // update particle data now that ghosts are available
         m_compute_callbacks.emit(timestep);
@@ -2626,23 +2643,68 @@ void Communicator::exchangeGhosts()
         }
     }
 
-//! update positions of ghost particles
+/*! The ghost update proceeds in stages, one per communicating direction. Ghosts received in one
+    stage may be forwarded in a later stage (to fill the edges and corners of the ghost layer), so
+    the stages must complete in order. beginUpdateGhosts() posts the non-blocking messages of the
+    first stage and returns. That stage sends only local particles, so the caller may compute with
+    local particle data until it calls finishUpdateGhosts(), which completes the first stage and
+    performs the remaining ones.
+*/
 void Communicator::beginUpdateGhosts(uint64_t timestep)
     {
     // we have a current m_copy_ghosts liss which contain the indices of particles
     // to send to neighboring processors
     m_exec_conf->msg->notice(7) << "Communicator: update ghosts" << std::endl;
 
-    // update data in these arrays
-
-    unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
+    m_ghost_update_start = m_pdata->getN();
 
     for (unsigned int dir = 0; dir < 6; dir++)
         {
         if (!isCommunicating(dir))
             continue;
 
-        CommFlags flags = getFlags();
+        postGhostUpdate(dir);
+        m_ghost_update_dir = dir;
+        m_comm_pending = true;
+        break;
+        }
+    }
+
+void Communicator::finishUpdateGhosts(uint64_t timestep)
+    {
+    if (!m_comm_pending)
+        return;
+
+    waitGhostUpdate(m_ghost_update_dir);
+
+    for (unsigned int dir = m_ghost_update_dir + 1; dir < 6; dir++)
+        {
+        if (!isCommunicating(dir))
+            continue;
+
+        postGhostUpdate(dir);
+        waitGhostUpdate(dir);
+        }
+
+    m_comm_pending = false;
+    }
+
+/*! \param dir Direction of the stage
+
+    Copy the ghost fields to send in direction \a dir into the send buffers and post the messages.
+    The messages write directly to the ghost particle data, starting at m_ghost_update_start.
+*/
+void Communicator::postGhostUpdate(unsigned int dir)
+    {
+    CommFlags flags = getFlags();
+
+        {
+        ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
 
         if (flags[comm_flag::position])
             {
@@ -2652,12 +2714,6 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
             ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
                                                access_location::host,
                                                access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
 
             // copy positions of ghost particles
             for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
@@ -2679,12 +2735,6 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
             ArrayHandle<Scalar4> h_velocity_copybuf(m_velocity_copybuf,
                                                     access_location::host,
                                                     access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
 
             // copy velocity of ghost particles
             for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
@@ -2706,12 +2756,6 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
             ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
                                                        access_location::host,
                                                        access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
 
             // copy orientation of ghost particles
             for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
@@ -2724,133 +2768,92 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                 h_orientation_copybuf.data[ghost_idx] = h_orientation.data[idx];
                 }
             }
+        }
 
-        unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
+    unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
 
-        // we receive from the direction opposite to the one we send to
-        unsigned int recv_neighbor;
-        if (dir % 2 == 0)
-            recv_neighbor = m_decomposition->getNeighborRank(dir + 1);
-        else
-            recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
+    // we receive from the direction opposite to the one we send to
+    unsigned int recv_neighbor;
+    if (dir % 2 == 0)
+        recv_neighbor = m_decomposition->getNeighborRank(dir + 1);
+    else
+        recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
 
-        unsigned int start_idx;
+    unsigned int start_idx = m_ghost_update_start;
 
-        start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+    m_reqs.clear();
 
-        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
-
-        // only non-permanent fields (position, velocity, orientation) need to be considered here
-        // charge, body, image and diameter are not updated between neighbor list builds
-        if (flags[comm_flag::position])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+    // only non-permanent fields (position, velocity, orientation) need to be considered here
+    // charge, body, image and diameter are not updated between neighbor list builds
+    // the host pointers remain valid after the handles are released: the arrays are not resized
+    // while the messages are in flight
+    auto post = [&](const GlobalArray<Scalar4>& field, const GlobalArray<Scalar4>& copybuf, int tag)
+    {
+        ArrayHandle<Scalar4> h_field(field, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_copybuf(copybuf, access_location::host, access_mode::read);
 
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
+        // exchange particle data, write directly to the particle data arrays
+        MPI_Request req;
+        MPI_Isend(h_copybuf.data,
+                  (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
+                  MPI_BYTE,
+                  send_neighbor,
+                  tag,
+                  m_mpi_comm,
+                  &req);
+        m_reqs.push_back(req);
+        MPI_Irecv(h_field.data + start_idx,
+                  (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
+                  MPI_BYTE,
+                  recv_neighbor,
+                  tag,
+                  m_mpi_comm,
+                  &req);
+        m_reqs.push_back(req);
+    };
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_pos_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_pos.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-            }
+    if (flags[comm_flag::position])
+        post(m_pdata->getPositions(), m_pos_copybuf, 1);
 
-        if (flags[comm_flag::velocity])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+    if (flags[comm_flag::velocity])
+        post(m_pdata->getVelocities(), m_velocity_copybuf, 2);
 
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> h_vel_copybuf(m_velocity_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
+    if (flags[comm_flag::orientation])
+        post(m_pdata->getOrientationArray(), m_orientation_copybuf, 3);
+    }
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_vel_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_vel.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-            }
+/*! \param dir Direction of the stage
 
-        if (flags[comm_flag::orientation])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+    Wait for the messages posted by postGhostUpdate() and wrap the received positions.
+*/
+void Communicator::waitGhostUpdate(unsigned int dir)
+    {
+    if (m_reqs.size())
+        {
+        m_stats.resize(m_reqs.size());
+        MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &m_stats.front());
+        }
 
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                               access_location::host,
-                                               access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
-                                                       access_location::host,
-                                                       access_mode::read);
+    unsigned int start_idx = m_ghost_update_start;
+    m_ghost_update_start += m_num_recv_ghosts[dir];
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_orientation_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_orientation.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-            }
+    // wrap particle positions (only if copying positions)
+    if (getFlags()[comm_flag::position])
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
 
-        // wrap particle positions (only if copying positions)
-        if (flags[comm_flag::position])
+        const BoxDim shifted_box = getShiftedBox();
+        for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
             {
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::readwrite);
+            Scalar4& pos = h_pos.data[idx];
 
-            const BoxDim shifted_box = getShiftedBox();
-            for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
-                {
-                Scalar4& pos = h_pos.data[idx];
-
-                // wrap particles received across a global boundary
-                int3 img = make_int3(0, 0, 0);
-                shifted_box.wrap(pos, img);
-                }
+            // wrap particles received across a global boundary
+            int3 img = make_int3(0, 0, 0);
+            shifted_box.wrap(pos, img);
             }
-
-        } // end dir loop
+        }
     }
 
 void Communicator::updateNetForce(uint64_t timestep)
@@ -231,6 +231,20 @@ class PYBIND11_EXPORT Communicator
         return m_compute_callbacks;
         }
 
+    //! Subscribe to list of *optional* call-backs for computation that overlaps the ghost update
+    /*!
+     * Subscribe to a list of call-backs that are called between beginUpdateGhosts() and
+     * finishUpdateGhosts() on steps that start with a ghost update. The ghost particle data is in
+     * flight during the call and subscribers must access only local particle data. The step may
+     * still migrate particles after the call.
+     *
+     * \return A Nano::Signal object reference to be used for connect and disconnect calls.
+     */
+    Nano::Signal<void(uint64_t timestep)>& getGhostUpdateOverlapSignal()
+        {
+        return m_ghost_update_overlap_callbacks;
+        }
+
     //! Get the ghost communication flags
     CommFlags getFlags()
         {
@@ -322,11 +336,7 @@ class PYBIND11_EXPORT Communicator
      *
      * \param timestep The time step
      */
-    virtual void finishUpdateGhosts(uint64_t timestep)
-        {
-        // the base class implementation is currently empty
-        m_comm_pending = false;
-        }
+    virtual void finishUpdateGhosts(uint64_t timestep);
 
     /*! Communicate the net particle force
      * \parm timestep The time step
@@ -582,15 +592,20 @@ class PYBIND11_EXPORT Communicator
     Nano::Signal<void(uint64_t timestep)>
         m_compute_callbacks; //!< List of functions that are called after ghost communication
 
+    /// List of functions that are called while the ghost update is in flight
+    Nano::Signal<void(uint64_t timestep)> m_ghost_update_overlap_callbacks;
+
     Nano::Signal<void(const GlobalArray<unsigned int>&)>
         m_comm_callbacks; //!< List of functions that are called after the compute callbacks
 
     CommFlags m_flags;      //!< The ghost communication flags
     CommFlags m_last_flags; //!< Flags of last ghost exchange
 
-    bool m_comm_pending;             //!< If true, a communication is in process
-    std::vector<MPI_Request> m_reqs; //!< Container for all MPI communication requests
-    std::vector<MPI_Status> m_stats; //!< Container for all MPI communication statuses
+    bool m_comm_pending;                   //!< If true, a communication is in process
+    unsigned int m_ghost_update_dir = 0;   //!< Direction of the pending ghost update stage
+    unsigned int m_ghost_update_start = 0; //!< Index of the first ghost received in the stage
+    std::vector<MPI_Request> m_reqs;       //!< Container for all MPI communication requests
+    std::vector<MPI_Status> m_stats;       //!< Container for all MPI communication statuses
 
     /* Bonds communication */
     bool m_bonds_changed; //!< True if bond information needs to be refreshed
@@ -682,6 +697,12 @@ class PYBIND11_EXPORT Communicator
         }
 
     private:
+    //! Post the messages of one stage of the ghost update
+    void postGhostUpdate(unsigned int dir);
+
+    //! Complete one stage of the ghost update
+    void waitGhostUpdate(unsigned int dir);
+
     std::vector<detail::pdata_element> m_sendbuf; //!< Buffer for particles that are sent
     std::vector<detail::pdata_element> m_recvbuf; //!< Buffer for particles that are received
 
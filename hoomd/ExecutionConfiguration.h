@@ -31,6 +31,7 @@
 #endif
 
 #include "Messenger.h"
+#include "Profiler.h"
 
 /*! \file ExecutionConfiguration.h
     \brief Declares ExecutionConfiguration and related classes
@@ -305,6 +306,31 @@ class PYBIND11_EXPORT ExecutionConfiguration
         return m_memory_tracing;
         }
 
+    /// Enable or disable the per-operation profiler
+    /*! Enabling the profiler discards any previously accumulated times.
+     */
+    void setProfiling(bool enable)
+        {
+        if (enable && !m_profiler)
+            m_profiler = std::make_shared<Profiler>(isCUDAEnabled());
+        else if (!enable)
+            m_profiler.reset();
+        }
+
+    /// Get the profiler
+    /*! \returns nullptr when profiling is disabled. Pass the result to ProfilerScope.
+     */
+    Profiler* getProfiler() const
+        {
+        return m_profiler.get();
+        }
+
+    /// Get the profiler (shared pointer, for python)
+    std::shared_ptr<Profiler> getProfilerShared() const
+        {
+        return m_profiler;
+        }
+
     //! Returns true if we are in a multi-GPU block
     bool inMultiGPUBlock() const
         {
@@ -410,6 +436,9 @@ class PYBIND11_EXPORT ExecutionConfiguration
     void setupStats();
 
     bool m_memory_tracing = false;
+
+    /// The per-operation profiler (null when profiling is disabled)
+    std::shared_ptr<Profiler> m_profiler;
     };
 
 #if defined(ENABLE_HIP)
@@ -26,7 +26,8 @@ namespace hoomd
     \post All forces are initialized to 0
 */
 ForceCompute::ForceCompute(std::shared_ptr<SystemDefinition> sysdef)
-    : Compute(sysdef), m_particles_sorted(false), m_buffers_writeable(false)
+    : Compute(sysdef), m_particles_sorted(false), m_buffers_writeable(false),
+      m_accumulate_net_force(false), m_force_arrays_stale(false)
     {
     assert(m_pdata);
     assert(m_pdata->getMaxN() > 0);
@@ -99,6 +100,13 @@ ForceCompute::ForceCompute(std::shared_ptr<SystemDefinition> sysdef)
     // start with no flags computed
     m_computed_flags.reset();
 
+    registerLoggable("energy",
+                     [this](uint64_t timestep)
+                     {
+                         compute(timestep);
+                         return double(calcEnergySum());
+                     });
+
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
@@ -562,14 +570,52 @@ pybind11::object ForceCompute::getVirialsPython()
 void ForceCompute::compute(uint64_t timestep)
     {
     Compute::compute(timestep);
-    // recompute forces if the particles were sorted, this is a new timestep, or the particle data
-    // flags do not match
-    if (m_particles_sorted || shouldCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
+    // recompute forces if the particles were sorted, this is a new timestep, the particle data
+    // flags do not match, or the last computation went directly to the net force
+    if (m_particles_sorted || m_force_arrays_stale || shouldCompute(timestep)
+        || m_pdata->getFlags() != m_computed_flags)
+        {
+        ProfilerScope scope(m_exec_conf->getProfiler(), m_profile_name);
+        int64_t start = m_clk.getTime();
+        computeForces(timestep);
+        m_sysdef->addForceComputeTime(m_clk.getTime() - start);
+        }
+
+    m_particles_sorted = false;
+    m_force_arrays_stale = false;
+    m_computed_flags = m_pdata->getFlags();
+    }
+
+/*! \param timestep Current time step
+
+    Compute the forces and add them to the particle data net force and net virial in place of
+    writing m_force and m_virial. This saves the memory traffic of writing the per-force arrays and
+    reading them back when the Integrator sums the net force. The caller must zero the net force
+    and net virial first.
+
+    Afterwards, m_force and m_virial are stale. The next call to compute() recomputes them, so
+    per-force quantities (energy, forces, virials) are evaluated only on the steps where something
+    requests them.
+*/
+void ForceCompute::computeIntoNetForce(uint64_t timestep)
+    {
+    assert(canAccumulateNetForce());
+
+    Compute::compute(timestep);
+    // keep the last computed timestep up to date
+    shouldCompute(timestep);
+
         {
+        ProfilerScope scope(m_exec_conf->getProfiler(), m_profile_name);
+        int64_t start = m_clk.getTime();
+        m_accumulate_net_force = true;
         computeForces(timestep);
+        m_accumulate_net_force = false;
+        m_sysdef->addForceComputeTime(m_clk.getTime() - start);
         }
 
     m_particles_sorted = false;
+    m_force_arrays_stale = true;
     m_computed_flags = m_pdata->getFlags();
     }
 
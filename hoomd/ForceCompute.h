@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "ClockSource.h"
 #include "Compute.h"
 #include "GlobalArray.h"
 #include "HOOMDMath.h"
@@ -71,11 +72,38 @@ class PYBIND11_EXPORT ForceCompute : public Compute
      * and can be used to overlap computation with communication
      */
     virtual void preCompute(uint64_t timestep) { }
+
+    //! Returns true if computeInteriorForces is implemented
+    virtual bool canComputeInteriorForces()
+        {
+        return false;
+        }
+
+    //! Compute the forces on local particles that interact only with other local particles
+    /*! The Integrator calls this method while the ghost particle positions are in flight. Derived
+        classes that return true from canComputeInteriorForces() compute the part of the forces
+        that does not depend on ghost particles here and the remainder in computeForces(). They
+        must discard the partial result when the particle data or neighbor list changes before
+        computeForces() is called at the same \a timestep.
+    */
+    virtual void computeInteriorForces(uint64_t timestep) { }
 #endif
 
     //! Computes the forces
     virtual void compute(uint64_t timestep);
 
+    //! Computes the forces and adds them directly to the net force and virial
+    void computeIntoNetForce(uint64_t timestep);
+
+    //! Returns true if computeForces can add directly to the net force and virial
+    /*! Derived classes that support this must add to the particle data net force and net virial
+        (instead of overwriting m_force and m_virial) whenever m_accumulate_net_force is set.
+    */
+    virtual bool canAccumulateNetForce()
+        {
+        return false;
+        }
+
     //! Total the potential energy
     Scalar calcEnergySum();
 
@@ -237,6 +265,16 @@ class PYBIND11_EXPORT ForceCompute : public Compute
     // whether the local force buffers exposed by this class should be read-only
     bool m_buffers_writeable;
 
+    /// Set while computeForces should add to the net force and virial instead of m_force and
+    /// m_virial
+    bool m_accumulate_net_force;
+
+    /// Set when the last computation went to the net force and m_force and m_virial are stale
+    bool m_force_arrays_stale;
+
+    /// Clock used to measure the time spent in computeForces
+    ClockSource m_clk;
+
 #ifdef ENABLE_MPI
     /// Helper class to gather particle forces, energies, and virials
     GatherTagOrder m_gather_tag_order;
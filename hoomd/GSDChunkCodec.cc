@@ -0,0 +1,369 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "GSDChunkCodec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+/*! \file GSDChunkCodec.cc
+    \brief Defines the GSDChunkCodec class
+*/
+
+namespace hoomd
+    {
+namespace detail
+    {
+namespace
+    {
+/// Shortest match encoded by the LZ codec
+const size_t lz_min_match = 4;
+
+/// Longest backward distance to a match
+const size_t lz_max_offset = 65535;
+
+/// Number of bits in the match finder hash
+const unsigned int lz_hash_bits = 12;
+
+/// Append a length continuation to the output
+void writeLength(std::vector<uint8_t>& out, size_t length)
+    {
+    while (length >= 255)
+        {
+        out.push_back(255);
+        length -= 255;
+        }
+    out.push_back(uint8_t(length));
+    }
+
+/// Read a length continuation from the input
+size_t readLength(const uint8_t* in, size_t n, size_t& ip)
+    {
+    size_t length = 0;
+    uint8_t b;
+    do
+        {
+        if (ip >= n)
+            throw std::runtime_error("Corrupt compressed GSD chunk.");
+        b = in[ip++];
+        length += b;
+        } while (b == 255);
+    return length;
+    }
+
+/// Append one (literals, match) sequence to the output
+void writeSequence(std::vector<uint8_t>& out,
+                   const uint8_t* literals,
+                   size_t n_literals,
+                   size_t offset,
+                   size_t match_length)
+    {
+    size_t match_code = match_length - lz_min_match;
+    uint8_t token
+        = uint8_t((std::min<size_t>(n_literals, 15) << 4) | std::min<size_t>(match_code, 15));
+    out.push_back(token);
+    if (n_literals >= 15)
+        writeLength(out, n_literals - 15);
+    out.insert(out.end(), literals, literals + n_literals);
+
+    out.push_back(uint8_t(offset & 0xff));
+    out.push_back(uint8_t(offset >> 8));
+    if (match_code >= 15)
+        writeLength(out, match_code - 15);
+    }
+    } // end anonymous namespace
+
+/*! \param out Output buffer (resized to fit the compressed data)
+    \param in Bytes to compress
+    \param n Number of bytes to compress
+
+    Find matches with a single entry hash table indexed by the next 4 bytes, in the spirit of LZ4.
+*/
+void GSDChunkCodec::compress(std::vector<uint8_t>& out, const uint8_t* in, size_t n)
+    {
+    out.clear();
+    out.reserve(n + n / 255 + 16);
+
+    // table of the last position (plus 1) where each hash was seen, 0 when empty
+    std::vector<size_t> table(size_t(1) << lz_hash_bits, 0);
+
+    size_t anchor = 0;
+    size_t i = 0;
+    while (n >= lz_min_match && i <= n - lz_min_match)
+        {
+        uint32_t v;
+        memcpy(&v, in + i, sizeof(v));
+        uint32_t h = (v * 2654435761u) >> (32 - lz_hash_bits);
+        size_t candidate = table[h];
+        table[h] = i + 1;
+
+        if (candidate == 0 || i + 1 - candidate > lz_max_offset
+            || memcmp(in + candidate - 1, in + i, lz_min_match) != 0)
+            {
+            i++;
+            continue;
+            }
+
+        size_t match = candidate - 1;
+        size_t length = lz_min_match;
+        while (i + length < n && in[match + length] == in[i + length])
+            length++;
+
+        writeSequence(out, in + anchor, i - anchor, i - match, length);
+        i += length;
+        anchor = i;
+        }
+
+    // the last sequence holds the remaining literals and no match
+    size_t n_literals = n - anchor;
+    out.push_back(uint8_t(std::min<size_t>(n_literals, 15) << 4));
+    if (n_literals >= 15)
+        writeLength(out, n_literals - 15);
+    out.insert(out.end(), in + anchor, in + n);
+    }
+
+/*! \param out Output buffer
+    \param out_size Expected number of decompressed bytes
+    \param in Compressed bytes
+    \param n Number of compressed bytes
+
+    Throws std::runtime_error when the compressed data is corrupt or does not decompress to exactly
+    \a out_size bytes.
+*/
+void GSDChunkCodec::decompress(uint8_t* out, size_t out_size, const uint8_t* in, size_t n)
+    {
+    size_t ip = 0;
+    size_t op = 0;
+    while (ip < n)
+        {
+        uint8_t token = in[ip++];
+
+        size_t n_literals = token >> 4;
+        if (n_literals == 15)
+            n_literals += readLength(in, n, ip);
+        if (n_literals > n - ip || n_literals > out_size - op)
+            throw std::runtime_error("Corrupt compressed GSD chunk.");
+        std::copy(in + ip, in + ip + n_literals, out + op);
+        ip += n_literals;
+        op += n_literals;
+
+        // the last sequence has no match
+        if (ip == n)
+            break;
+
+        if (n - ip < 2)
+            throw std::runtime_error("Corrupt compressed GSD chunk.");
+        size_t offset = size_t(in[ip]) | (size_t(in[ip + 1]) << 8);
+        ip += 2;
+
+        size_t length = (token & 0xf) + lz_min_match;
+        if ((token & 0xf) == 15)
+            length += readLength(in, n, ip);
+        if (offset == 0 || offset > op || length > out_size - op)
+            throw std::runtime_error("Corrupt compressed GSD chunk.");
+
+        // matches may overlap the output, copy one byte at a time
+        for (size_t k = 0; k < length; k++, op++)
+            out[op] = out[op - offset];
+        }
+
+    if (op != out_size)
+        throw std::runtime_error("Corrupt compressed GSD chunk.");
+    }
+
+/*! \param out Output buffer (resized to fit the encoded chunk)
+    \param type Type of the data
+    \param N Number of rows
+    \param M Number of columns
+    \param data Data to encode (N*M values of \a type)
+    \param quantize_bits Quantize float data to this many bits per value (0 for lossless)
+*/
+void GSDChunkCodec::encode(std::vector<char>& out,
+                           gsd_type type,
+                           uint64_t N,
+                           uint32_t M,
+                           const void* data,
+                           unsigned int quantize_bits)
+    {
+    if (type != GSD_TYPE_FLOAT || quantize_bits > 32)
+        quantize_bits = 0;
+
+    Header header;
+    memcpy(header.magic, "HGC1", 4);
+    header.type = uint8_t(type);
+    header.quantize_bits = uint8_t(quantize_bits);
+    header.element_size = uint8_t(quantize_bits ? sizeof(uint32_t) : gsd_sizeof_type(type));
+    header.M = M;
+    header.reserved = 0;
+    header.N = N;
+
+    const size_t n_values = N * M;
+    const uint8_t* values = static_cast<const uint8_t*>(data);
+
+    // quantize float values relative to the range of each column
+    std::vector<double> quantization;
+    std::vector<uint32_t> quantized;
+    if (quantize_bits)
+        {
+        const float* f = static_cast<const float*>(data);
+        quantization.resize(2 * M);
+        quantized.resize(n_values);
+        const double levels = std::ldexp(1.0, int(quantize_bits)) - 1.0;
+        for (uint32_t c = 0; c < M; c++)
+            {
+            double lower = 0, upper = 0;
+            if (N > 0)
+                {
+                lower = upper = f[c];
+                for (uint64_t i = 1; i < N; i++)
+                    {
+                    lower = std::min(lower, double(f[i * M + c]));
+                    upper = std::max(upper, double(f[i * M + c]));
+                    }
+                }
+            double scale = (upper - lower) / levels;
+            quantization[2 * c] = lower;
+            quantization[2 * c + 1] = scale;
+
+            for (uint64_t i = 0; i < N; i++)
+                {
+                double q = scale > 0 ? std::round((double(f[i * M + c]) - lower) / scale) : 0.0;
+                quantized[i * M + c] = uint32_t(std::min(q, levels));
+                }
+            }
+        values = reinterpret_cast<const uint8_t*>(quantized.data());
+        }
+
+    // shuffle the bytes of each element
+    const size_t element_size = header.element_size;
+    const size_t n_bytes = n_values * element_size;
+    std::vector<uint8_t> shuffled(n_bytes);
+    for (size_t b = 0; b < element_size; b++)
+        {
+        for (size_t i = 0; i < n_values; i++)
+            shuffled[b * n_values + i] = values[i * element_size + b];
+        }
+
+    std::vector<uint8_t> compressed;
+    compress(compressed, shuffled.data(), n_bytes);
+
+    const std::vector<uint8_t>* payload = &compressed;
+    header.codec = 1;
+    if (compressed.size() >= n_bytes)
+        {
+        payload = &shuffled;
+        header.codec = 0;
+        }
+
+    const size_t quantization_size = quantization.size() * sizeof(double);
+    out.resize(sizeof(Header) + quantization_size + payload->size());
+    memcpy(out.data(), &header, sizeof(Header));
+    if (quantization_size > 0)
+        memcpy(out.data() + sizeof(Header), quantization.data(), quantization_size);
+    if (payload->size() > 0)
+        memcpy(out.data() + sizeof(Header) + quantization_size, payload->data(), payload->size());
+    }
+
+/*! \param in Encoded chunk
+    \returns The header of the encoded chunk
+
+    Throws std::runtime_error when the type, element size, or quantization in the header are not
+    ones that encode() writes.
+*/
+GSDChunkCodec::Header GSDChunkCodec::readHeader(const std::vector<char>& in)
+    {
+    Header header;
+    if (in.size() < sizeof(Header))
+        throw std::runtime_error("Corrupt compressed GSD chunk.");
+    memcpy(&header, in.data(), sizeof(Header));
+    if (memcmp(header.magic, "HGC1", 4) != 0)
+        throw std::runtime_error("Unknown compressed GSD chunk encoding.");
+
+    // decode() sizes its buffers with element_size, it must match the type
+    const size_t type_size = gsd_sizeof_type(gsd_type(header.type));
+    if (type_size == 0)
+        throw std::runtime_error("Compressed GSD chunk has an unknown type.");
+    if (header.quantize_bits > 32 || (header.quantize_bits && header.type != GSD_TYPE_FLOAT))
+        throw std::runtime_error("Corrupt compressed GSD chunk.");
+    if (header.element_size != (header.quantize_bits ? sizeof(uint32_t) : type_size))
+        throw std::runtime_error("Corrupt compressed GSD chunk.");
+    return header;
+    }
+
+/*! \param out Output buffer
+    \param out_size Size of the output buffer, must match the size of the original data
+    \param in Encoded chunk
+*/
+void GSDChunkCodec::decode(void* out, size_t out_size, const std::vector<char>& in)
+    {
+    Header header = readHeader(in);
+
+    const size_t type_size = gsd_sizeof_type(gsd_type(header.type));
+    if (header.M != 0 && header.N > std::numeric_limits<size_t>::max() / header.M / type_size)
+        throw std::runtime_error("Compressed GSD chunk has an unexpected size.");
+
+    // readHeader() checked that element_size is at most type_size, so n_bytes <= out_size
+    const size_t n_values = header.N * header.M;
+    const size_t element_size = header.element_size;
+    if (n_values * type_size != out_size)
+        throw std::runtime_error("Compressed GSD chunk has an unexpected size.");
+
+    const size_t quantization_size
+        = header.quantize_bits ? 2 * size_t(header.M) * sizeof(double) : 0;
+    if (in.size() < sizeof(Header) + quantization_size)
+        throw std::runtime_error("Corrupt compressed GSD chunk.");
+    const uint8_t* payload
+        = reinterpret_cast<const uint8_t*>(in.data()) + sizeof(Header) + quantization_size;
+    const size_t payload_size = in.size() - sizeof(Header) - quantization_size;
+
+    const size_t n_bytes = n_values * element_size;
+    std::vector<uint8_t> shuffled(n_bytes);
+    if (header.codec == 1)
+        {
+        decompress(shuffled.data(), n_bytes, payload, payload_size);
+        }
+    else if (header.codec == 0 && payload_size == n_bytes)
+        {
+        std::copy(payload, payload + n_bytes, shuffled.begin());
+        }
+    else
+        {
+        throw std::runtime_error("Corrupt compressed GSD chunk.");
+        }
+
+    // unshuffle directly into the output unless the values are quantized
+    std::vector<uint8_t> quantized;
+    uint8_t* values = static_cast<uint8_t*>(out);
+    if (header.quantize_bits)
+        {
+        quantized.resize(n_bytes);
+        values = quantized.data();
+        }
+
+    for (size_t b = 0; b < element_size; b++)
+        {
+        for (size_t i = 0; i < n_values; i++)
+            values[i * element_size + b] = shuffled[b * n_values + i];
+        }
+
+    if (header.quantize_bits)
+        {
+        std::vector<double> quantization(2 * size_t(header.M));
+        memcpy(quantization.data(), in.data() + sizeof(Header), quantization_size);
+
+        const uint32_t* q = reinterpret_cast<const uint32_t*>(quantized.data());
+        float* f = static_cast<float*>(out);
+        for (size_t i = 0; i < n_values; i++)
+            {
+            size_t c = i % header.M;
+            f[i] = float(quantization[2 * c] + double(q[i]) * quantization[2 * c + 1]);
+            }
+        }
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
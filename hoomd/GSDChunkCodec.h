@@ -0,0 +1,95 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/extern/gsd.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*! \file GSDChunkCodec.h
+    \brief Declares the GSDChunkCodec class
+*/
+
+namespace hoomd
+    {
+namespace detail
+    {
+/// Encode and decode compressed GSD data chunks.
+/** GSDDumpWriter stores an encoded chunk as a GSD_TYPE_UINT8 array under the name
+    encodedName(name). The encoded bytes begin with a Header that records the type and shape of the
+    original data. When the chunk is quantized, M pairs of doubles (origin, scale) follow the
+    header, one for each column. The compressed payload follows.
+
+    Encoding applies these steps:
+
+    1. Quantize (optional, float data only): Replace each value x in column c by the unsigned 32-bit
+       integer round((x - origin_c) / scale_c), where origin_c is the minimum of the column and
+       scale_c = (maximum - minimum) / (2^bits - 1). decode() computes origin_c + q * scale_c in
+       double precision and rounds the result to float, so the absolute error is at most
+       scale_c / 2 plus half a float ulp of the decoded value.
+    2. Shuffle: Group byte b of every element together, so that the slowly varying sign and
+       exponent bytes of neighboring values form long runs.
+    3. Compress: LZ77 with a 64 KiB window. The payload is a sequence of (literals, match)
+       pairs. Each starts with a token byte holding the literal count in the high nibble and the
+       match length minus 4 in the low nibble. A nibble of 15 continues the count in the following
+       bytes (each adds up to 255; a byte less than 255 ends the count). The literal bytes follow,
+       then the 16-bit little endian match offset and the match length continuation. The last
+       sequence has no match. When compression does not reduce the size, the shuffled bytes are
+       stored instead.
+*/
+class GSDChunkCodec
+    {
+    public:
+    /// Header stored at the start of every encoded chunk.
+    struct Header
+        {
+        char magic[4];         //!< Identifies the encoding ("HGC1")
+        uint8_t type;          //!< gsd_type of the original data
+        uint8_t codec;         //!< 0: shuffled bytes, 1: LZ compressed shuffled bytes
+        uint8_t quantize_bits; //!< Bits per quantized value, 0 when not quantized
+        uint8_t element_size;  //!< Size of the shuffled elements in bytes
+        uint32_t M;            //!< Number of columns in the original data
+        uint32_t reserved;     //!< Unused, set to 0
+        uint64_t N;            //!< Number of rows in the original data
+        };
+
+    /// Schema name of files that may contain encoded chunks.
+    /** Readers of the "hoomd" schema do not know the encoded chunks and would silently use default
+        values in their place. Files written with compression use this schema name instead, so that
+        such readers refuse to open them.
+    */
+    static constexpr const char* schema = "hoomd-compressed";
+
+    /// Get the name of the chunk that stores the encoded form of chunk \a name.
+    static std::string encodedName(const std::string& name)
+        {
+        return "compressed/" + name;
+        }
+
+    /// Encode a data chunk.
+    static void encode(std::vector<char>& out,
+                       gsd_type type,
+                       uint64_t N,
+                       uint32_t M,
+                       const void* data,
+                       unsigned int quantize_bits = 0);
+
+    /// Read the header of an encoded chunk.
+    static Header readHeader(const std::vector<char>& in);
+
+    /// Decode a data chunk.
+    static void decode(void* out, size_t out_size, const std::vector<char>& in);
+
+    /// Compress bytes with the LZ77 codec.
+    static void compress(std::vector<uint8_t>& out, const uint8_t* in, size_t n);
+
+    /// Decompress bytes compressed with compress().
+    static void decompress(uint8_t* out, size_t out_size, const uint8_t* in, size_t n);
+    };
+
+    } // end namespace detail
+
+    } // end namespace hoomd
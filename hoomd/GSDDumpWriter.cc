@@ -4,6 +4,7 @@
 #include "GSDDumpWriter.h"
 #include "Filesystem.h"
 #include "GSD.h"
+#include "GSDChunkCodec.h"
 #include "HOOMDVersion.h"
 
 #ifdef ENABLE_MPI
@@ -13,6 +14,8 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl_bind.h>
 
+#include <cerrno>
+#include <chrono>
 #include <limits>
 #include <list>
 #include <sstream>
@@ -44,6 +47,9 @@ std::list<std::string> GSDDumpWriter::particle_chunks {"particles/position",
     \param mode File open mode ("wb", "xb", or "ab")
     \param truncate If true, truncate the file to 0 frames every time analyze() called, then write
    out one frame
+    \param compression If true, compress data chunks
+    \param quantize_position_bits Number of bits per quantized position coordinate (0 to store
+   exact positions)
 
     If the group does not include all particles, then topology information cannot be written to the
    file.
@@ -53,8 +59,11 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
                              const std::string& fname,
                              std::shared_ptr<ParticleGroup> group,
                              std::string mode,
-                             bool truncate)
-    : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_truncate(truncate), m_group(group)
+                             bool truncate,
+                             bool compression,
+                             unsigned int quantize_position_bits)
+    : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_truncate(truncate), m_group(group),
+      m_compression(compression), m_quantize_position_bits(quantize_position_bits)
     {
     m_exec_conf->msg->notice(5) << "Constructing GSDDumpWriter: " << m_fname << " " << mode << " "
                                 << truncate << endl;
@@ -62,6 +71,10 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
         {
         throw std::invalid_argument("Invalid GSD file mode: " + mode);
         }
+    if (quantize_position_bits > 32)
+        {
+        throw std::invalid_argument("quantize_position_bits must be between 0 and 32.");
+        }
     m_log_writer = pybind11::none();
 
 #ifdef ENABLE_MPI
@@ -222,16 +235,65 @@ void GSDDumpWriter::flush()
     {
     if (m_exec_conf->isRoot())
         {
+        waitForQueuedFrames();
+
         m_exec_conf->msg->notice(5) << "GSD: flush gsd file " << m_fname << endl;
         int retval = gsd_flush(&m_handle);
         GSDUtils::checkError(retval, m_fname);
         }
     }
 
+/*! \returns The total size of the data chunks divided by the number of bytes written to store
+    them, or 1 when no chunks have been written.
+*/
+double GSDDumpWriter::getCompressionRatio()
+    {
+    double ratio = 1.0;
+    if (m_exec_conf->isRoot() && m_bytes_out > 0)
+        {
+        ratio = double(m_bytes_in) / double(m_bytes_out);
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        bcast(ratio, 0, m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return ratio;
+    }
+
+/*! \returns The total size of the data chunks divided by the time spent encoding them and passing
+    them to the GSD library (in bytes per second), or 0 when no chunks have been written.
+
+    The GSD library buffers writes, so the time includes the file writes only when the buffer
+    fills. Call flush() before to include the remaining buffered writes.
+*/
+double GSDDumpWriter::getWriteThroughput()
+    {
+    double throughput = 0.0;
+    if (m_exec_conf->isRoot() && m_write_time > 0)
+        {
+        throughput = double(m_bytes_in) / (double(m_write_time) * 1e-9);
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        bcast(throughput, 0, m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return throughput;
+    }
+
 void GSDDumpWriter::setMaximumWriteBufferSize(uint64_t size)
     {
     if (m_exec_conf->isRoot())
         {
+        waitForQueuedFrames();
+
         int retval = gsd_set_maximum_write_buffer_size(&m_handle, size);
         GSDUtils::checkError(retval, m_fname);
 
@@ -245,6 +307,7 @@ uint64_t GSDDumpWriter::getMaximumWriteBufferSize()
     {
     if (m_exec_conf->isRoot())
         {
+        waitForQueuedFrames();
         return gsd_get_maximum_write_buffer_size(&m_handle);
         }
     else
@@ -264,11 +327,15 @@ void GSDDumpWriter::initFileIO()
             ostringstream o;
             o << "HOOMD-blue " << HOOMD_VERSION;
 
+            // readers of the hoomd schema would not find the compressed chunks
+            const char* schema
+                = (m_compression || m_quantize_position_bits) ? GSDChunkCodec::schema : "hoomd";
+
             m_exec_conf->msg->notice(3) << "GSD: create or overwrite gsd file " << m_fname << endl;
             int retval = gsd_create_and_open(&m_handle,
                                              m_fname.c_str(),
                                              o.str().c_str(),
-                                             "hoomd",
+                                             schema,
                                              gsd_make_version(1, 4),
                                              GSD_OPEN_APPEND,
                                              m_mode == "xb");
@@ -291,7 +358,8 @@ void GSDDumpWriter::initFileIO()
             GSDUtils::checkError(retval, m_fname);
 
             // validate schema
-            if (string(m_handle.header.schema) != string("hoomd"))
+            if (string(m_handle.header.schema) != string("hoomd")
+                && string(m_handle.header.schema) != string(GSDChunkCodec::schema))
                 {
                 std::ostringstream s;
                 s << "GSD: "
@@ -305,6 +373,14 @@ void GSDDumpWriter::initFileIO()
                   << "Invalid schema version in " << m_fname;
                 throw runtime_error("Error opening GSD file");
                 }
+            if ((m_compression || m_quantize_position_bits)
+                && string(m_handle.header.schema) != string(GSDChunkCodec::schema))
+                {
+                std::ostringstream s;
+                s << "GSD: Cannot append compressed frames to " << m_fname
+                  << ", which was written without compression.";
+                throw runtime_error(s.str());
+                }
             }
         else
             {
@@ -329,9 +405,297 @@ GSDDumpWriter::~GSDDumpWriter()
 
     if (m_exec_conf->isRoot())
         {
+        stopWriteThread();
+
+        // destructors must not throw, report errors from the background thread and gsd_close
+        int retval = m_write_error;
+        int write_errno = m_write_errno;
+
         m_exec_conf->msg->notice(5) << "GSD: close gsd file " << m_fname << endl;
-        gsd_close(&m_handle);
+        int close_retval = gsd_close(&m_handle);
+        if (retval == GSD_SUCCESS)
+            {
+            retval = close_retval;
+            write_errno = errno;
+            }
+
+        if (retval != GSD_SUCCESS)
+            {
+            try
+                {
+                errno = write_errno;
+                GSDUtils::checkError(retval, m_fname);
+                }
+            catch (const std::exception& e)
+                {
+                m_exec_conf->msg->error()
+                    << e.what() << ", frames written in the background may be lost." << endl;
+                }
+            }
+        }
+    }
+
+/*! \param async_write Set to true to write frames in a background thread
+
+    Disabling asynchronous writes waits for the background thread to write all queued frames.
+*/
+void GSDDumpWriter::setAsyncWrite(bool async_write)
+    {
+    if (m_async_write && !async_write && m_exec_conf->isRoot())
+        {
+        stopWriteThread();
+
+        if (m_write_error != GSD_SUCCESS)
+            {
+            int retval = m_write_error;
+            m_write_error = GSD_SUCCESS;
+            errno = m_write_errno;
+            GSDUtils::checkError(retval, m_fname);
+            }
+        }
+
+    m_async_write = async_write;
+    }
+
+/*! \param name Name of the chunk
+    \param type Type of the data
+    \param N Number of rows
+    \param M Number of columns
+    \param data Data to write (N*M values of \a type)
+
+    \returns The GSD error code. Errors in the background thread are reported later.
+*/
+int GSDDumpWriter::writeChunk(const char* name,
+                              gsd_type type,
+                              uint64_t N,
+                              uint32_t M,
+                              const void* data)
+    {
+    if (!m_async_write)
+        {
+        return writeChunkToFile(name, type, N, M, data);
+        }
+
+    if (m_current_frame.n_chunks == m_current_frame.chunks.size())
+        {
+        m_current_frame.chunks.emplace_back();
+        }
+
+    QueuedChunk& chunk = m_current_frame.chunks[m_current_frame.n_chunks];
+    m_current_frame.n_chunks++;
+
+    size_t size = N * M * gsd_sizeof_type(type);
+    chunk.name = name;
+    chunk.type = type;
+    chunk.N = N;
+    chunk.M = M;
+    chunk.data.resize(size);
+    if (size > 0)
+        {
+        memcpy(chunk.data.data(), data, size);
+        }
+
+    return GSD_SUCCESS;
+    }
+
+/*! \param name Name of the chunk
+    \param type Type of the data
+    \param N Number of rows
+    \param M Number of columns
+    \param data Data to write (N*M values of \a type)
+
+    Compress numeric chunks when requested and write the chunk to the file. Chunks of uint8 values
+    (strings and type names) are always written as is.
+
+    \returns The GSD error code.
+*/
+int GSDDumpWriter::writeChunkToFile(const char* name,
+                                    gsd_type type,
+                                    uint64_t N,
+                                    uint32_t M,
+                                    const void* data)
+    {
+    auto start = std::chrono::steady_clock::now();
+
+    uint64_t size = N * M * gsd_sizeof_type(type);
+    bool quantize = m_quantize_position_bits > 0 && strcmp(name, "particles/position") == 0;
+    bool compress = (m_compression && type != GSD_TYPE_UINT8 && size >= min_compressed_chunk_size)
+                    || quantize;
+
+    int retval;
+    uint64_t bytes_out = size;
+    if (compress)
+        {
+        GSDChunkCodec::encode(m_encode_buffer,
+                              type,
+                              N,
+                              M,
+                              data,
+                              quantize ? m_quantize_position_bits : 0);
+        bytes_out = m_encode_buffer.size();
+        retval = gsd_write_chunk(&m_handle,
+                                 GSDChunkCodec::encodedName(name).c_str(),
+                                 GSD_TYPE_UINT8,
+                                 m_encode_buffer.size(),
+                                 1,
+                                 0,
+                                 m_encode_buffer.data());
+        }
+    else
+        {
+        retval = gsd_write_chunk(&m_handle, name, type, N, M, 0, data);
+        }
+
+    m_bytes_in += size;
+    m_bytes_out += bytes_out;
+    m_write_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+
+    return retval;
+    }
+
+/*! Queue the current frame for the background thread, waiting while max_queued_frames frames are
+    already in the queue.
+
+    \returns The GSD error code.
+*/
+int GSDDumpWriter::endFrame()
+    {
+    if (!m_async_write)
+        {
+        return gsd_end_frame(&m_handle);
+        }
+
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+
+    if (!m_write_thread.joinable())
+        {
+        m_stop_write_thread = false;
+        m_write_thread = std::thread(&GSDDumpWriter::writeQueuedFrames, this);
+        }
+
+    m_write_cv.wait(lock,
+                    [this]
+                    {
+                        return m_queued_frames.size() < max_queued_frames
+                               || m_write_error != GSD_SUCCESS;
+                    });
+
+    if (m_write_error != GSD_SUCCESS)
+        {
+        int retval = m_write_error;
+        m_write_error = GSD_SUCCESS;
+        errno = m_write_errno;
+        m_current_frame.n_chunks = 0;
+        return retval;
+        }
+
+    m_queued_frames.push_back(std::move(m_current_frame));
+    m_write_cv.notify_all();
+
+    // reuse the memory of a written frame for the next one
+    if (m_free_frames.empty())
+        {
+        m_current_frame = QueuedFrame();
+        }
+    else
+        {
+        m_current_frame = std::move(m_free_frames.back());
+        m_free_frames.pop_back();
+        }
+    m_current_frame.n_chunks = 0;
+
+    return GSD_SUCCESS;
+    }
+
+/*! Throws an exception when the background thread failed to write a frame.
+ */
+void GSDDumpWriter::waitForQueuedFrames()
+    {
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+    m_write_cv.wait(lock,
+                    [this]
+                    {
+                        return (m_queued_frames.empty() && !m_write_busy)
+                               || m_write_error != GSD_SUCCESS;
+                    });
+
+    if (m_write_error != GSD_SUCCESS)
+        {
+        int retval = m_write_error;
+        m_write_error = GSD_SUCCESS;
+        errno = m_write_errno;
+        lock.unlock();
+        GSDUtils::checkError(retval, m_fname);
+        }
+    }
+
+/*! Write the queued frames in order until stopWriteThread() is called. After an error, discard the
+    queued frames and record the error for the simulation thread to report.
+*/
+void GSDDumpWriter::writeQueuedFrames()
+    {
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+
+    while (true)
+        {
+        m_write_cv.wait(lock, [this] { return !m_queued_frames.empty() || m_stop_write_thread; });
+
+        if (m_queued_frames.empty())
+            {
+            return;
+            }
+
+        QueuedFrame frame = std::move(m_queued_frames.front());
+        m_queued_frames.pop_front();
+        m_write_busy = true;
+        lock.unlock();
+
+        int retval = GSD_SUCCESS;
+        for (size_t i = 0; i < frame.n_chunks && retval == GSD_SUCCESS; i++)
+            {
+            const QueuedChunk& chunk = frame.chunks[i];
+            retval = writeChunkToFile(chunk.name.c_str(),
+                                      chunk.type,
+                                      chunk.N,
+                                      chunk.M,
+                                      chunk.data.data());
+            }
+        if (retval == GSD_SUCCESS)
+            {
+            retval = gsd_end_frame(&m_handle);
+            }
+        int write_errno = errno;
+
+        lock.lock();
+        m_write_busy = false;
+        if (retval != GSD_SUCCESS)
+            {
+            m_write_error = retval;
+            m_write_errno = write_errno;
+            m_queued_frames.clear();
+            }
+        m_free_frames.push_back(std::move(frame));
+        m_write_cv.notify_all();
+        }
+    }
+
+/*! Errors are left in m_write_error for the caller to report.
+ */
+void GSDDumpWriter::stopWriteThread()
+    {
+    if (!m_write_thread.joinable())
+        {
+        return;
+        }
+
+        {
+        std::lock_guard<std::mutex> lock(m_write_mutex);
+        m_stop_write_thread = true;
         }
+    m_write_cv.notify_all();
+    m_write_thread.join();
     }
 
 //! Get the logged data for the current frame if any.
@@ -360,6 +724,8 @@ void GSDDumpWriter::analyze(uint64_t timestep)
         {
         if (m_exec_conf->isRoot())
             {
+            waitForQueuedFrames();
+
             m_exec_conf->msg->notice(10) << "GSD: truncating file" << endl;
             retval = gsd_truncate(&m_handle);
             GSDUtils::checkError(retval, m_fname);
@@ -376,8 +742,31 @@ void GSDDumpWriter::analyze(uint64_t timestep)
 void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_data)
     {
 #ifdef ENABLE_MPI
-    if (m_sysdef->isDomainDecomposed())
+    if (m_sysdef->isDomainDecomposed() && !m_async_write && !m_compression
+        && m_quantize_position_bits == 0)
         {
+        // Stream the per-particle chunks to the file one rank's range of tags at a time. All
+        // ranks take part in writing them.
+        m_gather_tag_order.setLocalTagsSorted(frame.particle_tags);
+        m_stream_particle_data = true;
+
+        if (m_exec_conf->isRoot())
+            {
+            writeFrameHeader(frame);
+            }
+        writeAttributes(frame);
+        writeProperties(frame);
+        writeMomenta(frame);
+        m_stream_particle_data = false;
+
+        if (m_exec_conf->isRoot())
+            {
+            writeLogQuantities(log_data);
+            }
+        }
+    else if (m_sysdef->isDomainDecomposed())
+        {
+        // Queued and compressed chunks need the whole array.
         gatherGlobalFrame(frame);
 
         if (m_exec_conf->isRoot())
@@ -416,7 +805,7 @@ void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_dat
     if (m_exec_conf->isRoot())
         {
         m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
-        int retval = gsd_end_frame(&m_handle);
+        int retval = endFrame();
         GSDUtils::checkError(retval, m_fname);
         }
 
@@ -437,13 +826,11 @@ void GSDDumpWriter::writeTypeMapping(std::string chunk, std::vector<std::string>
         std::vector<char> types(max_len * type_mapping.size());
         for (unsigned int i = 0; i < type_mapping.size(); i++)
             strncpy(&types[max_len * i], type_mapping[i].c_str(), max_len);
-        int retval = gsd_write_chunk(&m_handle,
-                                     chunk.c_str(),
-                                     GSD_TYPE_UINT8,
-                                     type_mapping.size(),
-                                     max_len,
-                                     0,
-                                     (void*)&types[0]);
+        int retval = writeChunk(chunk.c_str(),
+                                GSD_TYPE_UINT8,
+                                type_mapping.size(),
+                                max_len,
+                                (void*)&types[0]);
         GSDUtils::checkError(retval, m_fname);
         }
     }
@@ -455,26 +842,14 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
     {
     int retval;
     m_exec_conf->msg->notice(10) << "GSD: writing configuration/step" << endl;
-    retval = gsd_write_chunk(&m_handle,
-                             "configuration/step",
-                             GSD_TYPE_UINT64,
-                             1,
-                             1,
-                             0,
-                             (void*)&frame.timestep);
+    retval = writeChunk("configuration/step", GSD_TYPE_UINT64, 1, 1, (void*)&frame.timestep);
     GSDUtils::checkError(retval, m_fname);
 
     if (m_nframes == 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/dimensions" << endl;
         uint8_t dimensions = (uint8_t)m_sysdef->getNDimensions();
-        retval = gsd_write_chunk(&m_handle,
-                                 "configuration/dimensions",
-                                 GSD_TYPE_UINT8,
-                                 1,
-                                 1,
-                                 0,
-                                 (void*)&dimensions);
+        retval = writeChunk("configuration/dimensions", GSD_TYPE_UINT8, 1, 1, (void*)&dimensions);
         GSDUtils::checkError(retval, m_fname);
         }
 
@@ -488,13 +863,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         box_a[3] = (float)frame.global_box.getTiltFactorXY();
         box_a[4] = (float)frame.global_box.getTiltFactorXZ();
         box_a[5] = (float)frame.global_box.getTiltFactorYZ();
-        retval = gsd_write_chunk(&m_handle,
-                                 "configuration/box",
-                                 GSD_TYPE_FLOAT,
-                                 6,
-                                 1,
-                                 0,
-                                 (void*)box_a);
+        retval = writeChunk("configuration/box", GSD_TYPE_FLOAT, 6, 1, (void*)box_a);
         GSDUtils::checkError(retval, m_fname);
         }
 
@@ -502,125 +871,159 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing particles/N" << endl;
         uint32_t N = m_group->getNumMembersGlobal();
-        retval = gsd_write_chunk(&m_handle, "particles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
+        retval = writeChunk("particles/N", GSD_TYPE_UINT32, 1, 1, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
         }
     }
 
+/*! \param frame Frame to write
+    \param flag Flag of the per-particle quantity
+    \param data Values of the quantity in \a frame
+
+    When streaming, \a frame is a local frame and some ranks may have no particles: use the flags
+    that populateLocalFrame() made consistent over all ranks.
+*/
+template<class T>
+bool GSDDumpWriter::hasParticleData(const GSDFrame& frame,
+                                    unsigned int flag,
+                                    const std::vector<T>& data) const
+    {
+#ifdef ENABLE_MPI
+    if (m_stream_particle_data)
+        {
+        return frame.particle_data_present[flag];
+        }
+#endif
+    return data.size() != 0;
+    }
+
+/*! \param name Name of the chunk
+    \param type Type of the data
+    \param M Number of columns
+    \param data Values of all particles in the group (the local particles when streaming)
+
+    When streaming, all ranks call writeParticleChunk(). The root reserves space for the chunk in
+    the file and writes the values of each rank's range of tags as it receives them. Otherwise,
+    only the root calls writeParticleChunk().
+*/
+template<class T>
+void GSDDumpWriter::writeParticleChunk(const char* name,
+                                       gsd_type type,
+                                       uint32_t M,
+                                       const std::vector<T>& data)
+    {
+    uint32_t N = m_group->getNumMembersGlobal();
+    assert(sizeof(T) == M * gsd_sizeof_type(type));
+
+#ifdef ENABLE_MPI
+    if (m_stream_particle_data)
+        {
+        auto start = std::chrono::steady_clock::now();
+
+        int retval = GSD_SUCCESS;
+        uint64_t location = 0;
+        if (m_exec_conf->isRoot())
+            {
+            retval = gsd_reserve_chunk(&m_handle, name, type, N, M, 0, &location);
+            }
+
+        // Errors are reported after all ranks have sent their values.
+        m_gather_tag_order.gatherArrayInPieces(
+            data,
+            [&](const T* piece, int n)
+            {
+                if (retval == GSD_SUCCESS)
+                    {
+                    retval = gsd_write_reserved_chunk_data(&m_handle,
+                                                           location,
+                                                           piece,
+                                                           sizeof(T) * n);
+                    location += sizeof(T) * n;
+                    }
+            });
+
+        if (m_exec_conf->isRoot())
+            {
+            uint64_t size = uint64_t(N) * sizeof(T);
+            m_bytes_in += size;
+            m_bytes_out += size;
+            m_write_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+            GSDUtils::checkError(retval, m_fname);
+            }
+        return;
+        }
+#endif
+
+    assert(data.size() == N);
+    int retval = writeChunk(name, type, N, M, (void*)data.data());
+    GSDUtils::checkError(retval, m_fname);
+    }
+
 /*! Writes the data chunks types, typeid, mass, charge, diameter, body, moment_inertia in
    particles/.
 */
 void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
-    int retval;
-
-    if (m_dynamic[gsd_flag::particles_types] || m_nframes == 0)
+    if ((m_dynamic[gsd_flag::particles_types] || m_nframes == 0) && m_exec_conf->isRoot())
         {
         writeTypeMapping("particles/types", frame.particle_data.type_mapping);
         }
 
-    if (frame.particle_data.type.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_type, frame.particle_data.type))
         {
-        assert(frame.particle_data.type.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.type.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/typeid", GSD_TYPE_UINT32, 1, frame.particle_data.type);
         if (m_nframes == 0)
             m_nondefault["particles/typeid"] = true;
         }
 
-    if (frame.particle_data.mass.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_mass, frame.particle_data.mass))
         {
-        assert(frame.particle_data.mass.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/mass" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/mass",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.mass.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/mass", GSD_TYPE_FLOAT, 1, frame.particle_data.mass);
         if (m_nframes == 0)
             m_nondefault["particles/mass"] = true;
         }
 
-    if (frame.particle_data.charge.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_charge, frame.particle_data.charge))
         {
-        assert(frame.particle_data.charge.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/charge" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/charge",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.charge.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/charge", GSD_TYPE_FLOAT, 1, frame.particle_data.charge);
         if (m_nframes == 0)
             m_nondefault["particles/charge"] = true;
         }
 
     if (m_write_diameter)
         {
-        if (frame.particle_data.diameter.size() != 0)
+        if (hasParticleData(frame, gsd_flag::particles_diameter, frame.particle_data.diameter))
             {
-            assert(frame.particle_data.diameter.size() == N);
-
             m_exec_conf->msg->notice(10) << "GSD: writing particles/diameter" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/diameter",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)frame.particle_data.diameter.data());
-            GSDUtils::checkError(retval, m_fname);
+            writeParticleChunk("particles/diameter",
+                               GSD_TYPE_FLOAT,
+                               1,
+                               frame.particle_data.diameter);
             if (m_nframes == 0)
                 m_nondefault["particles/diameter"] = true;
             }
         }
 
-    if (frame.particle_data.body.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_body, frame.particle_data.body))
         {
-        assert(frame.particle_data.body.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/body" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/body",
-                                 GSD_TYPE_INT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.body.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/body", GSD_TYPE_INT32, 1, frame.particle_data.body);
         if (m_nframes == 0)
             m_nondefault["particles/body"] = true;
         }
 
-    if (frame.particle_data.inertia.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_inertia, frame.particle_data.inertia))
         {
-        assert(frame.particle_data.inertia.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/moment_inertia" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/moment_inertia",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.inertia.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/moment_inertia",
+                           GSD_TYPE_FLOAT,
+                           3,
+                           frame.particle_data.inertia);
         if (m_nframes == 0)
             m_nondefault["particles/moment_inertia"] = true;
         }
@@ -630,39 +1033,21 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
-    int retval;
-
-    if (frame.particle_data.pos.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_position, frame.particle_data.pos))
         {
-        assert(frame.particle_data.pos.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/position" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/position",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.pos.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/position", GSD_TYPE_FLOAT, 3, frame.particle_data.pos);
         if (m_nframes == 0)
             m_nondefault["particles/position"] = true;
         }
 
-    if (frame.particle_data.orientation.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_orientation, frame.particle_data.orientation))
         {
-        assert(frame.particle_data.orientation.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/orientation" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/orientation",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)frame.particle_data.orientation.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/orientation",
+                           GSD_TYPE_FLOAT,
+                           4,
+                           frame.particle_data.orientation);
         if (m_nframes == 0)
             m_nondefault["particles/orientation"] = true;
         }
@@ -672,56 +1057,26 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
-    int retval;
-
-    if (frame.particle_data.vel.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_velocity, frame.particle_data.vel))
         {
-        assert(frame.particle_data.vel.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/velocity" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/velocity",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.vel.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/velocity", GSD_TYPE_FLOAT, 3, frame.particle_data.vel);
         if (m_nframes == 0)
             m_nondefault["particles/velocity"] = true;
         }
 
-    if (frame.particle_data.angmom.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_angmom, frame.particle_data.angmom))
         {
-        assert(frame.particle_data.angmom.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/angmom" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/angmom",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)frame.particle_data.angmom.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/angmom", GSD_TYPE_FLOAT, 4, frame.particle_data.angmom);
         if (m_nframes == 0)
             m_nondefault["particles/angmom"] = true;
         }
 
-    if (frame.particle_data.image.size() != 0)
+    if (hasParticleData(frame, gsd_flag::particles_image, frame.particle_data.image))
         {
-        assert(frame.particle_data.image.size() == N);
-
         m_exec_conf->msg->notice(10) << "GSD: writing particles/image" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/image",
-                                 GSD_TYPE_INT32,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.image.data());
-        GSDUtils::checkError(retval, m_fname);
+        writeParticleChunk("particles/image", GSD_TYPE_INT32, 3, frame.particle_data.image);
         if (m_nframes == 0)
             m_nondefault["particles/image"] = true;
         }
@@ -747,116 +1102,68 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
         {
         m_exec_conf->msg->notice(10) << "GSD: writing bonds/N" << endl;
         uint32_t N = bond.size;
-        int retval = gsd_write_chunk(&m_handle, "bonds/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
+        int retval = writeChunk("bonds/N", GSD_TYPE_UINT32, 1, 1, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
 
         writeTypeMapping("bonds/types", bond.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing bonds/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "bonds/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&bond.type_id[0]);
+        retval = writeChunk("bonds/typeid", GSD_TYPE_UINT32, N, 1, (void*)&bond.type_id[0]);
         GSDUtils::checkError(retval, m_fname);
 
         m_exec_conf->msg->notice(10) << "GSD: writing bonds/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "bonds/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 2,
-                                 0,
-                                 (void*)&bond.groups[0]);
+        retval = writeChunk("bonds/group", GSD_TYPE_UINT32, N, 2, (void*)&bond.groups[0]);
         GSDUtils::checkError(retval, m_fname);
         }
     if (angle.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing angles/N" << endl;
         uint32_t N = angle.size;
-        int retval = gsd_write_chunk(&m_handle, "angles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
+        int retval = writeChunk("angles/N", GSD_TYPE_UINT32, 1, 1, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
 
         writeTypeMapping("angles/types", angle.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing angles/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "angles/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&angle.type_id[0]);
+        retval = writeChunk("angles/typeid", GSD_TYPE_UINT32, N, 1, (void*)&angle.type_id[0]);
         GSDUtils::checkError(retval, m_fname);
 
         m_exec_conf->msg->notice(10) << "GSD: writing angles/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "angles/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)&angle.groups[0]);
+        retval = writeChunk("angles/group", GSD_TYPE_UINT32, N, 3, (void*)&angle.groups[0]);
         GSDUtils::checkError(retval, m_fname);
         }
     if (dihedral.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing dihedrals/N" << endl;
         uint32_t N = dihedral.size;
-        int retval = gsd_write_chunk(&m_handle, "dihedrals/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
+        int retval = writeChunk("dihedrals/N", GSD_TYPE_UINT32, 1, 1, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
 
         writeTypeMapping("dihedrals/types", dihedral.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing dihedrals/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "dihedrals/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&dihedral.type_id[0]);
+        retval = writeChunk("dihedrals/typeid", GSD_TYPE_UINT32, N, 1, (void*)&dihedral.type_id[0]);
         GSDUtils::checkError(retval, m_fname);
 
         m_exec_conf->msg->notice(10) << "GSD: writing dihedrals/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "dihedrals/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)&dihedral.groups[0]);
+        retval = writeChunk("dihedrals/group", GSD_TYPE_UINT32, N, 4, (void*)&dihedral.groups[0]);
         GSDUtils::checkError(retval, m_fname);
         }
     if (improper.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing impropers/N" << endl;
         uint32_t N = improper.size;
-        int retval = gsd_write_chunk(&m_handle, "impropers/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
+        int retval = writeChunk("impropers/N", GSD_TYPE_UINT32, 1, 1, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
 
         writeTypeMapping("impropers/types", improper.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing impropers/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "impropers/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&improper.type_id[0]);
+        retval = writeChunk("impropers/typeid", GSD_TYPE_UINT32, N, 1, (void*)&improper.type_id[0]);
         GSDUtils::checkError(retval, m_fname);
 
         m_exec_conf->msg->notice(10) << "GSD: writing impropers/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "impropers/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)&improper.groups[0]);
+        retval = writeChunk("impropers/group", GSD_TYPE_UINT32, N, 4, (void*)&improper.groups[0]);
         GSDUtils::checkError(retval, m_fname);
         }
 
@@ -864,8 +1171,7 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
         {
         m_exec_conf->msg->notice(10) << "GSD: writing constraints/N" << endl;
         uint32_t N = constraint.size;
-        int retval
-            = gsd_write_chunk(&m_handle, "constraints/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
+        int retval = writeChunk("constraints/N", GSD_TYPE_UINT32, 1, 1, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
 
         m_exec_conf->msg->notice(10) << "GSD: writing constraints/value" << endl;
@@ -875,24 +1181,16 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
             for (unsigned int i = 0; i < N; i++)
                 data[i] = float(constraint.val[i]);
 
-            retval = gsd_write_chunk(&m_handle,
-                                     "constraints/value",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)&data[0]);
+            retval = writeChunk("constraints/value", GSD_TYPE_FLOAT, N, 1, (void*)&data[0]);
             GSDUtils::checkError(retval, m_fname);
             }
 
         m_exec_conf->msg->notice(10) << "GSD: writing constraints/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "constraints/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 2,
-                                 0,
-                                 (void*)&constraint.groups[0]);
+        retval = writeChunk("constraints/group",
+                            GSD_TYPE_UINT32,
+                            N,
+                            2,
+                            (void*)&constraint.groups[0]);
         GSDUtils::checkError(retval, m_fname);
         }
 
@@ -900,29 +1198,17 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
         {
         m_exec_conf->msg->notice(10) << "GSD: writing pairs/N" << endl;
         uint32_t N = pair.size;
-        int retval = gsd_write_chunk(&m_handle, "pairs/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
+        int retval = writeChunk("pairs/N", GSD_TYPE_UINT32, 1, 1, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
 
         writeTypeMapping("pairs/types", pair.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing pairs/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "pairs/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&pair.type_id[0]);
+        retval = writeChunk("pairs/typeid", GSD_TYPE_UINT32, N, 1, (void*)&pair.type_id[0]);
         GSDUtils::checkError(retval, m_fname);
 
         m_exec_conf->msg->notice(10) << "GSD: writing pairs/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "pairs/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 2,
-                                 0,
-                                 (void*)&pair.groups[0]);
+        retval = writeChunk("pairs/group", GSD_TYPE_UINT32, N, 2, (void*)&pair.groups[0]);
         GSDUtils::checkError(retval, m_fname);
         }
     }
@@ -1014,8 +1300,7 @@ void GSDDumpWriter::writeLogQuantities(pybind11::dict dict)
             throw invalid_argument("Invalid numpy dimension in gsd log data [" + name + "]");
             }
 
-        int retval
-            = gsd_write_chunk(&m_handle, name.c_str(), type, N, (uint32_t)M, 0, (void*)arr.data());
+        int retval = writeChunk(name.c_str(), type, N, (uint32_t)M, (void*)arr.data());
         GSDUtils::checkError(retval, m_fname);
         }
     }
@@ -1033,7 +1318,8 @@ void GSDDumpWriter::populateNonDefault()
     GSDUtils::checkError(retval, m_fname);
 
     // validate schema
-    if (string(m_handle.header.schema) != string("hoomd"))
+    if (string(m_handle.header.schema) != string("hoomd")
+        && string(m_handle.header.schema) != string(GSDChunkCodec::schema))
         {
         std::ostringstream s;
         s << "GSD: "
@@ -1051,6 +1337,10 @@ void GSDDumpWriter::populateNonDefault()
     for (auto const& chunk : particle_chunks)
         {
         const gsd_index_entry* entry = gsd_find_chunk(&m_handle, 0, chunk.c_str());
+        if (entry == nullptr)
+            {
+            entry = gsd_find_chunk(&m_handle, 0, GSDChunkCodec::encodedName(chunk).c_str());
+            }
         m_nondefault[chunk] = (entry != nullptr);
         }
 
@@ -1540,7 +1830,9 @@ void export_GSDDumpWriter(pybind11::module& m)
                             std::string,
                             std::shared_ptr<ParticleGroup>,
                             std::string,
-                            bool>())
+                            bool,
+                            bool,
+                            unsigned int>())
         .def_property("log_writer", &GSDDumpWriter::getLogWriter, &GSDDumpWriter::setLogWriter)
         .def_property_readonly("filename", &GSDDumpWriter::getFilename)
         .def_property_readonly("mode", &GSDDumpWriter::getMode)
@@ -1553,6 +1845,11 @@ void export_GSDDumpWriter(pybind11::module& m)
                       &GSDDumpWriter::getWriteDiameter,
                       &GSDDumpWriter::setWriteDiameter)
         .def("flush", &GSDDumpWriter::flush)
+        .def_property("async_write", &GSDDumpWriter::getAsyncWrite, &GSDDumpWriter::setAsyncWrite)
+        .def_property_readonly("compression", &GSDDumpWriter::getCompression)
+        .def_property_readonly("quantize_position_bits", &GSDDumpWriter::getQuantizePositionBits)
+        .def_property_readonly("compression_ratio", &GSDDumpWriter::getCompressionRatio)
+        .def_property_readonly("write_throughput", &GSDDumpWriter::getWriteThroughput)
         .def_property("maximum_write_buffer_size",
                       &GSDDumpWriter::getMaximumWriteBufferSize,
                       &GSDDumpWriter::setMaximumWriteBufferSize);
@@ -8,8 +8,13 @@
 #include "SharedSignal.h"
 
 #include "hoomd/extern/gsd.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 /*! \file GSDDumpWriter.h
     \brief Declares the GSDDumpWriter class
@@ -30,6 +35,24 @@ namespace hoomd
 
     The file is not opened until the first call to analyze().
 
+    When asynchronous writes are enabled, the root rank copies each frame's data chunks into a
+    buffer and a background thread writes them to the file. At most max_queued_frames frames wait
+    for the background thread: analyze() blocks when the queue is full. Operations that access the
+    file directly (flush, truncate, changing the write buffer size, and closing the file) first
+    wait for the background thread to write all queued frames. Errors that occur in the background
+    thread are raised by the next call that queues a frame or waits for the queue.
+
+    When compression is enabled, numeric chunks of at least min_compressed_chunk_size bytes are
+    encoded with GSDChunkCodec and stored under GSDChunkCodec::encodedName(). With asynchronous
+    writes, the background thread encodes the chunks. Compression is set at construction: a created
+    file then uses the GSDChunkCodec::schema schema name, and appending compressed frames to a file
+    with the "hoomd" schema is an error.
+
+    In domain decomposed simulations, the root rank reserves space for each per-particle chunk in
+    the file and writes the values of one rank's range of tags at a time, so it holds O(N/P) values
+    at once. Asynchronous writes and compression need the whole chunk: with either enabled, the
+    root rank gathers the global frame before writing it.
+
     \ingroup analyzers
 */
 class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
@@ -41,7 +64,9 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
                   const std::string& fname,
                   std::shared_ptr<ParticleGroup> group,
                   std::string mode = "ab",
-                  bool truncate = false);
+                  bool truncate = false,
+                  bool compression = false,
+                  unsigned int quantize_position_bits = 0);
 
     //! Control topology writes
     void setWriteTopology(bool b)
@@ -128,6 +153,39 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Get the maximum write buffer size (in bytes)
     uint64_t getMaximumWriteBufferSize();
 
+    /// Set whether to write frames in a background thread
+    void setAsyncWrite(bool async_write);
+
+    /// Get whether to write frames in a background thread
+    bool getAsyncWrite()
+        {
+        return m_async_write;
+        }
+
+    /// Get whether to compress data chunks
+    bool getCompression()
+        {
+        return m_compression;
+        }
+
+    /// Get the number of bits per quantized position coordinate
+    unsigned int getQuantizePositionBits()
+        {
+        return m_quantize_position_bits;
+        }
+
+    /// Get the ratio of the size of the data chunks to the number of bytes written
+    double getCompressionRatio();
+
+    /// Get the number of bytes of data chunks written per second
+    double getWriteThroughput();
+
+    /// Maximum number of frames waiting for the background thread
+    static const unsigned int max_queued_frames = 2;
+
+    /// Smallest chunk size (in bytes) to compress
+    static const uint64_t min_compressed_chunk_size = 256;
+
     protected:
     gsd_handle m_handle; //!< Handle to the file
 
@@ -212,6 +270,22 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     //! Check and raise an exception if an error occurs
     void checkError(int retval);
 
+    //! Write a data chunk, or queue it for the background thread
+    int writeChunk(const char* name, gsd_type type, uint64_t N, uint32_t M, const void* data);
+
+    //! End the frame, or queue the frame's chunks for the background thread
+    int endFrame();
+
+    //! Encode (when requested) and write a data chunk to the file
+    int writeChunkToFile(const char* name,
+                         gsd_type type,
+                         uint64_t N,
+                         uint32_t M,
+                         const void* data);
+
+    //! Wait for the background thread to write all queued frames
+    void waitForQueuedFrames();
+
     //! Populate the non-default map
     void populateNonDefault();
 
@@ -223,6 +297,9 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     GSDFrame m_global_frame;
     GatherTagOrder m_gather_tag_order;
 
+    /// True while the per-particle chunks of the current frame are streamed from all ranks
+    bool m_stream_particle_data = false;
+
     void gatherGlobalFrame(const GSDFrame& local_frame);
 #endif
 
@@ -254,12 +331,101 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Working array to sort local particles by tag
     std::vector<unsigned int> m_index;
 
+    /// A data chunk waiting for the background thread
+    struct QueuedChunk
+        {
+        std::string name;
+        gsd_type type;
+        uint64_t N;
+        uint32_t M;
+        std::vector<char> data;
+        };
+
+    /// The data chunks of one frame waiting for the background thread
+    struct QueuedFrame
+        {
+        /// Chunks in the frame (entries past n_chunks are kept to reuse their memory)
+        std::vector<QueuedChunk> chunks;
+
+        /// Number of chunks in the frame
+        size_t n_chunks = 0;
+        };
+
+    /// True when frames are written by the background thread
+    bool m_async_write = false;
+
+    /// Frame that analyze() is filling
+    QueuedFrame m_current_frame;
+
+    /// Frames waiting for the background thread, in order
+    std::deque<QueuedFrame> m_queued_frames;
+
+    /// Written frames kept to reuse their memory
+    std::vector<QueuedFrame> m_free_frames;
+
+    /// Background thread that writes the queued frames
+    std::thread m_write_thread;
+
+    /// Protects the members shared with the background thread
+    std::mutex m_write_mutex;
+
+    /// Signals changes to the queue
+    std::condition_variable m_write_cv;
+
+    /// True while the background thread writes a frame
+    bool m_write_busy = false;
+
+    /// Set to stop the background thread
+    bool m_stop_write_thread = false;
+
+    /// First error returned by the GSD library in the background thread
+    int m_write_error = GSD_SUCCESS;
+
+    /// Value of errno after m_write_error
+    int m_write_errno = 0;
+
+    /// True when data chunks are compressed
+    bool m_compression = false;
+
+    /// Bits per quantized position coordinate, 0 when positions are stored exactly
+    unsigned int m_quantize_position_bits = 0;
+
+    /// Buffer for encoded chunks
+    std::vector<char> m_encode_buffer;
+
+    /// Total size of the data chunks passed to writeChunkToFile()
+    std::atomic<uint64_t> m_bytes_in {0};
+
+    /// Total number of bytes written by writeChunkToFile()
+    std::atomic<uint64_t> m_bytes_out {0};
+
+    /// Total time spent in writeChunkToFile() (in nanoseconds)
+    std::atomic<uint64_t> m_write_time {0};
+
+    //! Write the queued frames (the background thread's main loop)
+    void writeQueuedFrames();
+
+    //! Stop the background thread after it writes all queued frames
+    void stopWriteThread();
+
     //! Write a type mapping out to the file
     void writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping);
 
     //! Write frame header
     void writeFrameHeader(const GSDFrame& frame);
 
+    //! Check whether a per-particle chunk is present in the frame
+    template<class T>
+    bool
+    hasParticleData(const GSDFrame& frame, unsigned int flag, const std::vector<T>& data) const;
+
+    //! Write a per-particle chunk
+    template<class T>
+    void writeParticleChunk(const char* name,
+                            gsd_type type,
+                            uint32_t M,
+                            const std::vector<T>& data);
+
     //! Write particle attributes
     void writeAttributes(const GSDFrame& frame);
 
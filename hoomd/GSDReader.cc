@@ -4,10 +4,12 @@
 #include "GSDReader.h"
 #include "ExecutionConfiguration.h"
 #include "GSD.h"
+#include "GSDChunkCodec.h"
 #include "SnapshotSystemData.h"
 #include "hoomd/extern/gsd.h"
 #include <sstream>
 #include <string.h>
+#include <unistd.h>
 
 #include <stdexcept>
 using namespace std;
@@ -19,21 +21,25 @@ namespace hoomd
     \param name File name to read
     \param frame Frame index to read from the file
     \param from_end Count frames back from the end of the file
+    \param distributed Read a slice of the file on every rank
 
     The GSDReader constructor opens the GSD file, initializes an empty snapshot, and reads the file
-   into memory (on the root rank).
+   into memory (on the root rank, or a slice on every rank when \a distributed is set).
 */
 GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                      const std::string& name,
                      const uint64_t frame,
-                     bool from_end)
+                     bool from_end,
+                     bool distributed)
     : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame)
     {
     m_snapshot = std::shared_ptr<SnapshotSystemData<float>>(new SnapshotSystemData<float>);
 
 #ifdef ENABLE_MPI
+    m_distributed = distributed && m_exec_conf->getNRanks() > 1;
+
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_distributed)
         {
         return;
         }
@@ -43,9 +49,11 @@ GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
     m_exec_conf->msg->notice(3) << "data.gsd_snapshot: open gsd file " << name << endl;
     int retval = gsd_open(&m_handle, name.c_str(), GSD_OPEN_READONLY);
     GSDUtils::checkError(retval, m_name);
+    m_open = true;
 
     // validate schema
-    if (string(m_handle.header.schema) != string("hoomd"))
+    if (string(m_handle.header.schema) != string("hoomd")
+        && string(m_handle.header.schema) != string(GSDChunkCodec::schema))
         {
         std::ostringstream s;
         s << "Invalid schema in " << name << endl;
@@ -79,15 +87,8 @@ GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
 
 GSDReader::~GSDReader()
     {
-#ifdef ENABLE_MPI
-    // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
-        {
-        return;
-        }
-#endif
-
-    gsd_close(&m_handle);
+    if (m_open)
+        gsd_close(&m_handle);
     }
 
 /*! \param data Pointer to data to read into
@@ -110,11 +111,30 @@ bool GSDReader::readChunk(void* data,
                           size_t expected_size,
                           unsigned int cur_n)
     {
-    const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, frame, name);
-    if (entry == NULL && frame != 0)
-        entry = gsd_find_chunk(&m_handle, 0, name);
+    bool encoded = false;
+    const struct gsd_index_entry* entry = findChunk(frame, name, encoded);
+
+    if (entry == NULL)
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+
+    std::vector<char> encoded_data;
+    uint64_t N = entry->N;
+    size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (encoded)
+        {
+        encoded_data.resize(actual_size);
+        int retval = gsd_read_chunk(&m_handle, encoded_data.data(), entry);
+        GSDUtils::checkError(retval, m_name);
+
+        GSDChunkCodec::Header header = GSDChunkCodec::readHeader(encoded_data);
+        N = header.N;
+        actual_size = header.N * header.M * gsd_sizeof_type((enum gsd_type)header.type);
+        }
 
-    if (entry == NULL || (cur_n != 0 && entry->N != cur_n))
+    if (cur_n != 0 && N != cur_n)
         {
         m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
         return false;
@@ -122,7 +142,6 @@ bool GSDReader::readChunk(void* data,
     else
         {
         m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk " << name << endl;
-        size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
         if (actual_size != expected_size)
             {
             std::ostringstream s;
@@ -130,11 +149,173 @@ bool GSDReader::readChunk(void* data,
               << actual_size << ".";
             throw runtime_error(s.str());
             }
-        int retval = gsd_read_chunk(&m_handle, data, entry);
+
+        if (encoded)
+            {
+            GSDChunkCodec::decode(data, actual_size, encoded_data);
+            }
+        else
+            {
+            int retval = gsd_read_chunk(&m_handle, data, entry);
+            GSDUtils::checkError(retval, m_name);
+            }
+
+        return true;
+        }
+    }
+
+/*! \param N Number of rows in the chunk
+    \param first Output index of the first row read by this rank
+    \param count Output number of rows read by this rank
+*/
+void GSDReader::getSlice(unsigned int N, unsigned int& first, unsigned int& count) const
+    {
+    first = 0;
+    count = N;
+#ifdef ENABLE_MPI
+    if (m_distributed)
+        {
+        uint64_t rank = m_exec_conf->getRank();
+        uint64_t n_ranks = m_exec_conf->getNRanks();
+        first = (unsigned int)(N * rank / n_ranks);
+        count = (unsigned int)(N * (rank + 1) / n_ranks) - first;
+        }
+#endif
+    }
+
+/*! \param data Pointer to data to read into
+    \param name Name of the data chunk
+    \param row_size Size of one row of the chunk in bytes
+    \param N Number of rows in the current frame
+
+    Read the slice of the chunk on this rank in distributed mode, or the whole chunk otherwise.
+*/
+bool GSDReader::readRows(void* data, const char* name, size_t row_size, unsigned int N)
+    {
+    if (!m_distributed)
+        return readChunk(data, m_frame, name, N * row_size, N);
+
+    unsigned int first, count;
+    getSlice(N, first, count);
+    return readChunkSlice(data, m_frame, name, row_size, N, first, count);
+    }
+
+/*! \param data Pointer to data to read into
+    \param frame Frame index to read from
+    \param name Name of the data chunk
+    \param row_size Expected size of one row of the chunk in bytes
+    \param N N in the current frame
+    \param first First row to read
+    \param count Number of rows to read
+
+    Same as readChunk(), but read only the rows [first, first + count). Plain chunks are read
+    directly from the file at the offset of the first row. Encoded chunks are decoded in full.
+*/
+bool GSDReader::readChunkSlice(void* data,
+                               uint64_t frame,
+                               const char* name,
+                               size_t row_size,
+                               unsigned int N,
+                               unsigned int first,
+                               unsigned int count)
+    {
+    bool encoded = false;
+    const struct gsd_index_entry* entry = findChunk(frame, name, encoded);
+
+    if (entry == NULL)
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+
+    std::vector<char> encoded_data;
+    uint64_t chunk_n = entry->N;
+    size_t actual_row_size = entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (encoded)
+        {
+        encoded_data.resize(entry->N * actual_row_size);
+        int retval = gsd_read_chunk(&m_handle, encoded_data.data(), entry);
         GSDUtils::checkError(retval, m_name);
 
+        GSDChunkCodec::Header header = GSDChunkCodec::readHeader(encoded_data);
+        chunk_n = header.N;
+        actual_row_size = header.M * gsd_sizeof_type((enum gsd_type)header.type);
+        }
+
+    if (chunk_n != N)
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+
+    m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading rows " << first << " to "
+                                << first + count << " of chunk " << name << endl;
+    if (actual_row_size != row_size)
+        {
+        std::ostringstream s;
+        s << "Expecting " << N * row_size << " bytes in " << name << " but found "
+          << N * actual_row_size << ".";
+        throw runtime_error(s.str());
+        }
+
+    if (encoded)
+        {
+        std::vector<char> decoded(N * row_size);
+        GSDChunkCodec::decode(decoded.data(), decoded.size(), encoded_data);
+        memcpy(data, decoded.data() + first * row_size, count * row_size);
         return true;
         }
+
+    // pread may return fewer bytes than requested, read until the slice is complete
+    char* ptr = (char*)data;
+    size_t total = count * row_size;
+    size_t done = 0;
+    while (done < total)
+        {
+        ssize_t n = pread(m_handle.fd,
+                          ptr + done,
+                          total - done,
+                          entry->location + first * row_size + done);
+        if (n <= 0)
+            GSDUtils::checkError(GSD_ERROR_IO, m_name);
+        done += n;
+        }
+
+    return true;
+    }
+
+/*! \param frame Frame index to search
+    \param name Name of the data chunk
+    \param encoded Set to true when the chunk is stored in encoded form
+    \returns The index entry of the chunk, or NULL when it is not present
+
+    Search for the chunk and then its encoded form (see GSDChunkCodec) in the given frame, then in
+    frame 0.
+*/
+const struct gsd_index_entry*
+GSDReader::findChunk(uint64_t frame, const char* name, bool& encoded)
+    {
+    const std::string encoded_name = GSDChunkCodec::encodedName(name);
+
+    for (uint64_t f : {frame, uint64_t(0)})
+        {
+        const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, f, name);
+        encoded = false;
+        if (entry == NULL)
+            {
+            entry = gsd_find_chunk(&m_handle, f, encoded_name.c_str());
+            encoded = true;
+            }
+
+        if (entry != NULL)
+            return entry;
+
+        if (frame == 0)
+            break;
+        }
+
+    encoded = false;
+    return NULL;
     }
 
 /*! \param frame Frame index to read from
@@ -210,37 +391,33 @@ void GSDReader::readHeader()
         s << "Cannot read a file with 0 particles.";
         throw runtime_error(s.str());
         }
-    m_snapshot->particle_data.resize(N);
+    m_n_particles = N;
+
+    unsigned int first, count;
+    getSlice(N, first, count);
+    m_snapshot->particle_data.resize(count);
     }
 
 /*! Read the same data chunks for particles
  */
 void GSDReader::readParticles()
     {
-    unsigned int N = m_snapshot->particle_data.size;
+    unsigned int N = m_n_particles;
     m_snapshot->particle_data.type_mapping = readTypes(m_frame, "particles/types");
 
     // the snapshot already has default values, if a chunk is not found, the value
     // is already at the default, and the failed read is not a problem
-    readChunk(&m_snapshot->particle_data.type[0], m_frame, "particles/typeid", N * 4, N);
-    readChunk(&m_snapshot->particle_data.mass[0], m_frame, "particles/mass", N * 4, N);
-    readChunk(&m_snapshot->particle_data.charge[0], m_frame, "particles/charge", N * 4, N);
-    readChunk(&m_snapshot->particle_data.diameter[0], m_frame, "particles/diameter", N * 4, N);
-    readChunk(&m_snapshot->particle_data.body[0], m_frame, "particles/body", N * 4, N);
-    readChunk(&m_snapshot->particle_data.inertia[0],
-              m_frame,
-              "particles/moment_inertia",
-              N * 12,
-              N);
-    readChunk(&m_snapshot->particle_data.pos[0], m_frame, "particles/position", N * 12, N);
-    readChunk(&m_snapshot->particle_data.orientation[0],
-              m_frame,
-              "particles/orientation",
-              N * 16,
-              N);
-    readChunk(&m_snapshot->particle_data.vel[0], m_frame, "particles/velocity", N * 12, N);
-    readChunk(&m_snapshot->particle_data.angmom[0], m_frame, "particles/angmom", N * 16, N);
-    readChunk(&m_snapshot->particle_data.image[0], m_frame, "particles/image", N * 12, N);
+    readRows(m_snapshot->particle_data.type.data(), "particles/typeid", 4, N);
+    readRows(m_snapshot->particle_data.mass.data(), "particles/mass", 4, N);
+    readRows(m_snapshot->particle_data.charge.data(), "particles/charge", 4, N);
+    readRows(m_snapshot->particle_data.diameter.data(), "particles/diameter", 4, N);
+    readRows(m_snapshot->particle_data.body.data(), "particles/body", 4, N);
+    readRows(m_snapshot->particle_data.inertia.data(), "particles/moment_inertia", 12, N);
+    readRows(m_snapshot->particle_data.pos.data(), "particles/position", 12, N);
+    readRows(m_snapshot->particle_data.orientation.data(), "particles/orientation", 16, N);
+    readRows(m_snapshot->particle_data.vel.data(), "particles/velocity", 12, N);
+    readRows(m_snapshot->particle_data.angmom.data(), "particles/angmom", 16, N);
+    readRows(m_snapshot->particle_data.image.data(), "particles/image", 12, N);
     }
 
 /*! Read the same data chunks for topology
@@ -248,13 +425,15 @@ void GSDReader::readParticles()
 void GSDReader::readTopology()
     {
     unsigned int N = 0;
+    unsigned int first, count;
     m_snapshot->bond_data.type_mapping = readTypes(m_frame, "bonds/types");
     readChunk(&N, m_frame, "bonds/N", 4);
     if (N > 0)
         {
-        m_snapshot->bond_data.resize(N);
-        readChunk(&m_snapshot->bond_data.type_id[0], m_frame, "bonds/typeid", N * 4, N);
-        readChunk(&m_snapshot->bond_data.groups[0], m_frame, "bonds/group", N * 8, N);
+        getSlice(N, first, count);
+        m_snapshot->bond_data.resize(count);
+        readRows(m_snapshot->bond_data.type_id.data(), "bonds/typeid", 4, N);
+        readRows(m_snapshot->bond_data.groups.data(), "bonds/group", 8, N);
         }
 
     N = 0;
@@ -262,9 +441,10 @@ void GSDReader::readTopology()
     readChunk(&N, m_frame, "angles/N", 4);
     if (N > 0)
         {
-        m_snapshot->angle_data.resize(N);
-        readChunk(&m_snapshot->angle_data.type_id[0], m_frame, "angles/typeid", N * 4, N);
-        readChunk(&m_snapshot->angle_data.groups[0], m_frame, "angles/group", N * 12, N);
+        getSlice(N, first, count);
+        m_snapshot->angle_data.resize(count);
+        readRows(m_snapshot->angle_data.type_id.data(), "angles/typeid", 4, N);
+        readRows(m_snapshot->angle_data.groups.data(), "angles/group", 12, N);
         }
 
     N = 0;
@@ -272,9 +452,10 @@ void GSDReader::readTopology()
     readChunk(&N, m_frame, "dihedrals/N", 4);
     if (N > 0)
         {
-        m_snapshot->dihedral_data.resize(N);
-        readChunk(&m_snapshot->dihedral_data.type_id[0], m_frame, "dihedrals/typeid", N * 4, N);
-        readChunk(&m_snapshot->dihedral_data.groups[0], m_frame, "dihedrals/group", N * 16, N);
+        getSlice(N, first, count);
+        m_snapshot->dihedral_data.resize(count);
+        readRows(m_snapshot->dihedral_data.type_id.data(), "dihedrals/typeid", 4, N);
+        readRows(m_snapshot->dihedral_data.groups.data(), "dihedrals/group", 16, N);
         }
 
     N = 0;
@@ -282,22 +463,24 @@ void GSDReader::readTopology()
     readChunk(&N, m_frame, "impropers/N", 4);
     if (N > 0)
         {
-        m_snapshot->improper_data.resize(N);
-        readChunk(&m_snapshot->improper_data.type_id[0], m_frame, "impropers/typeid", N * 4, N);
-        readChunk(&m_snapshot->improper_data.groups[0], m_frame, "impropers/group", N * 16, N);
+        getSlice(N, first, count);
+        m_snapshot->improper_data.resize(count);
+        readRows(m_snapshot->improper_data.type_id.data(), "impropers/typeid", 4, N);
+        readRows(m_snapshot->improper_data.groups.data(), "impropers/group", 16, N);
         }
 
     N = 0;
     readChunk(&N, m_frame, "constraints/N", 4);
     if (N > 0)
         {
-        m_snapshot->constraint_data.resize(N);
-        std::vector<float> data(N);
-        readChunk(&data[0], m_frame, "constraints/value", N * 4, N);
-        for (unsigned int i = 0; i < N; i++)
+        getSlice(N, first, count);
+        m_snapshot->constraint_data.resize(count);
+        std::vector<float> data(count);
+        readRows(data.data(), "constraints/value", 4, N);
+        for (unsigned int i = 0; i < count; i++)
             m_snapshot->constraint_data.val[i] = Scalar(data[i]);
 
-        readChunk(&m_snapshot->constraint_data.groups[0], m_frame, "constraints/group", N * 8, N);
+        readRows(m_snapshot->constraint_data.groups.data(), "constraints/group", 8, N);
         }
 
     if (m_handle.header.schema_version >= gsd_make_version(1, 1))
@@ -307,9 +490,10 @@ void GSDReader::readTopology()
         readChunk(&N, m_frame, "pairs/N", 4);
         if (N > 0)
             {
-            m_snapshot->pair_data.resize(N);
-            readChunk(&m_snapshot->pair_data.type_id[0], m_frame, "pairs/typeid", N * 4, N);
-            readChunk(&m_snapshot->pair_data.groups[0], m_frame, "pairs/group", N * 8, N);
+            getSlice(N, first, count);
+            m_snapshot->pair_data.resize(count);
+            readRows(m_snapshot->pair_data.type_id.data(), "pairs/typeid", 4, N);
+            readRows(m_snapshot->pair_data.groups.data(), "pairs/group", 8, N);
             }
         }
     }
@@ -331,6 +515,7 @@ void export_GSDReader(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<const ExecutionConfiguration>,
                             const string&,
                             const uint64_t,
+                            bool,
                             bool>())
         .def("getTimeStep", &GSDReader::getTimeStep)
         .def("getSnapshot", &GSDReader::getSnapshot)
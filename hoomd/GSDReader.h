@@ -24,6 +24,11 @@ template<class Real> struct SnapshotSystemData;
 /*! Read an input GSD file and generate a system snapshot. GSDReader can read any frame from a GSD
     file into the snapshot. For information on the GSD specification, see http://gsd.readthedocs.io/
 
+    By default, only the root rank reads the file. In distributed mode, every rank opens the file
+    and reads a contiguous slice of the per-particle and per-group chunks into its snapshot: rank r
+    of P reads the rows [N r / P, N (r + 1) / P) of a chunk with N rows. Pass the slices to
+    SystemDefinition to initialize the system without gathering the whole snapshot on one rank.
+
     \ingroup data_structs
 */
 class PYBIND11_EXPORT GSDReader
@@ -33,7 +38,8 @@ class PYBIND11_EXPORT GSDReader
     GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
               const std::string& name,
               const uint64_t frame,
-              bool from_end);
+              bool from_end,
+              bool distributed = false);
 
     //! Destructor
     ~GSDReader();
@@ -92,10 +98,31 @@ class PYBIND11_EXPORT GSDReader
     uint64_t m_frame;                                          //!< Cached frame
     std::shared_ptr<SnapshotSystemData<float>> m_snapshot;     //!< The snapshot to read
     gsd_handle m_handle;                                       //!< Handle to the file
+    bool m_distributed = false;                                //!< Read a slice on each rank
+    bool m_open = false;                                       //!< True when the file is open
+    unsigned int m_n_particles = 0;                            //!< Number of particles in the frame
 
     //! Helper function to read a type list from the file
     std::vector<std::string> readTypes(uint64_t frame, const char* name);
 
+    //! Helper function to find a chunk or its encoded form in the file
+    const struct gsd_index_entry* findChunk(uint64_t frame, const char* name, bool& encoded);
+
+    //! Helper function to read the rows of a per-particle or per-group chunk on this rank
+    bool readRows(void* data, const char* name, size_t row_size, unsigned int N);
+
+    //! Helper function to read a slice of rows from a chunk
+    bool readChunkSlice(void* data,
+                        uint64_t frame,
+                        const char* name,
+                        size_t row_size,
+                        unsigned int N,
+                        unsigned int first,
+                        unsigned int count);
+
+    //! Get the range of rows of a chunk with N rows read by this rank
+    void getSlice(unsigned int N, unsigned int& first, unsigned int& count) const;
+
     // helper functions to read sections of the file
     void readHeader();
     void readParticles();
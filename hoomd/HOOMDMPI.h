@@ -20,10 +20,14 @@
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <numeric>
 #include <queue>
 #include <sstream>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <cereal/archives/binary.hpp>
@@ -194,8 +198,35 @@ typedef struct
     int i;
     } Scalar_Int;
 
+namespace detail
+    {
+//! True for types that the MPI wrappers send as raw bytes instead of serializing with cereal
+/*! bool is excluded because std::vector<bool> does not store its elements contiguously.
+ */
+template<typename T>
+struct is_mpi_pod
+    : std::integral_constant<bool,
+                             std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value>
+    {
+    };
+
+//! Create a committed MPI datatype for one value of type T
+/*! The caller must free the datatype with MPI_Type_free(). Counting elements instead of bytes keeps
+    the counts passed to MPI small for large arrays.
+*/
+template<typename T> MPI_Datatype create_mpi_pod_type()
+    {
+    MPI_Datatype mpi_type;
+    MPI_Type_contiguous(sizeof(T), MPI_BYTE, &mpi_type);
+    MPI_Type_commit(&mpi_type);
+    return mpi_type;
+    }
+    } // end namespace detail
+
 //! Wrapper around MPI_Bcast that handles any serializable object
-template<typename T> void bcast(T& val, unsigned int root, const MPI_Comm mpi_comm)
+template<typename T>
+std::enable_if_t<!detail::is_mpi_pod<T>::value>
+bcast(T& val, unsigned int root, const MPI_Comm mpi_comm)
     {
     int rank;
     MPI_Comm_rank(mpi_comm, &rank);
@@ -239,12 +270,36 @@ template<typename T> void bcast(T& val, unsigned int root, const MPI_Comm mpi_co
     delete[] buf;
     }
 
+//! Wrapper around MPI_Bcast for trivially copyable types
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value>
+bcast(T& val, unsigned int root, const MPI_Comm mpi_comm)
+    {
+    MPI_Bcast(&val, sizeof(T), MPI_BYTE, root, mpi_comm);
+    }
+
+//! Wrapper around MPI_Bcast for vectors of trivially copyable types
+/*! The values are broadcast as raw bytes without serialization.
+ */
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value>
+bcast(std::vector<T>& val, unsigned int root, const MPI_Comm mpi_comm)
+    {
+    unsigned long count = val.size();
+    MPI_Bcast(&count, 1, MPI_UNSIGNED_LONG, root, mpi_comm);
+    val.resize(count);
+
+    MPI_Datatype mpi_type = detail::create_mpi_pod_type<T>();
+    MPI_Bcast(val.data(), (int)count, mpi_type, root, mpi_comm);
+    MPI_Type_free(&mpi_type);
+    }
+
 //! Wrapper around MPI_Scatterv that scatters a vector of serializable objects
 template<typename T>
-void scatter_v(const std::vector<T>& in_values,
-               T& out_value,
-               unsigned int root,
-               const MPI_Comm mpi_comm)
+std::enable_if_t<!detail::is_mpi_pod<T>::value> scatter_v(const std::vector<T>& in_values,
+                                                          T& out_value,
+                                                          unsigned int root,
+                                                          const MPI_Comm mpi_comm)
     {
     int rank;
     int size;
@@ -312,12 +367,92 @@ void scatter_v(const std::vector<T>& in_values,
     delete[] rbuf;
     }
 
+//! Wrapper around MPI_Scatter for trivially copyable types
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value> scatter_v(const std::vector<T>& in_values,
+                                                         T& out_value,
+                                                         unsigned int root,
+                                                         const MPI_Comm mpi_comm)
+    {
+    int rank;
+    MPI_Comm_rank(mpi_comm, &rank);
+#ifndef NDEBUG
+    int size;
+    MPI_Comm_size(mpi_comm, &size);
+    assert(rank != (int)root || in_values.size() == (unsigned int)size);
+#endif
+
+    MPI_Scatter(rank == (int)root ? in_values.data() : NULL,
+                sizeof(T),
+                MPI_BYTE,
+                &out_value,
+                sizeof(T),
+                MPI_BYTE,
+                root,
+                mpi_comm);
+    }
+
+//! Wrapper around MPI_Scatterv for vectors of trivially copyable types
+/*! \param in_values Values to send to each rank, indexed by destination rank (only read on root)
+    \param out_values Output values received by this rank
+    \param root Rank that sends the values
+    \param mpi_comm The MPI communicator
+
+    The values are sent as raw bytes without serialization.
+*/
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value>
+scatter_v(const std::vector<std::vector<T>>& in_values,
+          std::vector<T>& out_values,
+          unsigned int root,
+          const MPI_Comm mpi_comm)
+    {
+    int rank;
+    int size;
+    MPI_Comm_rank(mpi_comm, &rank);
+    MPI_Comm_size(mpi_comm, &size);
+
+    std::vector<int> send_counts;
+    std::vector<int> displs;
+    std::vector<T> send_buf;
+    if (rank == (int)root)
+        {
+        assert(in_values.size() == (unsigned int)size);
+        send_counts.resize(size);
+        displs.resize(size);
+        for (int i = 0; i < size; i++)
+            send_counts[i] = (int)in_values[i].size();
+        std::exclusive_scan(send_counts.begin(), send_counts.end(), displs.begin(), 0);
+
+        // pack the send buffer
+        send_buf.resize(displs[size - 1] + send_counts[size - 1]);
+        for (int i = 0; i < size; i++)
+            std::copy(in_values[i].begin(), in_values[i].end(), send_buf.begin() + displs[i]);
+        }
+
+    int recv_count;
+    MPI_Scatter(send_counts.data(), 1, MPI_INT, &recv_count, 1, MPI_INT, root, mpi_comm);
+    out_values.resize(recv_count);
+
+    MPI_Datatype mpi_type = detail::create_mpi_pod_type<T>();
+    MPI_Scatterv(send_buf.data(),
+                 send_counts.data(),
+                 displs.data(),
+                 mpi_type,
+                 out_values.data(),
+                 recv_count,
+                 mpi_type,
+                 root,
+                 mpi_comm);
+    MPI_Type_free(&mpi_type);
+    }
+
 //! Wrapper around MPI_Gatherv
 template<typename T>
-void gather_v(const T& in_value,
-              std::vector<T>& out_values,
-              unsigned int root,
-              const MPI_Comm mpi_comm)
+std::enable_if_t<!detail::is_mpi_pod<T>::value> gather_v(const T& in_value,
+                                                         std::vector<T>& out_values,
+                                                         unsigned int root,
+                                                         const MPI_Comm mpi_comm)
     {
     int rank;
     int size;
@@ -388,9 +523,94 @@ void gather_v(const T& in_value,
         }
     }
 
+//! Wrapper around MPI_Gather for trivially copyable types
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value> gather_v(const T& in_value,
+                                                        std::vector<T>& out_values,
+                                                        unsigned int root,
+                                                        const MPI_Comm mpi_comm)
+    {
+    int rank;
+    int size;
+    MPI_Comm_rank(mpi_comm, &rank);
+    MPI_Comm_size(mpi_comm, &size);
+
+    if (rank == (int)root)
+        out_values.resize(size);
+
+    MPI_Gather(&in_value,
+               sizeof(T),
+               MPI_BYTE,
+               rank == (int)root ? out_values.data() : NULL,
+               sizeof(T),
+               MPI_BYTE,
+               root,
+               mpi_comm);
+    }
+
+//! Wrapper around MPI_Gatherv for vectors of trivially copyable types
+/*! \param in_values Values to send from this rank
+    \param out_values Output values received from each rank, indexed by source rank (only set on
+           root)
+    \param root Rank that receives the values
+    \param mpi_comm The MPI communicator
+
+    The values are sent as raw bytes without serialization.
+*/
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value> gather_v(const std::vector<T>& in_values,
+                                                        std::vector<std::vector<T>>& out_values,
+                                                        unsigned int root,
+                                                        const MPI_Comm mpi_comm)
+    {
+    int rank;
+    int size;
+    MPI_Comm_rank(mpi_comm, &rank);
+    MPI_Comm_size(mpi_comm, &size);
+
+    int send_count = (int)in_values.size();
+    std::vector<int> recv_counts;
+    std::vector<int> displs;
+    if (rank == (int)root)
+        {
+        recv_counts.resize(size);
+        displs.resize(size);
+        }
+    MPI_Gather(&send_count, 1, MPI_INT, recv_counts.data(), 1, MPI_INT, root, mpi_comm);
+
+    std::vector<T> recv_buf;
+    if (rank == (int)root)
+        {
+        std::exclusive_scan(recv_counts.begin(), recv_counts.end(), displs.begin(), 0);
+        recv_buf.resize(displs[size - 1] + recv_counts[size - 1]);
+        }
+
+    MPI_Datatype mpi_type = detail::create_mpi_pod_type<T>();
+    MPI_Gatherv(in_values.data(),
+                send_count,
+                mpi_type,
+                recv_buf.data(),
+                recv_counts.data(),
+                displs.data(),
+                mpi_type,
+                root,
+                mpi_comm);
+    MPI_Type_free(&mpi_type);
+
+    // unpack the receive buffer
+    if (rank == (int)root)
+        {
+        out_values.resize(size);
+        for (int i = 0; i < size; i++)
+            out_values[i].assign(recv_buf.begin() + displs[i],
+                                 recv_buf.begin() + displs[i] + recv_counts[i]);
+        }
+    }
+
 //! Wrapper around MPI_Allgatherv
 template<typename T>
-void all_gather_v(const T& in_value, std::vector<T>& out_values, const MPI_Comm mpi_comm)
+std::enable_if_t<!detail::is_mpi_pod<T>::value>
+all_gather_v(const T& in_value, std::vector<T>& out_values, const MPI_Comm mpi_comm)
     {
     int rank;
     int size;
@@ -450,6 +670,107 @@ void all_gather_v(const T& in_value, std::vector<T>& out_values, const MPI_Comm
     delete[] rbuf;
     }
 
+//! Wrapper around MPI_Allgather for trivially copyable types
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value>
+all_gather_v(const T& in_value, std::vector<T>& out_values, const MPI_Comm mpi_comm)
+    {
+    int size;
+    MPI_Comm_size(mpi_comm, &size);
+    out_values.resize(size);
+    MPI_Allgather(&in_value, sizeof(T), MPI_BYTE, out_values.data(), sizeof(T), MPI_BYTE, mpi_comm);
+    }
+
+//! Wrapper around MPI_Allgatherv for vectors of trivially copyable types
+/*! \param in_values Values to send from this rank
+    \param out_values Output values received from each rank, indexed by source rank
+    \param mpi_comm The MPI communicator
+
+    The values are sent as raw bytes without serialization.
+*/
+template<typename T>
+std::enable_if_t<detail::is_mpi_pod<T>::value>
+all_gather_v(const std::vector<T>& in_values,
+             std::vector<std::vector<T>>& out_values,
+             const MPI_Comm mpi_comm)
+    {
+    int size;
+    MPI_Comm_size(mpi_comm, &size);
+
+    int send_count = (int)in_values.size();
+    std::vector<int> recv_counts(size);
+    std::vector<int> displs(size);
+    MPI_Allgather(&send_count, 1, MPI_INT, recv_counts.data(), 1, MPI_INT, mpi_comm);
+    std::exclusive_scan(recv_counts.begin(), recv_counts.end(), displs.begin(), 0);
+
+    std::vector<T> recv_buf(displs[size - 1] + recv_counts[size - 1]);
+    MPI_Datatype mpi_type = detail::create_mpi_pod_type<T>();
+    MPI_Allgatherv(in_values.data(),
+                   send_count,
+                   mpi_type,
+                   recv_buf.data(),
+                   recv_counts.data(),
+                   displs.data(),
+                   mpi_type,
+                   mpi_comm);
+    MPI_Type_free(&mpi_type);
+
+    // unpack the receive buffer
+    out_values.resize(size);
+    for (int i = 0; i < size; i++)
+        out_values[i].assign(recv_buf.begin() + displs[i],
+                             recv_buf.begin() + displs[i] + recv_counts[i]);
+    }
+
+//! Wrapper around MPI_Alltoallv for trivially copyable types
+/*! \param send_values Values to send to each rank, indexed by destination rank
+    \param recv_values Output values received from all ranks, in order of the source rank
+    \param mpi_comm The MPI communicator
+
+    The values are exchanged as raw bytes without serialization.
+*/
+template<typename T>
+void all_to_all_v(const std::vector<std::vector<T>>& send_values,
+                  std::vector<T>& recv_values,
+                  const MPI_Comm mpi_comm)
+    {
+    static_assert(detail::is_mpi_pod<T>::value, "all_to_all_v requires a POD type");
+
+    int size;
+    MPI_Comm_size(mpi_comm, &size);
+    assert(send_values.size() == (unsigned int)size);
+
+    // exchange the number of values
+    std::vector<int> send_counts(size);
+    std::vector<int> recv_counts(size);
+    for (int i = 0; i < size; i++)
+        send_counts[i] = (int)send_values[i].size();
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, mpi_comm);
+
+    std::vector<int> send_displs(size);
+    std::vector<int> recv_displs(size);
+    std::exclusive_scan(send_counts.begin(), send_counts.end(), send_displs.begin(), 0);
+    std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
+
+    // pack the send buffer
+    std::vector<T> send_buf(send_displs[size - 1] + send_counts[size - 1]);
+    for (int i = 0; i < size; i++)
+        std::copy(send_values[i].begin(), send_values[i].end(), send_buf.begin() + send_displs[i]);
+    recv_values.resize(recv_displs[size - 1] + recv_counts[size - 1]);
+
+    MPI_Datatype mpi_type = detail::create_mpi_pod_type<T>();
+    MPI_Alltoallv(send_buf.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  mpi_type,
+                  recv_values.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  mpi_type,
+                  mpi_comm);
+    MPI_Type_free(&mpi_type);
+    }
+
 //! Wrapper around MPI_Send that handles any serializable object
 template<typename T> void send(const T& val, const unsigned int dest, const MPI_Comm mpi_comm)
     {
@@ -515,6 +836,17 @@ template<typename T> void recv(T& val, const unsigned int src, const MPI_Comm mp
        order.
     3) Repeat step 2 for as many arrays as needed (all must be in the same tag order).
 
+    The ranks sort the values cooperatively. Each rank owns a contiguous range of tags. It receives
+    the values for the tags in its range from all ranks and places them in tag order. The root
+    then receives the sorted ranges directly into the global array. The root rank stores neither
+    the gathered tags nor an unsorted copy of the global array, and the sort work is spread over
+    all ranks.
+
+    gatherArray() places the whole global array on the root. Callers that only need to stream the
+    values in tag order (such as GSDDumpWriter writing a chunk to a file) should call
+    gatherArrayInPieces() instead: the root then receives one rank's sorted range at a time and
+    its memory use is bounded by the largest range, which is about 1/P of the global array.
+
     GatherTagOrder maintains internal cache variables. Reuse an existing GatherTagOrder instances
     to avoid costly memory reallocations.
 
@@ -537,20 +869,15 @@ class GatherTagOrder
         MPI_Comm_rank(m_mpi_communicator, &rank);
         MPI_Comm_size(m_mpi_communicator, &n_ranks);
 
+        m_send_counts.resize(n_ranks);
+        m_send_displacements.resize(n_ranks);
+        m_exchange_counts.resize(n_ranks);
+        m_exchange_displacements.resize(n_ranks);
+
         if (rank == m_root)
             {
             m_recv_counts.resize(n_ranks);
-            m_recv_bytes.resize(n_ranks);
             m_displacements.resize(n_ranks);
-            m_displacement_bytes.resize(n_ranks);
-            }
-        }
-
-    ~GatherTagOrder()
-        {
-        if (m_gather_buffer != nullptr)
-            {
-            free(m_gather_buffer);
             }
         }
 
@@ -561,14 +888,83 @@ class GatherTagOrder
         }
 
     /// Provide the tag order for the local arrays to be gathered.
+    /** \param local_tag Local tags in ascending order.
+        \param n_local_tags Number of local tags.
+    */
     void setLocalTagsSorted(unsigned int* local_tag, int n_local_tags)
         {
-        // First, gather all the rank local tags onto the root processor.
         int rank, n_ranks;
         MPI_Comm_rank(m_mpi_communicator, &rank);
         MPI_Comm_size(m_mpi_communicator, &n_ranks);
 
-        MPI_Gather(&n_local_tags,
+        // Split the tag space into one contiguous range per rank.
+        uint64_t local_tag_end = n_local_tags > 0 ? uint64_t(local_tag[n_local_tags - 1]) + 1 : 0;
+        uint64_t tag_end;
+        MPI_Allreduce(&local_tag_end, &tag_end, 1, MPI_UINT64_T, MPI_MAX, m_mpi_communicator);
+        m_tags_per_rank = (tag_end + n_ranks - 1) / n_ranks;
+
+        // The local tags are sorted, so the tags sent to each owner are contiguous.
+        std::fill(m_send_counts.begin(), m_send_counts.end(), 0);
+        for (int i = 0; i < n_local_tags; i++)
+            {
+            m_send_counts[local_tag[i] / m_tags_per_rank]++;
+            }
+        m_n_local_tags = n_local_tags;
+
+        MPI_Alltoall(m_send_counts.data(),
+                     1,
+                     MPI_INT,
+                     m_exchange_counts.data(),
+                     1,
+                     MPI_INT,
+                     m_mpi_communicator);
+
+        // std::exclusive requires gcc10+:
+        // https://stackoverflow.com/questions/55771604/g-with-stdexclusive-scan-c17
+        m_send_displacements[0] = 0;
+        m_exchange_displacements[0] = 0;
+        for (int i = 1; i < n_ranks; i++)
+            {
+            m_send_displacements[i] = m_send_displacements[i - 1] + m_send_counts[i - 1];
+            m_exchange_displacements[i]
+                = m_exchange_displacements[i - 1] + m_exchange_counts[i - 1];
+            }
+        m_n_owned_tags = m_exchange_displacements[n_ranks - 1] + m_exchange_counts[n_ranks - 1];
+
+        // Send each tag to the rank that owns it.
+        m_owned_tags.resize(m_n_owned_tags);
+        MPI_Alltoallv(static_cast<void*>(local_tag),
+                      m_send_counts.data(),
+                      m_send_displacements.data(),
+                      MPI_UNSIGNED,
+                      static_cast<void*>(m_owned_tags.data()),
+                      m_exchange_counts.data(),
+                      m_exchange_displacements.data(),
+                      MPI_UNSIGNED,
+                      m_mpi_communicator);
+
+        // Sort the owned tags with a counting sort over the owned range. The output of this sort
+        // is a list that indicates the received index order in which to read exchanged arrays.
+        uint64_t range_begin = std::min(uint64_t(rank) * m_tags_per_rank, tag_end);
+        uint64_t range_end = std::min(range_begin + m_tags_per_rank, tag_end);
+        m_tag_slot.assign(range_end - range_begin, -1);
+        for (int i = 0; i < m_n_owned_tags; i++)
+            {
+            m_tag_slot[m_owned_tags[i] - range_begin] = i;
+            }
+
+        m_order.resize(0);
+        for (int slot : m_tag_slot)
+            {
+            if (slot >= 0)
+                {
+                m_order.push_back(slot);
+                }
+            }
+        assert(m_order.size() == static_cast<size_t>(m_n_owned_tags));
+
+        // Finally, determine where each rank's sorted range starts in the global array.
+        MPI_Gather(&m_n_owned_tags,
                    1,
                    MPI_INT,
                    m_recv_counts.data(),
@@ -577,63 +973,14 @@ class GatherTagOrder
                    m_root,
                    m_mpi_communicator);
 
-        unsigned int* gathered_tags = nullptr;
         if (rank == m_root)
             {
-            // std::exclusive requires gcc10+:
-            // https://stackoverflow.com/questions/55771604/g-with-stdexclusive-scan-c17
             m_displacements[0] = 0;
             for (size_t i = 1; i < m_displacements.size(); i++)
                 {
                 m_displacements[i] = m_displacements[i - 1] + m_recv_counts[i - 1];
                 }
             m_n_global_tags = m_displacements[n_ranks - 1] + m_recv_counts[n_ranks - 1];
-            gathered_tags = allocateGatherBuffer<unsigned int>(m_n_global_tags);
-            }
-
-        MPI_Gatherv(static_cast<void*>(local_tag),
-                    n_local_tags,
-                    MPI_UNSIGNED,
-                    static_cast<void*>(gathered_tags),
-                    m_recv_counts.data(),
-                    m_displacements.data(),
-                    MPI_UNSIGNED,
-                    m_root,
-                    m_mpi_communicator);
-
-        // Next, perform a k-way mergesort to sort the tags. The output of this sort is a
-        // list that indicates the global index order in which to read gathered arrays.
-        if (rank == m_root)
-            {
-            m_order.resize(0);
-            assert(m_sort_queue.empty());
-
-            for (int i = 0; i < n_ranks; i++)
-                {
-                if (m_recv_counts[i] > 0)
-                    {
-                    m_sort_queue.push(std::make_tuple(gathered_tags[m_displacements[i]], i, 0));
-                    }
-                }
-
-            while (!m_sort_queue.empty())
-                {
-                unsigned int item_rank = std::get<1>(m_sort_queue.top());
-                unsigned int local_index = std::get<2>(m_sort_queue.top());
-                unsigned int global_index = m_displacements[item_rank] + local_index;
-                m_order.push_back(global_index);
-
-                local_index++;
-                if (local_index < static_cast<unsigned int>(m_recv_counts[item_rank]))
-                    {
-                    m_sort_queue.push(
-                        std::make_tuple(gathered_tags[global_index + 1], item_rank, local_index));
-                    }
-
-                m_sort_queue.pop();
-                }
-
-            assert(m_order.size() == static_cast<size_t>(m_n_global_tags));
             }
         }
 
@@ -648,82 +995,176 @@ class GatherTagOrder
     template<class T>
     void gatherArray(std::vector<T>& global_array, const T* local_array, int local_size)
         {
-        int rank;
+        assert(local_size == m_n_local_tags);
 
+        int rank;
         MPI_Comm_rank(m_mpi_communicator, &rank);
 
-        T* gathered_array = nullptr;
+        MPI_Datatype mpi_type = detail::create_mpi_pod_type<T>();
+        T* sorted_array = sortOwnedValues(local_array, mpi_type);
+
+        // The sorted ranges are in rank order, so the root receives the global array in tag order.
+        global_array.resize(0);
         if (rank == m_root)
             {
-            gathered_array = allocateGatherBuffer<T>(m_n_global_tags);
-            std::transform(m_recv_counts.begin(),
-                           m_recv_counts.end(),
-                           m_recv_bytes.begin(),
-                           [](int v) { return v * sizeof(T); });
-            std::transform(m_displacements.begin(),
-                           m_displacements.end(),
-                           m_displacement_bytes.begin(),
-                           [](int v) { return v * sizeof(T); });
+            global_array.resize(m_n_global_tags);
             }
 
-        MPI_Gatherv((void*)(local_array),
-                    static_cast<int>(local_size * sizeof(T)),
-                    MPI_BYTE,
-                    (void*)(gathered_array),
-                    m_recv_bytes.data(),
-                    m_displacement_bytes.data(),
-                    MPI_BYTE,
+        MPI_Gatherv((void*)(sorted_array),
+                    m_n_owned_tags,
+                    mpi_type,
+                    (void*)(global_array.data()),
+                    m_recv_counts.data(),
+                    m_displacements.data(),
+                    mpi_type,
                     m_root,
                     m_mpi_communicator);
 
-        global_array.resize(0);
+        MPI_Type_free(&mpi_type);
+        }
+
+    /// Pass the values of a given local array to the root in tag order, one piece at a time
+    template<class T, class Func>
+    void gatherArrayInPieces(const std::vector<T>& local_array, const Func& process_piece)
+        {
+        gatherArrayInPieces(local_array.data(),
+                            static_cast<int>(local_array.size()),
+                            process_piece);
+        }
+
+    /// Pass the values of a given local array to the root in tag order, one piece at a time
+    /** \param local_array Local values in the order given to setLocalTagsSorted().
+        \param local_size Number of local values.
+        \param process_piece Callable process_piece(const T* values, int n) called on the root.
+
+        The root calls \a process_piece with consecutive pieces of the global array in tag order.
+        Each piece is the sorted range of one rank. All ranks must call gatherArrayInPieces().
+        \a process_piece must not throw, or the other ranks wait forever: record errors and report
+        them after gatherArrayInPieces() returns.
+    */
+    template<class T, class Func>
+    void gatherArrayInPieces(const T* local_array, int local_size, const Func& process_piece)
+        {
+        assert(local_size == m_n_local_tags);
+
+        int rank;
+        MPI_Comm_rank(m_mpi_communicator, &rank);
+
+        MPI_Datatype mpi_type = detail::create_mpi_pod_type<T>();
+        T* sorted_array = sortOwnedValues(local_array, mpi_type);
+
         if (rank == m_root)
             {
-            for (unsigned int i : m_order)
+            for (int source = 0; source < static_cast<int>(m_recv_counts.size()); source++)
                 {
-                global_array.push_back(gathered_array[i]);
+                if (source == m_root)
+                    {
+                    process_piece(sorted_array, m_n_owned_tags);
+                    }
+                else if (m_recv_counts[source] > 0)
+                    {
+                    T* piece = allocateBuffer<T>(m_piece_buffer, m_recv_counts[source]);
+                    MPI_Recv((void*)(piece),
+                             m_recv_counts[source],
+                             mpi_type,
+                             source,
+                             0,
+                             m_mpi_communicator,
+                             MPI_STATUS_IGNORE);
+                    process_piece(piece, m_recv_counts[source]);
+                    }
                 }
             }
+        else if (m_n_owned_tags > 0)
+            {
+            MPI_Send((void*)(sorted_array),
+                     m_n_owned_tags,
+                     mpi_type,
+                     m_root,
+                     0,
+                     m_mpi_communicator);
+            }
+
+        MPI_Type_free(&mpi_type);
         }
 
     private:
     MPI_Comm m_mpi_communicator;
     int m_root;
 
-    std::vector<int> m_recv_counts, m_recv_bytes;
-    std::vector<int> m_displacements, m_displacement_bytes;
+    /// Number of values this rank sends to each owner (and the offsets of the values).
+    std::vector<int> m_send_counts, m_send_displacements;
+
+    /// Number of values this rank receives from each rank for its range (and their offsets).
+    std::vector<int> m_exchange_counts, m_exchange_displacements;
+
+    /// Number of owned values from each rank gathered on the root (only set on root rank).
+    std::vector<int> m_recv_counts, m_displacements;
+
+    /// Index order in which to read the exchanged values.
     std::vector<unsigned int> m_order;
 
+    /// Tags received for the owned range.
+    std::vector<unsigned int> m_owned_tags;
+
+    /// Index of each tag in the owned range in m_owned_tags (-1 when not present).
+    std::vector<int> m_tag_slot;
+
+    /// Number of tags in the range owned by each rank.
+    uint64_t m_tags_per_rank = 0;
+
+    /// Number of local tags.
+    int m_n_local_tags = 0;
+
+    /// Number of tags in the range owned by this rank.
+    int m_n_owned_tags = 0;
+
     /// Number of global tags (only set on root rank).
-    unsigned int m_n_global_tags;
+    int m_n_global_tags = 0;
+
+    /// Buffer for the values received for the owned range.
+    std::vector<char> m_exchange_buffer;
 
-    /// Priority queue for k-way merge sort: tuple of tag, rank, local index
-    typedef std::tuple<unsigned int, unsigned int, unsigned int> queue_item;
-    std::priority_queue<queue_item, std::vector<queue_item>, std::greater<queue_item>> m_sort_queue;
+    /// Buffer for the owned values in tag order.
+    std::vector<char> m_sorted_buffer;
 
-    void* m_gather_buffer = nullptr;
-    size_t m_gather_buffer_size = 0;
+    /// Buffer for the range of one rank received by gatherArrayInPieces() (only used on root).
+    std::vector<char> m_piece_buffer;
 
-    /// Allocate or return an existing pointer to the gather buffer with space for n T objects.
-    template<class T> T* allocateGatherBuffer(int n)
+    /// Send each local value to the rank that owns its tag and sort the owned values by tag.
+    /** \returns The owned values in tag order (m_n_owned_tags values).
+     */
+    template<class T> T* sortOwnedValues(const T* local_array, MPI_Datatype mpi_type)
         {
-        size_t needed_bytes = sizeof(T) * n;
-        if (needed_bytes > m_gather_buffer_size)
+        T* exchanged_array = allocateBuffer<T>(m_exchange_buffer, m_n_owned_tags);
+        MPI_Alltoallv((void*)(local_array),
+                      m_send_counts.data(),
+                      m_send_displacements.data(),
+                      mpi_type,
+                      (void*)(exchanged_array),
+                      m_exchange_counts.data(),
+                      m_exchange_displacements.data(),
+                      mpi_type,
+                      m_mpi_communicator);
+
+        T* sorted_array = allocateBuffer<T>(m_sorted_buffer, m_n_owned_tags);
+        for (size_t i = 0; i < m_order.size(); i++)
             {
-            if (m_gather_buffer != nullptr)
-                {
-                free(m_gather_buffer);
-                }
-
-            m_gather_buffer = malloc(needed_bytes);
+            sorted_array[i] = exchanged_array[m_order[i]];
+            }
+        return sorted_array;
+        }
 
-            if (m_gather_buffer == nullptr)
-                {
-                throw std::bad_alloc();
-                }
+    /// Allocate or return an existing pointer to a buffer with space for n T objects.
+    template<class T> static T* allocateBuffer(std::vector<char>& buffer, int n)
+        {
+        size_t needed_bytes = sizeof(T) * n;
+        if (needed_bytes > buffer.size())
+            {
+            buffer.resize(needed_bytes);
             }
 
-        return static_cast<T*>(m_gather_buffer);
+        return reinterpret_cast<T*>(buffer.data());
         }
     };
     } // namespace hoomd
@@ -36,6 +36,9 @@ Integrator::Integrator(std::shared_ptr<SystemDefinition> sysdef, Scalar deltaT)
         m_comm->getCommFlagsRequestSignal().connect<Integrator, &Integrator::determineFlags>(this);
 
         m_comm->getComputeCallbackSignal().connect<Integrator, &Integrator::computeCallback>(this);
+
+        m_comm->getGhostUpdateOverlapSignal()
+            .connect<Integrator, &Integrator::ghostUpdateOverlapCallback>(this);
         }
 #endif
 
@@ -54,6 +57,9 @@ Integrator::~Integrator()
 
         m_comm->getComputeCallbackSignal().disconnect<Integrator, &Integrator::computeCallback>(
             this);
+
+        m_comm->getGhostUpdateOverlapSignal()
+            .disconnect<Integrator, &Integrator::ghostUpdateOverlapCallback>(this);
         }
 #endif
     }
@@ -165,13 +171,18 @@ vec3<double> Integrator::computeLinearMomentum()
 */
 void Integrator::computeNetForce(uint64_t timestep)
     {
+    ProfilerScope scope(m_exec_conf->getProfiler(), "computeNetForce");
+
+    // forces that add directly to the net force are computed after it is zeroed
+    auto is_fused = [this](const std::shared_ptr<ForceCompute>& force)
+    { return m_fuse_net_force && force->canAccumulateNetForce(); };
+
     for (auto& force : m_forces)
         {
-        force->compute(timestep);
+        if (!is_fused(force))
+            force->compute(timestep);
         }
 
-    Scalar external_virial[6];
-    Scalar external_energy;
         {
         // access the net force and virial arrays
         const GlobalArray<Scalar4>& net_force = m_pdata->getNetForce();
@@ -187,6 +198,26 @@ void Integrator::computeNetForce(uint64_t timestep)
         memset((void*)h_net_force.data, 0, sizeof(Scalar4) * net_force.getNumElements());
         memset((void*)h_net_virial.data, 0, sizeof(Scalar) * net_virial.getNumElements());
         memset((void*)h_net_torque.data, 0, sizeof(Scalar4) * net_torque.getNumElements());
+        }
+
+    for (auto& force : m_forces)
+        {
+        if (is_fused(force))
+            force->computeIntoNetForce(timestep);
+        }
+
+    Scalar external_virial[6];
+    Scalar external_energy;
+        {
+        // access the net force and virial arrays
+        const GlobalArray<Scalar4>& net_force = m_pdata->getNetForce();
+        const GlobalArray<Scalar>& net_virial = m_pdata->getNetVirial();
+        const GlobalArray<Scalar4>& net_torque = m_pdata->getNetTorqueArray();
+        ArrayHandle<Scalar4> h_net_force(net_force, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_net_torque(net_torque,
+                                          access_location::host,
+                                          access_mode::readwrite);
 
         for (unsigned int i = 0; i < 6; ++i)
             external_virial[i] = Scalar(0.0);
@@ -204,6 +235,17 @@ void Integrator::computeNetForce(uint64_t timestep)
 
         for (const auto& force : m_forces)
             {
+            for (unsigned int k = 0; k < 6; k++)
+                {
+                external_virial[k] += force->getExternalVirial(k);
+                }
+
+            external_energy += force->getExternalEnergy();
+
+            // fused forces have already added their contribution
+            if (is_fused(force))
+                continue;
+
             const GlobalArray<Scalar4>& h_force_array = force->getForceArray();
             const GlobalArray<Scalar>& h_virial_array = force->getVirialArray();
             const GlobalArray<Scalar4>& h_torque_array = force->getTorqueArray();
@@ -235,13 +277,6 @@ void Integrator::computeNetForce(uint64_t timestep)
                         += h_virial.data[k * virial_pitch + j];
                     }
                 }
-
-            for (unsigned int k = 0; k < 6; k++)
-                {
-                external_virial[k] += force->getExternalVirial(k);
-                }
-
-            external_energy += force->getExternalEnergy();
             }
         }
 
@@ -348,6 +383,8 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         throw runtime_error("Cannot compute net force on the GPU if CUDA is disabled.");
         }
 
+    ProfilerScope scope(m_exec_conf->getProfiler(), "computeNetForce");
+
     // compute all the normal forces first
 
     for (auto& force : m_forces)
@@ -868,6 +905,26 @@ void Integrator::computeCallback(uint64_t timestep)
         force->preCompute(timestep);
         }
     }
+
+/*! Forces that will add directly to the net force are computed later in computeNetForce().
+ */
+void Integrator::ghostUpdateOverlapCallback(uint64_t timestep)
+    {
+    if (!m_overlap_communication)
+        return;
+
+    ProfilerScope scope(m_exec_conf->getProfiler(), "computeInteriorForces");
+
+    for (auto& force : m_forces)
+        {
+        if (force->canComputeInteriorForces()
+            && !(m_fuse_net_force && force->canAccumulateNetForce()))
+            {
+            force->computeInteriorForces(timestep);
+            }
+        }
+    }
+
 #endif
 
 bool Integrator::areForcesAnisotropic()
@@ -897,6 +954,10 @@ void export_Integrator(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
         .def("updateGroupDOF", &Integrator::updateGroupDOF)
         .def_property("dt", &Integrator::getDeltaT, &Integrator::setDeltaT)
+        .def_property("fuse_net_force", &Integrator::getFuseNetForce, &Integrator::setFuseNetForce)
+        .def_property("overlap_communication",
+                      &Integrator::getOverlapCommunication,
+                      &Integrator::setOverlapCommunication)
         .def_property_readonly("forces", &Integrator::getForces)
         .def_property_readonly("constraints", &Integrator::getConstraintForces)
         .def("computeLinearMomentum", &Integrator::computeLinearMomentum);
@@ -36,7 +36,11 @@ namespace hoomd
     this way.
 
     All forces added to m_forces are computed independently and then totaled up to calculate the net
-    force and energy on each particle. Constraint forces (ForceConstraint) are unique in that they
+    force and energy on each particle. When m_fuse_net_force is set, forces that support it
+    (ForceCompute::canAccumulateNetForce) add their contribution directly to the net force on the
+    CPU instead. When m_overlap_communication is set in MPI simulations, forces that support it
+    (ForceCompute::canComputeInteriorForces) compute the forces between local particles while the
+    Communicator updates the ghost particle positions. Constraint forces (ForceConstraint) are unique in that they
     need to be computed \b after the net forces is already available. To implement this behavior,
     add constraint forces to m_constraint_forces through getConstraintForces. All constraint forces
     will be computed independently and will be able to read the current unconstrained net force.
@@ -93,6 +97,30 @@ class PYBIND11_EXPORT Integrator : public Updater
         return m_half_step_hook;
         }
 
+    /// Set whether forces that support it add directly to the net force
+    void setFuseNetForce(bool fuse_net_force)
+        {
+        m_fuse_net_force = fuse_net_force;
+        }
+
+    /// Get whether forces that support it add directly to the net force
+    bool getFuseNetForce()
+        {
+        return m_fuse_net_force;
+        }
+
+    /// Set whether forces that support it overlap computation with the ghost update
+    void setOverlapCommunication(bool overlap_communication)
+        {
+        m_overlap_communication = overlap_communication;
+        }
+
+    /// Get whether forces that support it overlap computation with the ghost update
+    bool getOverlapCommunication()
+        {
+        return m_overlap_communication;
+        }
+
     /// Change the timestep
     virtual void setDeltaT(Scalar deltaT);
 
@@ -139,6 +167,9 @@ class PYBIND11_EXPORT Integrator : public Updater
 #ifdef ENABLE_MPI
     /// Callback for pre-computing the forces
     void computeCallback(uint64_t timestep);
+
+    /// Callback for computing the interior forces during the ghost update
+    virtual void ghostUpdateOverlapCallback(uint64_t timestep);
 #endif
 
     /// Reset stats counters for children objects
@@ -189,6 +220,12 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// The HalfStepHook, if active
     std::shared_ptr<HalfStepHook> m_half_step_hook;
 
+    /// When true, computeNetForce lets forces that support it add directly to the net force
+    bool m_fuse_net_force = false;
+
+    /// When true, forces that support it compute interior forces during the ghost update
+    bool m_overlap_communication = false;
+
     /// helper function to compute initial accelerations
     void computeAccelerations(uint64_t timestep);
 
@@ -34,7 +34,10 @@ LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
 #endif
       m_max_imbalance(Scalar(1.0)), m_recompute_max_imbalance(true), m_needs_migrate(false),
       m_needs_recount(false), m_tolerance(Scalar(1.05)), m_maxiter(1), m_max_scale(Scalar(0.05)),
-      m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0),
+      m_weight_by_time(false), m_load_own(m_pdata->getN()), m_local_load(m_pdata->getN()),
+      m_cost_per_particle(1.0),
+      m_total_load(m_pdata->getNGlobal()), m_last_compute_time(sysdef->getForceComputeTime()),
+      m_time_imbalance(1.0), m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0),
       m_n_iterations(0), m_n_rebalances(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing LoadBalancer" << endl;
@@ -81,8 +84,8 @@ void LoadBalancer::update(uint64_t timestep)
     if (!m_sysdef->isDomainDecomposed())
         return;
 
-    // no adjustment has been made yet, so set m_N_own to the number of particles on the rank
-    resetNOwn(m_pdata->getN());
+    // no adjustment has been made yet, so measure the load on the rank since the last update
+    measureLoad();
 
     // figure out which rank is the reduction root for broadcasting
     const Index3D& di = m_decomposition->getDomainIndexer();
@@ -139,17 +142,17 @@ void LoadBalancer::update(uint64_t timestep)
                 min_frac_i = min_domain_frac.z;
                 }
 
-            vector<unsigned int> N_i;
+            vector<double> load_i;
             bool adjusted = false;
 
-            // reduce the number of particles in the slice along dim
-            bool active = reduce(N_i, dim, reduce_root);
+            // reduce the load in the slice along dim
+            bool active = reduce(load_i, dim, reduce_root);
 
             // attempt an adjustment
             vector<Scalar> cum_frac = m_decomposition->getCumulativeFractions(dim);
             if (active)
                 {
-                adjusted = adjust(cum_frac, N_i, L_i, min_frac_i);
+                adjusted = adjust(cum_frac, load_i, L_i, min_frac_i);
                 }
 
             // broadcast if an adjustment has been made on the root
@@ -167,9 +170,17 @@ void LoadBalancer::update(uint64_t timestep)
         // force a particle migration if one is needed
         if (m_needs_migrate)
             {
+            // count the load that the new domains will own before the particles move
+            computeOwnedParticles();
+
             m_comm->forceMigrate();
             m_comm->communicate(timestep);
-            resetNOwn(m_pdata->getN());
+
+            // the particles that arrived carry the cost of the ranks they came from
+            unsigned int N = m_pdata->getN();
+            m_local_load = m_load_own;
+            m_cost_per_particle = (N > 0) ? m_local_load / double(N) : 0.0;
+            resetLoad(m_local_load);
             m_needs_migrate = false;
 
             // increment the number of rebalances actually performed
@@ -182,15 +193,53 @@ void LoadBalancer::update(uint64_t timestep)
 #ifdef ENABLE_MPI
 
 /*!
- * Computes the imbalance factor I = N / <N> for each rank, and computes the maximum among all
+ * Measures the force compute time since the last balancing step on each rank and sets the load
+ * of the rank to either the number of particles it owns or to that time. Falls back to the number
+ * of particles when no ForceCompute has measured any time (e.g. on the first step).
+ *
+ * \note All ranks must call measureLoad() since it performs collective reductions.
+ */
+void LoadBalancer::measureLoad()
+    {
+    int64_t compute_time = m_sysdef->getForceComputeTime();
+    double elapsed = double(compute_time - m_last_compute_time);
+    m_last_compute_time = compute_time;
+
+    double total_time(0.0), max_time(0.0);
+    MPI_Allreduce(&elapsed, &total_time, 1, MPI_DOUBLE, MPI_SUM, m_mpi_comm);
+    MPI_Allreduce(&elapsed, &max_time, 1, MPI_DOUBLE, MPI_MAX, m_mpi_comm);
+
+    m_time_imbalance = Scalar(1.0);
+    if (total_time > 0)
+        {
+        m_time_imbalance = Scalar(max_time / (total_time / double(m_exec_conf->getNRanks())));
+        }
+
+    unsigned int N = m_pdata->getN();
+    if (m_weight_by_time && total_time > 0)
+        {
+        m_local_load = elapsed;
+        m_cost_per_particle = (N > 0) ? elapsed / double(N) : 0.0;
+        m_total_load = total_time;
+        }
+    else
+        {
+        m_local_load = double(N);
+        m_cost_per_particle = 1.0;
+        m_total_load = double(m_pdata->getNGlobal());
+        }
+    resetLoad(m_local_load);
+    }
+
+/*!
+ * Computes the imbalance factor I = L / <L> for each rank, and computes the maximum among all
  * ranks.
  */
 Scalar LoadBalancer::getMaxImbalance()
     {
     if (m_recompute_max_imbalance)
         {
-        Scalar cur_imb = Scalar(getNOwn())
-                         / (Scalar(m_pdata->getNGlobal()) / Scalar(m_exec_conf->getNRanks()));
+        Scalar cur_imb = Scalar(getLoad() / (m_total_load / double(m_exec_conf->getNRanks())));
         Scalar max_imb(0.0);
         MPI_Allreduce(&cur_imb, &max_imb, 1, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
 
@@ -205,12 +254,12 @@ Scalar LoadBalancer::getMaxImbalance()
     }
 
 /*!
- * \param N_i Vector holding the total number of particles in each slice (will be allocated on call)
+ * \param N_i Vector holding the total load in each slice (will be allocated on call)
  * \param dim The dimension of the slices (x=0, y=1, z=2)
  * \param reduce_root The rank to perform the reduction on
  * \returns true if the current rank holds the active \a N_i
  *
- * \post \a N_i holds the number of particles in each slice along \a dim
+ * \post \a N_i holds the load in each slice along \a dim
  *
  * \note reduce() relies on collective MPI calls, and so all ranks must call it. However, for
  * efficiency the data will be active only on Cartesian rank \a reduce_root, as indicated by the
@@ -221,21 +270,19 @@ Scalar LoadBalancer::getMaxImbalance()
  * replaced by cascading send operations down dimensions. Generally, load balancing should not be
  * performed too frequently, and so we do not pursue this optimization right now.
  */
-bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
-                          unsigned int dim,
-                          unsigned int reduce_root)
+bool LoadBalancer::reduce(std::vector<double>& N_i, unsigned int dim, unsigned int reduce_root)
     {
     // do nothing if there is only one rank
     if (N_i.size() == 1)
         return false;
 
     const Index3D& di = m_decomposition->getDomainIndexer();
-    std::vector<unsigned int> N_per_rank(di.getNumElements());
+    std::vector<double> N_per_rank(di.getNumElements());
 
-    // get the number of particles the current rank owns (the quantity to be reduced)
-    unsigned int N_own = getNOwn();
+    // get the load the current rank owns (the quantity to be reduced)
+    double N_own = getLoad();
 
-    MPI_Gather(&N_own, 1, MPI_UNSIGNED, &N_per_rank[0], 1, MPI_UNSIGNED, reduce_root, m_mpi_comm);
+    MPI_Gather(&N_own, 1, MPI_DOUBLE, &N_per_rank[0], 1, MPI_DOUBLE, reduce_root, m_mpi_comm);
 
     // only the root rank performs the reduction
     if (m_exec_conf->getRank() != reduce_root)
@@ -245,7 +292,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
     ArrayHandle<unsigned int> h_cart_ranks_inv(m_decomposition->getInverseCartRanks(),
                                                access_location::host,
                                                access_mode::read);
-    std::vector<unsigned int> N_per_cart_rank(di.getNumElements());
+    std::vector<double> N_per_cart_rank(di.getNumElements());
     for (unsigned int cur_rank = 0; cur_rank < di.getNumElements(); ++cur_rank)
         {
         N_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = N_per_rank[cur_rank];
@@ -310,7 +357,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
 
 /*!
  * \param cum_frac_i The cumulative fraction array to write output into
- * \param N_i The reduced number of particles along the dimension
+ * \param N_i The reduced load along the dimension
  * \param L_i The global box length along the dimension
  * \param min_frac_i The minimum fractional width of a domain
  *
@@ -329,15 +376,15 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
  * minimization was successful, apply the adjustment to \a cum_frac_i.
  */
 bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
-                          const vector<unsigned int>& N_i,
+                          const vector<double>& N_i,
                           Scalar L_i,
                           Scalar min_frac_i)
     {
     if (N_i.size() == 1)
         return false;
 
-    // target particles per rank is uniform distribution
-    const Scalar target = Scalar(m_pdata->getNGlobal()) / Scalar(N_i.size());
+    // target load per rank is uniform distribution
+    const Scalar target = Scalar(m_total_load / double(N_i.size()));
 
     // make the minimum domain slightly bigger so that the optimization won't fail at equality
     const Scalar min_domain_size = Scalar(1.00001) * min_frac_i * L_i;
@@ -538,8 +585,9 @@ void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& c
 
 /*!
  * Each rank calls countParticlesOffRank() to count the number of particles to send to other ranks.
- * Neighboring ranks then perform send/receive calls, and count the new number of particles they own
- * as the number they owned locally plus the number received minus the number sent.
+ * Neighboring ranks then perform send/receive calls, and compute the new load they own as the load
+ * they owned locally plus the load received minus the load sent. Each particle carries the cost per
+ * particle of the rank it is sent from.
  *
  * \note All ranks must participate in this call since it involves send/receive operations between
  * neighboring domains.
@@ -568,23 +616,23 @@ void LoadBalancer::computeOwnedParticles()
     MPI_Status stat[2 * m_comm->getNUniqueNeighbors()];
     unsigned int nreq = 0;
 
-    unsigned int n_send_ptls[m_comm->getNUniqueNeighbors()];
-    unsigned int n_recv_ptls[m_comm->getNUniqueNeighbors()];
+    double send_load[m_comm->getNUniqueNeighbors()];
+    double recv_load[m_comm->getNUniqueNeighbors()];
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
         unsigned int neigh_rank = h_unique_neigh.data[cur_neigh];
-        n_send_ptls[cur_neigh] = cnts[neigh_rank];
+        send_load[cur_neigh] = double(cnts[neigh_rank]) * m_cost_per_particle;
 
-        MPI_Isend(&n_send_ptls[cur_neigh],
+        MPI_Isend(&send_load[cur_neigh],
                   1,
-                  MPI_UNSIGNED,
+                  MPI_DOUBLE,
                   neigh_rank,
                   0,
                   m_mpi_comm,
                   &req[nreq++]);
-        MPI_Irecv(&n_recv_ptls[cur_neigh],
+        MPI_Irecv(&recv_load[cur_neigh],
                   1,
-                  MPI_UNSIGNED,
+                  MPI_DOUBLE,
                   neigh_rank,
                   0,
                   m_mpi_comm,
@@ -592,20 +640,50 @@ void LoadBalancer::computeOwnedParticles()
         }
     MPI_Waitall(nreq, req, stat);
 
-    // reduce the particles sent to me
-    int N_own = m_pdata->getN();
+    // reduce the load sent to me
+    double load = m_local_load;
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
-        N_own += n_recv_ptls[cur_neigh];
-        N_own -= n_send_ptls[cur_neigh];
+        load += recv_load[cur_neigh];
+        load -= send_load[cur_neigh];
         }
 
-    // set the count
-    resetNOwn(N_own);
+    // set the load
+    resetLoad(load);
     }
 
 #endif // ENABLE_MPI
 
+/*!
+ * \param weight "particles" to balance the number of particles or "time" to balance the measured
+ * force compute time
+ */
+void LoadBalancer::setWeightPython(const std::string& weight)
+    {
+    if (weight == "particles")
+        {
+        m_weight_by_time = false;
+        }
+    else if (weight == "time")
+        {
+        // kernel launches are asynchronous, so the measured time does not reflect the GPU load
+        if (m_exec_conf->isCUDAEnabled())
+            {
+            throw std::invalid_argument("LoadBalancer: weight='time' is not supported on the GPU");
+            }
+        m_weight_by_time = true;
+        }
+    else
+        {
+        throw std::invalid_argument("LoadBalancer: invalid weight " + weight);
+        }
+    }
+
+std::string LoadBalancer::getWeightPython()
+    {
+    return m_weight_by_time ? "time" : "particles";
+    }
+
 /*!
  * Zero the counters.
  */
@@ -628,7 +706,9 @@ void export_LoadBalancer(pybind11::module& m)
                       &LoadBalancer::setMaxIterations)
         .def_property("x", &LoadBalancer::getEnableX, &LoadBalancer::setEnableX)
         .def_property("y", &LoadBalancer::getEnableY, &LoadBalancer::setEnableY)
-        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ);
+        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ)
+        .def_property("weight", &LoadBalancer::getWeightPython, &LoadBalancer::setWeightPython)
+        .def_property_readonly("time_imbalance", &LoadBalancer::getTimeImbalance);
     }
 
     } // end namespace detail
@@ -24,8 +24,14 @@ namespace hoomd
 //! Updates domain decompositions to balance the load
 /*!
  * Adjusts the boundaries of the processor domains to distribute the load close to evenly between
- * them. The load imbalance is defined as the number of particles owned by a rank divided by the
- * average number of particles per rank if the particles had a uniform distribution.
+ * them. The load imbalance is defined as the load of a rank divided by the average load per rank.
+ *
+ * By default, the load of a rank is the number of particles it owns. When weighting by time, the
+ * load is the wall clock time the rank spent computing forces since the last balancing step
+ * (SystemDefinition::getForceComputeTime). Each rank assigns that time uniformly to its particles,
+ * and particles that would move to a neighboring domain carry their cost with them. This balances
+ * systems where the cost per particle varies in space, such as interfaces between dense and dilute
+ * phases.
  *
  * At each load balancing step, we attempt to rescale the domain size by the inverse of the load
  * balance, subject to the following constraints that are imposed to both maintain a stable
@@ -136,6 +142,20 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_enable_z;
         }
 
+    /// Set the quantity that defines the load of a rank ("particles" or "time")
+    void setWeightPython(const std::string& weight);
+
+    /// Get the quantity that defines the load of a rank
+    std::string getWeightPython();
+
+    /// Get the maximum force compute time of any rank divided by the average
+    /*! Measured over the interval between the last two balancing steps.
+     */
+    Scalar getTimeImbalance() const
+        {
+        return m_time_imbalance;
+        }
+
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
@@ -155,8 +175,11 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Computes the maximum imbalance factor
     Scalar getMaxImbalance();
 
-    //! Reduce the particle numbers per rank down to one dimension
-    bool reduce(std::vector<unsigned int>& N_i, unsigned int dim, unsigned int reduce_root);
+    //! Measure the load of each rank at the start of a balancing step
+    void measureLoad();
+
+    //! Reduce the load per rank down to one dimension
+    bool reduce(std::vector<double>& N_i, unsigned int dim, unsigned int reduce_root);
 
     //! Set flags within the class that a resize has been performed
     void signalResize()
@@ -168,30 +191,30 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     //! Adjust the partitioning along a single dimension
     bool adjust(std::vector<Scalar>& cum_frac_i,
-                const std::vector<unsigned int>& N_i,
+                const std::vector<double>& N_i,
                 Scalar L_i,
                 Scalar min_domain_frac);
 
-    //! Compute the number of particles on each rank after an adjustment
+    //! Compute the load of each rank after an adjustment
     void computeOwnedParticles();
 
     //! Count the number of particles that have gone off the rank
     virtual void countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts);
 
-    //! Gets the number of owned particles, updating if necessary
-    unsigned int getNOwn()
+    //! Gets the load of the particles owned by this rank, updating if necessary
+    double getLoad()
         {
         computeOwnedParticles();
-        return m_N_own;
+        return m_load_own;
         }
 
-    //! Force a reset of the number of owned particles without counting
+    //! Force a reset of the load without counting
     /*!
-     * \param N number of particles owned by the rank
+     * \param load Load of the particles owned by the rank
      */
-    void resetNOwn(unsigned int N)
+    void resetLoad(double load)
         {
-        m_N_own = N;
+        m_load_own = load;
         m_recompute_max_imbalance = true;
         m_needs_recount = false;
         }
@@ -211,8 +234,15 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     const Scalar m_max_scale; //!< Maximum fraction to rescale either direction (5%)
 
+    bool m_weight_by_time; //!< Flag to use the force compute time as the load
+
     private:
-    unsigned int m_N_own; //!< Number of particles owned by this rank
+    double m_load_own;           //!< Load of the particles owned by this rank
+    double m_local_load;         //!< Load of the particles currently in the local particle data
+    double m_cost_per_particle;  //!< Load of each particle currently in the local particle data
+    double m_total_load;         //!< Sum of the load over all ranks
+    int64_t m_last_compute_time; //!< Force compute time at the last balancing step (ns)
+    Scalar m_time_imbalance;     //!< Max force compute time over the average at the last step
 
     Scalar m_max_max_imbalance;   //!< The maximum imbalance of any check
     double m_total_max_imbalance; //!< The average imbalance over checks
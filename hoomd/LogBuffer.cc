@@ -0,0 +1,171 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file LogBuffer.cc
+    \brief Defines the LogBuffer class
+*/
+
+#include "LogBuffer.h"
+
+#include <algorithm>
+#include <pybind11/numpy.h>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to sample
+    \param capacity Number of samples to store
+*/
+LogBuffer::LogBuffer(std::shared_ptr<SystemDefinition> sysdef,
+                     std::shared_ptr<Trigger> trigger,
+                     unsigned int capacity)
+    : Analyzer(sysdef, trigger), m_capacity(capacity)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing LogBuffer" << endl;
+
+    if (m_capacity == 0)
+        throw runtime_error("LogBuffer capacity must be positive.");
+
+    m_timesteps.resize(2 * size_t(m_capacity));
+    }
+
+LogBuffer::~LogBuffer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying LogBuffer" << endl;
+    }
+
+/*! \param action Action that registered the quantity
+    \param name Name of the quantity
+
+    Quantities can only be added to an empty buffer.
+*/
+void LogBuffer::addQuantity(std::shared_ptr<Action> action, const std::string& name)
+    {
+    if (m_n_samples > 0)
+        throw runtime_error("Cannot add quantities to a LogBuffer that holds samples.");
+
+    Column column;
+    column.quantity = action->getLoggable(name);
+    column.owner = action;
+
+    size_t n = 2 * size_t(m_capacity) * column.quantity.width;
+    if (column.quantity.get_int)
+        column.ints.resize(n);
+    else
+        column.floats.resize(n);
+
+    m_quantities.push_back(std::move(column));
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Evaluates the getter of every quantity directly into the ring buffer, then mirrors the sample
+    into the second half of the buffer.
+*/
+void LogBuffer::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    // let Python flush before overwriting samples it has not seen
+    if (m_n_unflushed == m_capacity && m_flush_callback && !m_flush_callback.is_none())
+        {
+        m_flush_callback();
+        m_n_unflushed = 0;
+        }
+
+    const size_t slot = m_n_samples % m_capacity;
+    m_timesteps[slot] = timestep;
+    m_timesteps[slot + m_capacity] = timestep;
+
+    for (Column& column : m_quantities)
+        {
+        const size_t width = column.quantity.width;
+        const size_t first = slot * width;
+        const size_t mirror = (slot + m_capacity) * width;
+        if (column.quantity.get_int)
+            {
+            column.quantity.get_int(timestep, &column.ints[first]);
+            std::copy_n(&column.ints[first], width, &column.ints[mirror]);
+            }
+        else
+            {
+            column.quantity.get_float(timestep, &column.floats[first]);
+            std::copy_n(&column.floats[first], width, &column.floats[mirror]);
+            }
+        }
+
+    m_n_samples++;
+    if (m_n_unflushed < m_capacity)
+        m_n_unflushed++;
+    }
+
+PDataFlags LogBuffer::getRequestedPDataFlags()
+    {
+    PDataFlags flags;
+    flags[pdata_flag::pressure_tensor] = 1;
+    flags[pdata_flag::rotational_kinetic_energy] = 1;
+    flags[pdata_flag::external_field_virial] = 1;
+    return flags;
+    }
+
+/*! \returns A numpy array of shape (N,) that references the stored timesteps in chronological
+    order. The array is only valid until the next sample.
+*/
+pybind11::object LogBuffer::getTimestepsNP(pybind11::object self)
+    {
+    auto self_cpp = self.cast<LogBuffer*>();
+    return pybind11::array(self_cpp->getNStored(),
+                           self_cpp->m_timesteps.data() + self_cpp->getFirstSlot(),
+                           self);
+    }
+
+/*! \param i Index of the quantity
+    \returns A numpy array of shape (N, width) that references the stored samples in chronological
+    order. The array is only valid until the next sample.
+*/
+pybind11::object LogBuffer::getDataNP(pybind11::object self, unsigned int i)
+    {
+    auto self_cpp = self.cast<LogBuffer*>();
+    if (i >= self_cpp->m_quantities.size())
+        throw runtime_error("Quantity index out of range.");
+
+    const Column& column = self_cpp->m_quantities[i];
+    std::vector<size_t> dims(2);
+    dims[0] = self_cpp->getNStored();
+    dims[1] = column.quantity.width;
+    size_t offset = size_t(self_cpp->getFirstSlot()) * column.quantity.width;
+
+    if (column.quantity.get_int)
+        return pybind11::array(dims, column.ints.data() + offset, self);
+    return pybind11::array(dims, column.floats.data() + offset, self);
+    }
+
+namespace detail
+    {
+void export_LogBuffer(pybind11::module& m)
+    {
+    pybind11::class_<LogBuffer, Analyzer, std::shared_ptr<LogBuffer>>(m, "LogBuffer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            unsigned int>())
+        .def("addQuantity", &LogBuffer::addQuantity)
+        .def("markFlushed", &LogBuffer::markFlushed)
+        .def("setFlushCallback", &LogBuffer::setFlushCallback)
+        .def("clear", &LogBuffer::clear)
+        .def("getWidth", &LogBuffer::getWidth)
+        .def("isInteger", &LogBuffer::isInteger)
+        .def("getData", &LogBuffer::getDataNP)
+        .def_property_readonly("timesteps", &LogBuffer::getTimestepsNP)
+        .def_property_readonly("capacity", &LogBuffer::getCapacity)
+        .def_property_readonly("num_quantities", &LogBuffer::getNQuantities)
+        .def_property_readonly("num_samples", &LogBuffer::getNSamples)
+        .def_property_readonly("num_stored", &LogBuffer::getNStored)
+        .def_property_readonly("num_unflushed", &LogBuffer::getNUnflushed);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
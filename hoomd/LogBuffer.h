@@ -0,0 +1,157 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file LogBuffer.h
+    \brief Declares the LogBuffer class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "Analyzer.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <string>
+#include <vector>
+
+namespace hoomd
+    {
+/// Sample loggable quantities into in-memory ring buffers
+/*! LogBuffer samples the quantities that actions register with Action::registerLoggable() directly
+    in C++. Logging a quantity costs one call to its getter and does not call into Python.
+
+    Each quantity is stored in a ring buffer that holds the last *capacity* samples. The ring
+    buffers are mirrored: every sample is written to slot i and slot i + capacity, so the most
+    recent samples are always contiguous in memory and Python can access them in chronological order
+    without a copy.
+
+    Python may set a flush callback. LogBuffer calls it (once every *capacity* samples) before it
+    would overwrite samples that have not been flushed. The callback reads the unflushed samples and
+    LogBuffer marks them flushed when the callback returns.
+
+    The getters of most quantities perform MPI reductions. LogBuffer samples on all ranks and every
+    rank stores the same values.
+*/
+class PYBIND11_EXPORT LogBuffer : public Analyzer
+    {
+    public:
+    /// Construct the buffer
+    LogBuffer(std::shared_ptr<SystemDefinition> sysdef,
+              std::shared_ptr<Trigger> trigger,
+              unsigned int capacity);
+
+    /// Destructor
+    virtual ~LogBuffer();
+
+    /// Sample all quantities
+    virtual void analyze(uint64_t timestep);
+
+    /// Request the flags needed by the thermodynamic quantities
+    virtual PDataFlags getRequestedPDataFlags();
+
+    /// Add a quantity of an action to the buffer
+    void addQuantity(std::shared_ptr<Action> action, const std::string& name);
+
+    /// Get the number of quantities in the buffer
+    unsigned int getNQuantities() const
+        {
+        return (unsigned int)m_quantities.size();
+        }
+
+    /// Get the maximum number of samples stored
+    unsigned int getCapacity() const
+        {
+        return m_capacity;
+        }
+
+    /// Get the total number of samples taken
+    uint64_t getNSamples() const
+        {
+        return m_n_samples;
+        }
+
+    /// Get the number of samples stored
+    unsigned int getNStored() const
+        {
+        return m_n_samples < m_capacity ? (unsigned int)m_n_samples : m_capacity;
+        }
+
+    /// Get the number of stored samples that have not been flushed
+    unsigned int getNUnflushed() const
+        {
+        return m_n_unflushed;
+        }
+
+    /// Mark all stored samples as flushed
+    void markFlushed()
+        {
+        m_n_unflushed = 0;
+        }
+
+    /// Set the function to call before overwriting unflushed samples
+    void setFlushCallback(pybind11::object callback)
+        {
+        m_flush_callback = callback;
+        }
+
+    /// Discard all samples
+    void clear()
+        {
+        m_n_samples = 0;
+        m_n_unflushed = 0;
+        }
+
+    /// Get the width of a quantity
+    unsigned int getWidth(unsigned int i) const
+        {
+        return m_quantities[i].quantity.width;
+        }
+
+    /// Check whether a quantity stores integers
+    bool isInteger(unsigned int i) const
+        {
+        return bool(m_quantities[i].quantity.get_int);
+        }
+
+    /// Get a numpy array that references the stored timesteps
+    static pybind11::object getTimestepsNP(pybind11::object self);
+
+    /// Get a numpy array that references the stored samples of a quantity
+    static pybind11::object getDataNP(pybind11::object self, unsigned int i);
+
+    protected:
+    /// A quantity and its ring buffer
+    struct Column
+        {
+        LoggableQuantity quantity;     //!< Getters of the quantity
+        std::shared_ptr<Action> owner; //!< Action that owns the getters
+        std::vector<double> floats;    //!< Ring buffer of floating point quantities
+        std::vector<int64_t> ints;     //!< Ring buffer of integer quantities
+        };
+
+    /// Index of the slot that holds the oldest stored sample
+    unsigned int getFirstSlot() const
+        {
+        return (unsigned int)((m_n_samples - getNStored()) % m_capacity);
+        }
+
+    unsigned int m_capacity;           //!< Number of samples stored
+    uint64_t m_n_samples = 0;          //!< Total number of samples taken
+    unsigned int m_n_unflushed = 0;    //!< Number of samples that have not been flushed
+    std::vector<uint64_t> m_timesteps; //!< Ring buffer of timesteps
+    std::vector<Column> m_quantities;  //!< Sampled quantities
+    pybind11::object m_flush_callback; //!< Function that flushes the samples
+    };
+
+namespace detail
+    {
+/// Export LogBuffer to python
+void export_LogBuffer(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
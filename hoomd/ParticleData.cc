@@ -6,6 +6,7 @@
  */
 
 #include "ParticleData.h"
+#include "Checkpoint.h"
 
 #ifdef ENABLE_MPI
 #include "HOOMDMPI.h"
@@ -19,6 +20,7 @@
 #include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
 #include <iostream>
@@ -1059,11 +1061,8 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                                                    access_location::host,
                                                    access_mode::read);
 
-            const Index3D& di = m_decomposition->getDomainIndexer();
             unsigned int n_ranks = m_exec_conf->getNRanks();
 
-            BoxDim global_box = *m_global_box;
-
             // loop over particles in snapshot, place them into domains
             for (typename std::vector<vec3<Real>>::const_iterator it = snapshot.pos.begin();
                  it != snapshot.pos.end();
@@ -1080,46 +1079,12 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
 
                 // determine domain the particle is placed into
                 Scalar3 pos = vec_to_scalar3(*it);
-                Scalar3 f = m_global_box->makeFraction(pos);
-                int i = int(f.x * ((Scalar)di.getW()));
-                int j = int(f.y * ((Scalar)di.getH()));
-                int k = int(f.z * ((Scalar)di.getD()));
-
-                // wrap particles that are exactly on a boundary
-                // we only need to wrap in the negative direction, since
-                // processor ids are rounded toward zero
-                char3 flags = make_char3(0, 0, 0);
-                if (i == (int)di.getW())
-                    {
-                    i = 0;
-                    flags.x = 1;
-                    }
-
-                if (j == (int)di.getH())
-                    {
-                    j = 0;
-                    flags.y = 1;
-                    }
-
-                if (k == (int)di.getD())
-                    {
-                    k = 0;
-                    flags.z = 1;
-                    }
-
                 int3 img = snapshot.image[snap_idx];
-
-                // only wrap if the particles is on one of the boundaries
-                uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
-                global_box.setPeriodic(periodic);
-                global_box.wrap(pos, img, flags);
-
-                // place particle using actual domain fractions, not global box fraction
-                unsigned int rank
-                    = m_decomposition->placeParticle(global_box, pos, h_cart_ranks.data);
+                unsigned int rank = findParticleRank(pos, img, h_cart_ranks.data);
 
                 if (rank >= n_ranks)
                     {
+                    Scalar3 f = m_global_box->makeFraction(pos);
                     ostringstream s;
                     s << "init.*: Particle " << snap_idx << " out of bounds." << std::endl;
                     s << "Cartesian coordinates: " << std::endl;
@@ -1419,7 +1384,6 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
         std::vector<Scalar4> angmom(m_nparticles);
         std::vector<Scalar3> inertia(m_nparticles);
         std::vector<unsigned int> tag(m_nparticles);
-        std::map<unsigned int, unsigned int> rtag_map;
         for (unsigned int idx = 0; idx < m_nparticles; idx++)
             {
             pos[idx]
@@ -1438,9 +1402,7 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
             orientation[idx] = h_orientation.data[idx];
             angmom[idx] = h_angmom.data[idx];
             inertia[idx] = h_inertia.data[idx];
-
-            // insert reverse lookup global tag -> idx
-            rtag_map.insert(std::pair<unsigned int, unsigned int>(h_tag.data[idx], idx));
+            tag[idx] = h_tag.data[idx];
             }
 
         std::vector<std::vector<Scalar3>> pos_proc;       // Position array of every processor
@@ -1456,9 +1418,7 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
         std::vector<std::vector<Scalar4>> orientation_proc; // Orientations of every processor
         std::vector<std::vector<Scalar4>> angmom_proc;      // Angular momenta of every processor
         std::vector<std::vector<Scalar3>> inertia_proc;     // Moments of inertia of every processor
-
-        std::vector<std::map<unsigned int, unsigned int>>
-            rtag_map_proc; // List of reverse-lookup maps
+        std::vector<std::vector<unsigned int>> tag_proc;    // Global tags of every processor
 
         const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
         unsigned int size = m_exec_conf->getNRanks();
@@ -1477,7 +1437,7 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
         orientation_proc.resize(size);
         angmom_proc.resize(size);
         inertia_proc.resize(size);
-        rtag_map_proc.resize(size);
+        tag_proc.resize(size);
 
         unsigned int root = 0;
 
@@ -1494,9 +1454,7 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
         gather_v(orientation, orientation_proc, root, mpi_comm);
         gather_v(angmom, angmom_proc, root, mpi_comm);
         gather_v(inertia, inertia_proc, root, mpi_comm);
-
-        // gather the reverse-lookup maps
-        gather_v(rtag_map, rtag_map_proc, root, mpi_comm);
+        gather_v(tag, tag_proc, root, mpi_comm);
 
         if (rank == root)
             {
@@ -1504,30 +1462,31 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
             snapshot.resize(getNGlobal());
 
             unsigned int n_ranks = m_exec_conf->getNRanks();
-            assert(rtag_map_proc.size() == n_ranks);
+            assert(tag_proc.size() == n_ranks);
 
-            // create single map of all particle ranks and indices
-            std::map<unsigned int, std::pair<unsigned int, unsigned int>> rank_rtag_map;
-            std::map<unsigned int, unsigned int>::iterator it;
+            // look up the rank and index of every particle by tag
+            const unsigned int n_tags = (unsigned int)m_rtag.size();
+            std::vector<unsigned int> tag_rank(n_tags, NOT_LOCAL);
+            std::vector<unsigned int> tag_idx(n_tags, NOT_LOCAL);
             for (unsigned int irank = 0; irank < n_ranks; ++irank)
-                for (it = rtag_map_proc[irank].begin(); it != rtag_map_proc[irank].end(); ++it)
-                    rank_rtag_map.insert(
-                        std::pair<unsigned int, std::pair<unsigned int, unsigned int>>(
-                            it->first,
-                            std::pair<unsigned int, unsigned int>(irank, it->second)));
+                for (unsigned int idx = 0; idx < tag_proc[irank].size(); ++idx)
+                    {
+                    unsigned int tag = tag_proc[irank][idx];
+                    assert(tag < n_tags);
+                    tag_rank[tag] = irank;
+                    tag_idx[tag] = idx;
+                    }
 
             // add particles to snapshot
             assert(m_tag_set.size() == getNGlobal());
             std::set<unsigned int>::const_iterator tag_set_it = m_tag_set.begin();
 
-            std::map<unsigned int, std::pair<unsigned int, unsigned int>>::iterator rank_rtag_it;
             for (unsigned int snap_id = 0; snap_id < getNGlobal(); snap_id++)
                 {
                 unsigned int tag = *tag_set_it;
                 assert(tag <= getMaximumTag());
-                rank_rtag_it = rank_rtag_map.find(tag);
 
-                if (rank_rtag_it == rank_rtag_map.end())
+                if (tag >= n_tags || tag_rank[tag] == NOT_LOCAL)
                     {
                     ostringstream o;
                     o << "Error gathering ParticleData: Could not find particle " << tag
@@ -1536,9 +1495,8 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
                     }
 
                 // rank contains the processor rank on which the particle was found
-                std::pair<unsigned int, unsigned int> rank_idx = rank_rtag_it->second;
-                unsigned int rank = rank_idx.first;
-                unsigned int idx = rank_idx.second;
+                unsigned int rank = tag_rank[tag];
+                unsigned int idx = tag_idx[tag];
 
                 snapshot.pos[snap_id] = vec3<Real>(pos_proc[rank][idx]);
                 snapshot.vel[snap_id] = vec3<Real>(vel_proc[rank][idx]);
@@ -1616,6 +1574,188 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
     snapshot.is_accel_set = m_accel_set;
     }
 
+/*! \param out Stream to write to
+
+    Writes the particles owned by this rank in local index order, followed by the global tag
+    bookkeeping needed to restore the particle data without communication. Ghost particles and net
+    forces are not written, they are recomputed on the next step.
+*/
+void ParticleData::writeCheckpoint(std::ostream& out)
+    {
+    detail::writeCheckpointValue(out, m_nglobal);
+    detail::writeCheckpointValue(out, (unsigned int)m_rtag.size());
+    detail::writeCheckpointNames(out, m_type_mapping);
+    detail::writeCheckpointValue(out, m_accel_set);
+    detail::writeCheckpointValue(out, m_origin);
+    detail::writeCheckpointValue(out, m_o_image);
+
+    // copy the recycled tags out of the stack, bottom first
+    std::vector<unsigned int> recycled_tags;
+    std::stack<unsigned int> tmp = m_recycled_tags;
+    while (!tmp.empty())
+        {
+        recycled_tags.push_back(tmp.top());
+        tmp.pop();
+        }
+    std::reverse(recycled_tags.begin(), recycled_tags.end());
+    detail::writeCheckpointArray(out, recycled_tags.data(), recycled_tags.size());
+
+    ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_accel(getAccelerations(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_diameter(getDiameters(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(getBodies(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_angmom(getAngularMomentumArray(),
+                                  access_location::host,
+                                  access_mode::read);
+    ArrayHandle<Scalar3> h_inertia(getMomentsOfInertiaArray(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::read);
+
+    uint64_t N = m_nparticles;
+    detail::writeCheckpointArray(out, h_pos.data, N);
+    detail::writeCheckpointArray(out, h_vel.data, N);
+    detail::writeCheckpointArray(out, h_accel.data, N);
+    detail::writeCheckpointArray(out, h_charge.data, N);
+    detail::writeCheckpointArray(out, h_diameter.data, N);
+    detail::writeCheckpointArray(out, h_image.data, N);
+    detail::writeCheckpointArray(out, h_body.data, N);
+    detail::writeCheckpointArray(out, h_orientation.data, N);
+    detail::writeCheckpointArray(out, h_angmom.data, N);
+    detail::writeCheckpointArray(out, h_inertia.data, N);
+    detail::writeCheckpointArray(out, h_tag.data, N);
+    }
+
+/*! \param in Stream to read from
+
+    Replaces the local particles with the ones written by writeCheckpoint().
+
+    \pre The global box and domain decomposition match the ones of the checkpoint.
+*/
+void ParticleData::readCheckpoint(std::istream& in)
+    {
+    m_exec_conf->msg->notice(4) << "ParticleData: reading checkpoint" << std::endl;
+
+    unsigned int nglobal, rtag_size;
+    detail::readCheckpointValue(in, nglobal);
+    detail::readCheckpointValue(in, rtag_size);
+    detail::readCheckpointNames(in, m_type_mapping);
+    detail::readCheckpointValue(in, m_accel_set);
+    detail::readCheckpointValue(in, m_origin);
+    detail::readCheckpointValue(in, m_o_image);
+
+    std::vector<unsigned int> recycled_tags;
+    detail::readCheckpointArray(in, recycled_tags);
+
+    std::vector<Scalar4> pos, vel, orientation, angmom;
+    std::vector<Scalar3> accel, inertia;
+    std::vector<Scalar> charge, diameter;
+    std::vector<int3> image;
+    std::vector<unsigned int> body, tag;
+    detail::readCheckpointArray(in, pos);
+    detail::readCheckpointArray(in, vel);
+    detail::readCheckpointArray(in, accel);
+    detail::readCheckpointArray(in, charge);
+    detail::readCheckpointArray(in, diameter);
+    detail::readCheckpointArray(in, image);
+    detail::readCheckpointArray(in, body);
+    detail::readCheckpointArray(in, orientation);
+    detail::readCheckpointArray(in, angmom);
+    detail::readCheckpointArray(in, inertia);
+    detail::readCheckpointArray(in, tag);
+
+    const unsigned int N = (unsigned int)pos.size();
+    if (vel.size() != N || accel.size() != N || charge.size() != N || diameter.size() != N
+        || image.size() != N || body.size() != N || orientation.size() != N
+        || angmom.size() != N || inertia.size() != N || tag.size() != N)
+        {
+        throw std::runtime_error("Inconsistent particle array sizes in checkpoint file.");
+        }
+
+    // the active tags are all tags that have not been recycled
+    removeAllGhostParticles();
+    m_tag_set.clear();
+    while (!m_recycled_tags.empty())
+        m_recycled_tags.pop();
+    std::vector<bool> recycled(rtag_size, false);
+    for (unsigned int t : recycled_tags)
+        {
+        if (t >= rtag_size)
+            throw std::runtime_error("Invalid particle tag in checkpoint file.");
+        recycled[t] = true;
+        m_recycled_tags.push(t);
+        }
+    for (unsigned int t = 0; t < rtag_size; t++)
+        {
+        if (!recycled[t])
+            m_tag_set.insert(m_tag_set.end(), t);
+        }
+    m_invalid_cached_tags = true;
+
+    m_rtag.resize(rtag_size);
+    resize(N);
+
+        {
+        ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::overwrite);
+        ArrayHandle<Scalar4> h_vel(getVelocities(), access_location::host, access_mode::overwrite);
+        ArrayHandle<Scalar3> h_accel(getAccelerations(),
+                                     access_location::host,
+                                     access_mode::overwrite);
+        ArrayHandle<Scalar> h_charge(getCharges(), access_location::host, access_mode::overwrite);
+        ArrayHandle<Scalar> h_diameter(getDiameters(),
+                                       access_location::host,
+                                       access_mode::overwrite);
+        ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_body(getBodies(),
+                                         access_location::host,
+                                         access_mode::overwrite);
+        ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::overwrite);
+        ArrayHandle<Scalar4> h_angmom(getAngularMomentumArray(),
+                                      access_location::host,
+                                      access_mode::overwrite);
+        ArrayHandle<Scalar3> h_inertia(getMomentsOfInertiaArray(),
+                                       access_location::host,
+                                       access_mode::overwrite);
+        ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_comm_flags(getCommFlags(),
+                                               access_location::host,
+                                               access_mode::overwrite);
+
+        std::copy(pos.begin(), pos.end(), h_pos.data);
+        std::copy(vel.begin(), vel.end(), h_vel.data);
+        std::copy(accel.begin(), accel.end(), h_accel.data);
+        std::copy(charge.begin(), charge.end(), h_charge.data);
+        std::copy(diameter.begin(), diameter.end(), h_diameter.data);
+        std::copy(image.begin(), image.end(), h_image.data);
+        std::copy(body.begin(), body.end(), h_body.data);
+        std::copy(orientation.begin(), orientation.end(), h_orientation.data);
+        std::copy(angmom.begin(), angmom.end(), h_angmom.data);
+        std::copy(inertia.begin(), inertia.end(), h_inertia.data);
+        std::copy(tag.begin(), tag.end(), h_tag.data);
+        std::fill(h_comm_flags.data, h_comm_flags.data + N, 0);
+
+        std::fill(h_rtag.data, h_rtag.data + rtag_size, NOT_LOCAL);
+        for (unsigned int idx = 0; idx < N; idx++)
+            {
+            if (tag[idx] >= rtag_size)
+                throw std::runtime_error("Invalid particle tag in checkpoint file.");
+            h_rtag.data[tag[idx]] = idx;
+            }
+        }
+
+    setNGlobal(nglobal);
+    notifyParticleSort();
+    }
+
 //! Add ghost particles at the end of the local particle data
 /*! Ghost ptls are appended at the end of the particle data.
   Ghost particles have only incomplete particle information (position, charge, diameter) and
@@ -3110,6 +3250,206 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
     notifyParticleSort();
     }
 
+/*! \param pos Position of the particle, wrapped into the box when it is on a boundary
+    \param img Image of the particle, updated when the position is wrapped
+    \param cart_ranks Map from cartesian domain indices to ranks
+    \returns The rank of the domain that contains the particle, or a value not less than the number
+             of ranks when the particle is outside of all domains
+*/
+unsigned int
+ParticleData::findParticleRank(Scalar3& pos, int3& img, const unsigned int* cart_ranks)
+    {
+    const Index3D& di = m_decomposition->getDomainIndexer();
+    BoxDim global_box = *m_global_box;
+
+    Scalar3 f = global_box.makeFraction(pos);
+    int i = int(f.x * ((Scalar)di.getW()));
+    int j = int(f.y * ((Scalar)di.getH()));
+    int k = int(f.z * ((Scalar)di.getD()));
+
+    // wrap particles that are exactly on a boundary
+    // we only need to wrap in the negative direction, since
+    // processor ids are rounded toward zero
+    char3 flags = make_char3(0, 0, 0);
+    if (i == (int)di.getW())
+        {
+        i = 0;
+        flags.x = 1;
+        }
+
+    if (j == (int)di.getH())
+        {
+        j = 0;
+        flags.y = 1;
+        }
+
+    if (k == (int)di.getD())
+        {
+        k = 0;
+        flags.z = 1;
+        }
+
+    // only wrap if the particles is on one of the boundaries
+    uchar3 periodic = make_uchar3(flags.x, flags.y, flags.z);
+    global_box.setPeriodic(periodic);
+    global_box.wrap(pos, img, flags);
+
+    // place particle using actual domain fractions, not global box fraction
+    return m_decomposition->placeParticle(global_box, pos, cart_ranks);
+    }
+
+/*! \param snapshot The slice of the particle data read by this rank
+    \returns The rank that owns each particle in the slice
+
+    Particle tags follow the order of the slices: the particles in the slice of rank r have tags
+    starting at the total size of the slices on the ranks before r. Each rank places the particles
+    of its slice into domains and sends them to their owners with a single all-to-all exchange.
+    Errors are reduced over all ranks before throwing to avoid deadlocks.
+
+    \pre The particle data is constructed with a domain decomposition and is empty.
+*/
+template<class Real>
+std::vector<unsigned int>
+ParticleData::initializeFromDistributedSnapshot(const SnapshotParticleData<Real>& snapshot)
+    {
+    m_exec_conf->msg->notice(4) << "ParticleData: initializing from distributed snapshot"
+                                << std::endl;
+    assert(m_decomposition);
+    snapshot.validate();
+
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+
+    removeAllGhostParticles();
+    m_tag_set.clear();
+    while (!m_recycled_tags.empty())
+        m_recycled_tags.pop();
+
+    // the slices of the ranks before this one determine the first tag
+    unsigned int slice_size = snapshot.size;
+    unsigned int first_tag = 0;
+    unsigned int nglobal = 0;
+    MPI_Exscan(&slice_size, &first_tag, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+    if (m_exec_conf->getRank() == 0)
+        first_tag = 0;
+    MPI_Allreduce(&slice_size, &nglobal, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+
+    // all ranks read the same types, use the ones from the root for consistency
+    m_type_mapping = snapshot.type_mapping;
+    bcast(m_type_mapping, 0, mpi_comm);
+
+    std::vector<unsigned int> owners(slice_size);
+    std::vector<std::vector<detail::pdata_element>> send(n_ranks);
+    unsigned int max_typeid = 0;
+    int error = 0;
+    std::ostringstream error_message;
+
+        {
+        ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+
+        const Scalar tol = Scalar(1e-5);
+        for (unsigned int snap_idx = 0; snap_idx < slice_size; snap_idx++)
+            {
+            Scalar3 pos = vec_to_scalar3(snapshot.pos[snap_idx]);
+            Scalar3 f = m_global_box->makeFraction(pos);
+            int3 img = snapshot.image[snap_idx];
+            unsigned int rank = n_ranks;
+            if (f.x >= -tol && f.x <= Scalar(1.0) + tol && f.y >= -tol && f.y <= Scalar(1.0) + tol
+                && f.z >= -tol && f.z <= Scalar(1.0) + tol)
+                {
+                rank = findParticleRank(pos, img, h_cart_ranks.data);
+                }
+
+            if (rank >= n_ranks)
+                {
+                if (!error)
+                    {
+                    error_message << "Particle " << first_tag + snap_idx
+                                  << " is outside the box at " << setprecision(12) << pos.x << " "
+                                  << pos.y << " " << pos.z << ".";
+                    }
+                error = 1;
+                rank = 0;
+                }
+
+            owners[snap_idx] = rank;
+            max_typeid = std::max(max_typeid, snapshot.type[snap_idx]);
+
+            detail::pdata_element p;
+            memset(&p, 0, sizeof(p));
+            p.pos = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(snapshot.type[snap_idx]));
+            p.vel = make_scalar4(snapshot.vel[snap_idx].x,
+                                 snapshot.vel[snap_idx].y,
+                                 snapshot.vel[snap_idx].z,
+                                 snapshot.mass[snap_idx]);
+            p.accel = vec_to_scalar3(snapshot.accel[snap_idx]);
+            p.charge = snapshot.charge[snap_idx];
+            p.diameter = snapshot.diameter[snap_idx];
+            p.image = img;
+            p.body = snapshot.body[snap_idx];
+            p.orientation = quat_to_scalar4(snapshot.orientation[snap_idx]);
+            p.angmom = quat_to_scalar4(snapshot.angmom[snap_idx]);
+            p.inertia = vec_to_scalar3(snapshot.inertia[snap_idx]);
+            p.tag = first_tag + snap_idx;
+            send[rank].push_back(p);
+            }
+        }
+
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_INT, MPI_MAX, mpi_comm);
+    if (error)
+        {
+        std::string message = error_message.str();
+        throw std::runtime_error(message.empty() ? "Not all particles were found inside the box."
+                                                 : message);
+        }
+
+    MPI_Allreduce(MPI_IN_PLACE, &max_typeid, 1, MPI_UNSIGNED, MPI_MAX, mpi_comm);
+    if (nglobal != 0 && max_typeid >= m_type_mapping.size())
+        {
+        std::ostringstream s;
+        s << "Particle typeid " << max_typeid << " is invalid in a system with "
+          << m_type_mapping.size() << " types.";
+        throw std::runtime_error(s.str());
+        }
+
+    // the slices arrive in rank order, so the particles are in tag order
+    std::vector<detail::pdata_element> recv;
+    all_to_all_v(send, recv, mpi_comm);
+    send.clear();
+
+    m_rtag.resize(nglobal);
+        {
+        ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::overwrite);
+        std::fill(h_rtag.data, h_rtag.data + nglobal, NOT_LOCAL);
+        }
+
+    for (unsigned int tag = 0; tag < nglobal; tag++)
+        m_tag_set.insert(m_tag_set.end(), tag);
+    m_invalid_cached_tags = true;
+
+    m_nparticles = 0;
+    addParticles(recv);
+
+    int accel_set = snapshot.is_accel_set;
+    MPI_Allreduce(MPI_IN_PLACE, &accel_set, 1, MPI_INT, MPI_LOR, mpi_comm);
+    m_accel_set = accel_set;
+
+    setNGlobal(nglobal);
+
+    m_origin = make_scalar3(0, 0, 0);
+    m_o_image = make_int3(0, 0, 0);
+
+    return owners;
+    }
+
+// instantiate both float and double methods for distributed snapshots
+template std::vector<unsigned int> ParticleData::initializeFromDistributedSnapshot<double>(
+    const SnapshotParticleData<double>& snapshot);
+template std::vector<unsigned int> ParticleData::initializeFromDistributedSnapshot<float>(
+    const SnapshotParticleData<float>& snapshot);
+
 //! Remove particles from local domain and append new particle data
 void ParticleData::addParticles(const std::vector<detail::pdata_element>& in)
     {
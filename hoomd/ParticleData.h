@@ -42,6 +42,8 @@
 #include "DomainDecomposition.h"
 
 #include <bitset>
+#include <istream>
+#include <ostream>
 #include <stack>
 #include <stdlib.h>
 #include <string>
@@ -1182,6 +1184,18 @@ class PYBIND11_EXPORT ParticleData
      */
     void addParticles(const std::vector<detail::pdata_element>& in);
 
+    //! Initialize from the slices of a snapshot distributed over all ranks
+    /*! \param snapshot The slice of the particle data read by this rank
+     *  \returns The rank that owns each particle in the slice
+     *
+     *  Each rank passes a contiguous slice of the global snapshot, in rank order. The particles
+     *  are placed into their domains and exchanged between all ranks in one step, so no rank
+     *  holds more than its own slice and its own particles.
+     */
+    template<class Real>
+    std::vector<unsigned int>
+    initializeFromDistributedSnapshot(const SnapshotParticleData<Real>& snapshot);
+
 #ifdef ENABLE_HIP
     //! Pack particle data into a buffer (GPU version)
     /*! \param out Buffer into which particle data is packed
@@ -1242,6 +1256,12 @@ class PYBIND11_EXPORT ParticleData
         m_o_image = make_int3(0, 0, 0);
         }
 
+    //! Write the local particles to a checkpoint
+    void writeCheckpoint(std::ostream& out);
+
+    //! Read the local particles from a checkpoint
+    void readCheckpoint(std::istream& in);
+
 #ifdef ENABLE_HIP
     //! Return the load balancing GPU partition
     const GPUPartition& getGPUPartition() const
@@ -1370,6 +1390,11 @@ class PYBIND11_EXPORT ParticleData
      */
     template<class Real> bool inBox(const SnapshotParticleData<Real>& snap);
 
+#ifdef ENABLE_MPI
+    //! Helper function to find the rank that owns a particle
+    unsigned int findParticleRank(Scalar3& pos, int3& img, const unsigned int* cart_ranks);
+#endif
+
     //! Update the CUDA memory hints
     void setGPUAdvice();
     };
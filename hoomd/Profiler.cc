@@ -0,0 +1,195 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Profiler.cc
+    \brief Defines the Profiler class
+*/
+
+#include "Profiler.h"
+
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+#endif
+
+#include <pybind11/stl.h>
+
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+namespace hoomd
+    {
+/*! \param synchronize_gpu Set to true to synchronize the GPU before reading the clock
+ */
+Profiler::Profiler(bool synchronize_gpu) : m_synchronize_gpu(synchronize_gpu)
+    {
+    m_nodes.emplace_back();
+    m_nodes[0].parent = 0;
+    }
+
+/*! \param name Name of the region to enter
+
+    Child lookup is a linear search: each region has only a handful of children.
+*/
+void Profiler::push(const std::string& name)
+    {
+    synchronize();
+
+    unsigned int child = 0;
+    for (unsigned int idx : m_nodes[m_current].children)
+        {
+        if (m_nodes[idx].name == name)
+            {
+            child = idx;
+            break;
+            }
+        }
+
+    if (child == 0)
+        {
+        child = static_cast<unsigned int>(m_nodes.size());
+        m_nodes.emplace_back();
+        m_nodes[child].name = name;
+        m_nodes[child].parent = m_current;
+        m_nodes[m_current].children.push_back(child);
+        }
+
+    m_current = child;
+    m_nodes[child].start = m_clk.getTime();
+    }
+
+void Profiler::pop() noexcept
+    {
+    assert(m_current != 0);
+    if (m_current == 0)
+        {
+        m_n_unmatched_pops++;
+        return;
+        }
+
+    synchronize();
+
+    Node& node = m_nodes[m_current];
+    node.total += m_clk.getTime() - node.start;
+    node.count++;
+    m_current = node.parent;
+    }
+
+void Profiler::reset()
+    {
+    for (auto& node : m_nodes)
+        {
+        node.total = 0;
+        node.count = 0;
+        }
+    m_n_unmatched_pops = 0;
+    }
+
+/*! \param node Index of the node
+    \returns The '/' separated names from the root to \a node
+*/
+std::string Profiler::getPath(unsigned int node) const
+    {
+    std::string path = m_nodes[node].name;
+    for (unsigned int cur = m_nodes[node].parent; cur != 0; cur = m_nodes[cur].parent)
+        {
+        path = m_nodes[cur].name + "/" + path;
+        }
+    return path;
+    }
+
+std::map<std::string, double> Profiler::getTimes() const
+    {
+    std::map<std::string, double> result;
+    for (unsigned int i = 1; i < m_nodes.size(); i++)
+        {
+        if (m_nodes[i].count > 0)
+            result[getPath(i)] = double(m_nodes[i].total) / 1e9;
+        }
+    return result;
+    }
+
+std::map<std::string, uint64_t> Profiler::getCounts() const
+    {
+    std::map<std::string, uint64_t> result;
+    for (unsigned int i = 1; i < m_nodes.size(); i++)
+        {
+        if (m_nodes[i].count > 0)
+            result[getPath(i)] = m_nodes[i].count;
+        }
+    return result;
+    }
+
+/*! The table lists each region indented under its parent with the number of calls, the inclusive
+    time, the exclusive (self) time, and the inclusive time as a percentage of all top level
+    regions.
+*/
+std::string Profiler::getTable() const
+    {
+    int64_t grand_total = 0;
+    for (unsigned int idx : m_nodes[0].children)
+        grand_total += m_nodes[idx].total;
+
+    ostringstream out;
+    out << left << setw(48) << "region" << right << setw(12) << "calls" << setw(14) << "total (s)"
+        << setw(14) << "self (s)" << setw(9) << "%" << "\n";
+
+    // depth first traversal in the order regions were first entered
+    std::vector<std::pair<unsigned int, unsigned int>> stack;
+    for (auto it = m_nodes[0].children.rbegin(); it != m_nodes[0].children.rend(); ++it)
+        stack.push_back(std::make_pair(*it, 0));
+
+    while (!stack.empty())
+        {
+        unsigned int idx = stack.back().first;
+        unsigned int depth = stack.back().second;
+        stack.pop_back();
+
+        const Node& node = m_nodes[idx];
+        if (node.count == 0)
+            continue;
+
+        int64_t self = node.total;
+        for (unsigned int child : node.children)
+            self -= m_nodes[child].total;
+
+        double percent = grand_total > 0 ? 100.0 * double(node.total) / double(grand_total) : 0.0;
+
+        out << left << setw(48) << (std::string(2 * depth, ' ') + node.name) << right << setw(12)
+            << node.count << fixed << setprecision(4) << setw(14) << double(node.total) / 1e9
+            << setw(14) << double(self) / 1e9 << setprecision(1) << setw(9) << percent << "\n";
+
+        for (auto it = node.children.rbegin(); it != node.children.rend(); ++it)
+            stack.push_back(std::make_pair(*it, depth + 1));
+        }
+
+    if (m_n_unmatched_pops > 0)
+        out << "warning: " << m_n_unmatched_pops << " unmatched pop() calls\n";
+
+    return out.str();
+    }
+
+void Profiler::synchronize()
+    {
+#ifdef ENABLE_HIP
+    if (m_synchronize_gpu)
+        hipDeviceSynchronize();
+#endif
+    }
+
+namespace detail
+    {
+void export_Profiler(pybind11::module& m)
+    {
+    pybind11::class_<Profiler, std::shared_ptr<Profiler>>(m, "Profiler")
+        .def(pybind11::init<bool>())
+        .def("reset", &Profiler::reset)
+        .def("getTimes", &Profiler::getTimes)
+        .def("getCounts", &Profiler::getCounts)
+        .def("getTable", &Profiler::getTable);
+    }
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,152 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file Profiler.h
+    \brief Declares the Profiler and ProfilerScope classes
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include "ClockSource.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+/// Accumulate the wall clock time spent in nested regions of the code.
+/*! Profiler maintains a tree of named regions. push() enters a child region of the current region
+    (creating it on first use) and pop() leaves it, adding the elapsed ClockSource time to that
+    region's total. The tree persists across reset() so that steady state profiling performs no
+    memory allocations.
+
+    Region names are joined with '/' to form a path that identifies a region uniquely, e.g.
+    "Integrator/computeNetForce/LJ/NeighborList". Times are inclusive: the time of a region includes
+    the time of all of its children.
+
+    When \a synchronize_gpu is set, push() and pop() synchronize the device so that asynchronous
+    kernels are attributed to the region that launched them.
+
+    Use ProfilerScope to time a region in a way that is safe in the presence of exceptions.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT Profiler
+    {
+    public:
+    /// Constructor.
+    Profiler(bool synchronize_gpu = false);
+
+    /// Enter a region.
+    void push(const std::string& name);
+
+    /// Leave the current region.
+    /*! pop() does not throw so that ProfilerScope can call it from its destructor. An unmatched
+        pop() is ignored and counted, and getTable() reports the count.
+    */
+    void pop() noexcept;
+
+    /// Zero the accumulated times and counts.
+    void reset();
+
+    /// Get the total time (in seconds) spent in each region, keyed by path.
+    std::map<std::string, double> getTimes() const;
+
+    /// Get the number of times each region was entered, keyed by path.
+    std::map<std::string, uint64_t> getCounts() const;
+
+    /// Format the accumulated times as a human readable table.
+    std::string getTable() const;
+
+    private:
+    /// A node in the region tree.
+    struct Node
+        {
+        /// Name of the region.
+        std::string name;
+
+        /// Index of the parent node.
+        unsigned int parent;
+
+        /// Indices of the child nodes.
+        std::vector<unsigned int> children;
+
+        /// Total time spent in the region (ns).
+        int64_t total = 0;
+
+        /// Number of times the region was entered.
+        uint64_t count = 0;
+
+        /// Time when the region was last entered (ns).
+        int64_t start = 0;
+        };
+
+    /// Get the path of the given node.
+    std::string getPath(unsigned int node) const;
+
+    /// Synchronize the GPU before reading the clock (when requested).
+    void synchronize();
+
+    /// All nodes in the tree. Node 0 is the root.
+    std::vector<Node> m_nodes;
+
+    /// Index of the current node.
+    unsigned int m_current = 0;
+
+    /// Number of calls to pop() without a matching push().
+    unsigned int m_n_unmatched_pops = 0;
+
+    /// Synchronize the GPU in push and pop.
+    bool m_synchronize_gpu;
+
+    /// Clock used to measure the elapsed time.
+    ClockSource m_clk;
+    };
+
+/// Time a region of code for the duration of the scope.
+/*! ProfilerScope pushes \a name on construction and pops on destruction. It does nothing when
+    \a profiler is null, so callers pass ExecutionConfiguration::getProfiler() unconditionally and
+    pay only for a pointer test when profiling is disabled.
+*/
+class ProfilerScope
+    {
+    public:
+    /// Enter the region \a name.
+    ProfilerScope(Profiler* profiler, const std::string& name) : m_profiler(profiler)
+        {
+        if (m_profiler)
+            m_profiler->push(name);
+        }
+
+    /// Leave the region.
+    ~ProfilerScope()
+        {
+        if (m_profiler)
+            m_profiler->pop();
+        }
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+    private:
+    /// The profiler (may be null).
+    Profiler* m_profiler;
+    };
+
+namespace detail
+    {
+/// Export Profiler to python.
+void export_Profiler(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace hoomd
+
+#endif
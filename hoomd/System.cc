@@ -89,6 +89,11 @@ void System::run(uint64_t nsteps, bool write_at_start)
 
     resetStats();
 
+    // accumulate profiler times over this run only
+    Profiler* profiler = m_exec_conf->getProfiler();
+    if (profiler)
+        profiler->reset();
+
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
@@ -109,6 +114,7 @@ void System::run(uint64_t nsteps, bool write_at_start)
     // Prepare the run
     if (m_integrator)
         {
+        ProfilerScope scope(profiler, m_integrator->getProfileName());
         m_integrator->prepRun(m_cur_tstep);
         }
 
@@ -123,7 +129,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ProfilerScope scope(profiler, analyzer->getProfileName());
                 analyzer->analyze(m_cur_tstep);
+                }
             }
         }
 
@@ -133,7 +142,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& tuner : m_tuners)
             {
             if ((*tuner->getTrigger())(m_cur_tstep))
+                {
+                ProfilerScope scope(profiler, tuner->getProfileName());
                 tuner->update(m_cur_tstep);
+                }
             }
 
         // execute updaters
@@ -141,6 +153,7 @@ void System::run(uint64_t nsteps, bool write_at_start)
             {
             if ((*updater->getTrigger())(m_cur_tstep))
                 {
+                ProfilerScope scope(profiler, updater->getProfileName());
                 updater->update(m_cur_tstep);
                 m_update_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
                 }
@@ -159,7 +172,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
 
         // execute the integrator
         if (m_integrator)
+            {
+            ProfilerScope scope(profiler, m_integrator->getProfileName());
             m_integrator->update(m_cur_tstep);
+            }
 
         m_cur_tstep++;
 
@@ -167,7 +183,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ProfilerScope scope(profiler, analyzer->getProfileName());
                 analyzer->analyze(m_cur_tstep);
+                }
             }
 
         updateTPS();
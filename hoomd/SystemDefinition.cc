@@ -104,36 +104,83 @@ SystemDefinition::SystemDefinition(unsigned int N,
     \param snapshot Snapshot to use
     \param exec_conf Execution configuration to run on
     \param decomposition (optional) The domain decomposition layout
+    \param distributed Set when each rank passes a slice of the snapshot (see GSDReader)
+
+    In distributed mode, every rank holds a contiguous slice of the particles and of each type of
+    bonded group. The slices are concatenated in rank order and the data is exchanged directly
+    between the ranks that read it and the ranks that own it.
 */
 template<class Real>
 SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<Real>> snapshot,
                                    std::shared_ptr<ExecutionConfiguration> exec_conf,
-                                   std::shared_ptr<DomainDecomposition> decomposition)
+                                   std::shared_ptr<DomainDecomposition> decomposition,
+                                   bool distributed)
     {
     setNDimensions(snapshot->dimensions);
 
-    m_particle_data = std::shared_ptr<ParticleData>(
-        new ParticleData(snapshot->particle_data, snapshot->global_box, exec_conf, decomposition));
-
 #ifdef ENABLE_MPI
-    // in MPI simulations, broadcast dimensionality from rank zero
-    if (m_particle_data->getDomainDecomposition())
+    if (distributed)
+        {
+        if (!decomposition)
+            {
+            throw std::runtime_error("Distributed initialization requires a domain decomposition.");
+            }
+
+        m_particle_data = std::shared_ptr<ParticleData>(
+            new ParticleData(0, snapshot->global_box, 1, exec_conf, decomposition));
+        std::vector<unsigned int> owners
+            = m_particle_data->initializeFromDistributedSnapshot(snapshot->particle_data);
+
+        m_bond_data = std::shared_ptr<BondData>(new BondData(m_particle_data, 0));
+        m_bond_data->initializeFromDistributedSnapshot(snapshot->bond_data, owners);
+
+        m_angle_data = std::shared_ptr<AngleData>(new AngleData(m_particle_data, 0));
+        m_angle_data->initializeFromDistributedSnapshot(snapshot->angle_data, owners);
+
+        m_dihedral_data = std::shared_ptr<DihedralData>(new DihedralData(m_particle_data, 0));
+        m_dihedral_data->initializeFromDistributedSnapshot(snapshot->dihedral_data, owners);
+
+        m_improper_data = std::shared_ptr<ImproperData>(new ImproperData(m_particle_data, 0));
+        m_improper_data->initializeFromDistributedSnapshot(snapshot->improper_data, owners);
+
+        m_constraint_data = std::shared_ptr<ConstraintData>(new ConstraintData(m_particle_data, 0));
+        m_constraint_data->initializeFromDistributedSnapshot(snapshot->constraint_data, owners);
+
+        m_pair_data = std::shared_ptr<PairData>(new PairData(m_particle_data, 0));
+        m_pair_data->initializeFromDistributedSnapshot(snapshot->pair_data, owners);
+
+        // all ranks read the dimensionality, use the one from rank zero for consistency
         bcast(m_n_dimensions, 0, exec_conf->getMPICommunicator());
+        }
+    else
 #endif
+        {
+        m_particle_data = std::shared_ptr<ParticleData>(new ParticleData(snapshot->particle_data,
+                                                                         snapshot->global_box,
+                                                                         exec_conf,
+                                                                         decomposition));
 
-    m_bond_data = std::shared_ptr<BondData>(new BondData(m_particle_data, snapshot->bond_data));
+#ifdef ENABLE_MPI
+        // in MPI simulations, broadcast dimensionality from rank zero
+        if (m_particle_data->getDomainDecomposition())
+            bcast(m_n_dimensions, 0, exec_conf->getMPICommunicator());
+#endif
 
-    m_angle_data = std::shared_ptr<AngleData>(new AngleData(m_particle_data, snapshot->angle_data));
+        m_bond_data = std::shared_ptr<BondData>(new BondData(m_particle_data, snapshot->bond_data));
 
-    m_dihedral_data
-        = std::shared_ptr<DihedralData>(new DihedralData(m_particle_data, snapshot->dihedral_data));
+        m_angle_data
+            = std::shared_ptr<AngleData>(new AngleData(m_particle_data, snapshot->angle_data));
 
-    m_improper_data
-        = std::shared_ptr<ImproperData>(new ImproperData(m_particle_data, snapshot->improper_data));
+        m_dihedral_data = std::shared_ptr<DihedralData>(
+            new DihedralData(m_particle_data, snapshot->dihedral_data));
+
+        m_improper_data = std::shared_ptr<ImproperData>(
+            new ImproperData(m_particle_data, snapshot->improper_data));
 
-    m_constraint_data = std::shared_ptr<ConstraintData>(
-        new ConstraintData(m_particle_data, snapshot->constraint_data));
-    m_pair_data = std::shared_ptr<PairData>(new PairData(m_particle_data, snapshot->pair_data));
+        m_constraint_data = std::shared_ptr<ConstraintData>(
+            new ConstraintData(m_particle_data, snapshot->constraint_data));
+        m_pair_data = std::shared_ptr<PairData>(new PairData(m_particle_data, snapshot->pair_data));
+        }
 
 #ifdef BUILD_MPCD
     m_mpcd_data = std::make_shared<mpcd::ParticleData>(snapshot->mpcd_data,
@@ -238,14 +285,16 @@ void SystemDefinition::initializeFromSnapshot(std::shared_ptr<SnapshotSystemData
 // instantiate both float and double methods
 template SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<float>> snapshot,
                                             std::shared_ptr<ExecutionConfiguration> exec_conf,
-                                            std::shared_ptr<DomainDecomposition> decomposition);
+                                            std::shared_ptr<DomainDecomposition> decomposition,
+                                            bool distributed);
 template std::shared_ptr<SnapshotSystemData<float>> SystemDefinition::takeSnapshot<float>();
 template void SystemDefinition::initializeFromSnapshot<float>(
     std::shared_ptr<SnapshotSystemData<float>> snapshot);
 
 template SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<double>> snapshot,
                                             std::shared_ptr<ExecutionConfiguration> exec_conf,
-                                            std::shared_ptr<DomainDecomposition> decomposition);
+                                            std::shared_ptr<DomainDecomposition> decomposition,
+                                            bool distributed);
 template std::shared_ptr<SnapshotSystemData<double>> SystemDefinition::takeSnapshot<double>();
 template void SystemDefinition::initializeFromSnapshot<double>(
     std::shared_ptr<SnapshotSystemData<double>> snapshot);
@@ -276,6 +325,10 @@ void export_SystemDefinition(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SnapshotSystemData<float>>,
                             std::shared_ptr<ExecutionConfiguration>,
                             std::shared_ptr<DomainDecomposition>>())
+        .def(pybind11::init<std::shared_ptr<SnapshotSystemData<float>>,
+                            std::shared_ptr<ExecutionConfiguration>,
+                            std::shared_ptr<DomainDecomposition>,
+                            bool>())
         .def(pybind11::init<std::shared_ptr<SnapshotSystemData<float>>,
                             std::shared_ptr<ExecutionConfiguration>>())
         .def(pybind11::init<std::shared_ptr<SnapshotSystemData<double>>,
@@ -108,7 +108,8 @@ class PYBIND11_EXPORT SystemDefinition
                      std::shared_ptr<ExecutionConfiguration> exec_conf
                      = std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration()),
                      std::shared_ptr<DomainDecomposition> decomposition
-                     = std::shared_ptr<DomainDecomposition>());
+                     = std::shared_ptr<DomainDecomposition>(),
+                     bool distributed = false);
 
     //! Set the dimensionality of the system
     void setNDimensions(unsigned int);
@@ -164,6 +165,23 @@ class PYBIND11_EXPORT SystemDefinition
         return m_seed;
         }
 
+    /// Add to the wall clock time this rank has spent computing forces
+    /*! \param elapsed Time in nanoseconds
+
+        ForceCompute reports the time spent in each computation so that LoadBalancer can balance
+        the measured cost of the domains.
+    */
+    void addForceComputeTime(int64_t elapsed)
+        {
+        m_force_compute_time += elapsed;
+        }
+
+    /// Get the total wall clock time (in nanoseconds) this rank has spent computing forces
+    int64_t getForceComputeTime() const
+        {
+        return m_force_compute_time;
+        }
+
     //! Get the particle data
     std::shared_ptr<ParticleData> getParticleData() const
         {
@@ -226,6 +244,7 @@ class PYBIND11_EXPORT SystemDefinition
     private:
     unsigned int m_n_dimensions;                       //!< Dimensionality of the system
     uint16_t m_seed = 0;                               //!< Random number seed
+    int64_t m_force_compute_time = 0;                  //!< Time spent computing forces (ns)
     std::shared_ptr<ParticleData> m_particle_data;     //!< Particle data for the system
     std::shared_ptr<BondData> m_bond_data;             //!< Bond data for the system
     std::shared_ptr<AngleData> m_angle_data;           //!< Angle data for the system
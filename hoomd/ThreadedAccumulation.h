@@ -0,0 +1,222 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/HOOMDMath.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+/*! \file ThreadedAccumulation.h
+    \brief Helpers that split a loop into per-thread chunks and combine their results in a fixed
+           order
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace detail
+    {
+/// Get the first item of a chunk.
+/** \param n Number of items
+    \param chunk Index of the chunk
+    \param n_chunks Number of chunks
+
+    Chunk \a chunk holds the items [chunkBegin(n, chunk, n_chunks), chunkBegin(n, chunk + 1,
+    n_chunks)).
+*/
+inline unsigned int chunkBegin(unsigned int n, unsigned int chunk, unsigned int n_chunks)
+    {
+    return (unsigned int)(uint64_t(n) * chunk / n_chunks);
+    }
+
+/// Call a function once for every chunk.
+/** \param exec_conf Execution configuration
+    \param n_chunks Number of chunks
+    \param f Callable f(chunk)
+
+    With TBB, the chunks run in parallel in the task arena of \a exec_conf. An exception thrown by
+    \a f is caught in its thread. After all chunks finish, forEachChunk() rethrows the exception of
+    the first failed chunk, which is the exception that a serial loop would throw.
+*/
+template<class Func>
+void forEachChunk(const ExecutionConfiguration& exec_conf, unsigned int n_chunks, const Func& f)
+    {
+#ifdef ENABLE_TBB
+    std::vector<std::exception_ptr> errors(n_chunks);
+    exec_conf.getTaskArena()->execute(
+        [&]
+        {
+            tbb::parallel_for(
+                tbb::blocked_range<unsigned int>(0, n_chunks, 1),
+                [&](const tbb::blocked_range<unsigned int>& r)
+                {
+                    for (unsigned int chunk = r.begin(); chunk != r.end(); ++chunk)
+                        {
+                        try
+                            {
+                            f(chunk);
+                            }
+                        catch (...)
+                            {
+                            errors[chunk] = std::current_exception();
+                            }
+                        }
+                },
+                tbb::static_partitioner());
+        });
+
+    for (const std::exception_ptr& error : errors)
+        {
+        if (error)
+            {
+            std::rethrow_exception(error);
+            }
+        }
+#else
+    for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+        {
+        f(chunk);
+        }
+#endif
+    }
+
+/// Accumulate per-particle forces and virials from a loop whose items write to shared particles.
+/** Pair interactions in a half neighbor list and bonded groups both add forces to particles that
+    other items also write. When TBB is enabled and more than one CPU thread is in use, compute()
+    splits the items into one contiguous chunk per thread. Each chunk accumulates into a private
+    buffer that covers only the window of particle indices its items write to. The buffers are then
+    added to the output in chunk order, so the result does not depend on thread scheduling.
+    Otherwise, compute() evaluates all items directly into the output.
+
+    Items that are close in the loop usually write to particles that are close in memory, so each
+    window is a small part of the local particles and the buffers take O(N) memory in total.
+
+    The buffers persist between calls to avoid reallocating them every step.
+*/
+class ThreadedForceAccumulator
+    {
+    public:
+    /// Compute the forces of all items.
+    /** \param exec_conf Execution configuration
+        \param n_items Number of items in the loop
+        \param N Number of particles the items write to
+        \param force Output forces
+        \param virial Output virial, or nullptr to skip the virial
+        \param virial_pitch Pitch of the output virial
+        \param window Callable window(first, last) that returns the half open range [lo, hi) of
+               particle indices that items [first, last) write to
+        \param compute_range Callable (first, last, force, virial, virial_pitch, offset) that adds
+               the force and virial on particle i from items [first, last) to force[i - offset]
+               and virial[k * virial_pitch + i - offset]. \a virial is nullptr when the virial is
+               not needed.
+
+        compute() adds to the values in \a force and \a virial. \a window and \a compute_range
+        must only read shared data and must report errors by throwing exceptions.
+    */
+    template<class Window, class Func>
+    void compute(const ExecutionConfiguration& exec_conf,
+                 unsigned int n_items,
+                 unsigned int N,
+                 Scalar4* force,
+                 Scalar* virial,
+                 size_t virial_pitch,
+                 const Window& window,
+                 const Func& compute_range)
+        {
+        const unsigned int n_chunks = exec_conf.getNumThreads();
+        if (n_chunks <= 1 || n_items <= 1 || N == 0)
+            {
+            compute_range(0, n_items, force, virial, virial_pitch, 0);
+            return;
+            }
+
+        const bool compute_virial = virial != nullptr;
+        m_chunks.resize(n_chunks);
+        forEachChunk(exec_conf,
+                     n_chunks,
+                     [&](unsigned int chunk)
+                     {
+                         Chunk& c = m_chunks[chunk];
+                         const unsigned int first = chunkBegin(n_items, chunk, n_chunks);
+                         const unsigned int last = chunkBegin(n_items, chunk + 1, n_chunks);
+                         std::pair<unsigned int, unsigned int> range = window(first, last);
+                         c.lo = range.first;
+                         c.hi = std::max(c.lo, std::min(range.second, N));
+
+                         const size_t size = c.hi - c.lo;
+                         c.force.assign(size, make_scalar4(0, 0, 0, 0));
+                         if (compute_virial)
+                             {
+                             c.virial.assign(6 * size, Scalar(0.0));
+                             }
+                         compute_range(first,
+                                       last,
+                                       c.force.data(),
+                                       compute_virial ? c.virial.data() : nullptr,
+                                       size,
+                                       c.lo);
+                     });
+
+        // Sum the windows into the output. Each element adds the chunks in order.
+        const unsigned int n_blocks = n_chunks;
+        forEachChunk(exec_conf,
+                     n_blocks,
+                     [&](unsigned int block)
+                     {
+                         const unsigned int block_begin = chunkBegin(N, block, n_blocks);
+                         const unsigned int block_end = chunkBegin(N, block + 1, n_blocks);
+                         for (const Chunk& c : m_chunks)
+                             {
+                             const unsigned int begin = std::max(block_begin, c.lo);
+                             const unsigned int end = std::min(block_end, c.hi);
+                             const size_t size = c.hi - c.lo;
+                             for (unsigned int i = begin; i < end; ++i)
+                                 {
+                                 const Scalar4& f = c.force[i - c.lo];
+                                 force[i].x += f.x;
+                                 force[i].y += f.y;
+                                 force[i].z += f.z;
+                                 force[i].w += f.w;
+                                 if (compute_virial)
+                                     {
+                                     for (unsigned int k = 0; k < 6; ++k)
+                                         {
+                                         virial[k * virial_pitch + i]
+                                             += c.virial[k * size + i - c.lo];
+                                         }
+                                     }
+                                 }
+                             }
+                     });
+        }
+
+    private:
+    /// Buffers of one chunk
+    struct Chunk
+        {
+        unsigned int lo = 0;         //!< First particle index in the window
+        unsigned int hi = 0;         //!< One past the last particle index in the window
+        std::vector<Scalar4> force;  //!< Forces on the particles in the window
+        std::vector<Scalar> virial;  //!< Virials of the particles in the window
+        };
+
+    /// Per-chunk buffers
+    std::vector<Chunk> m_chunks;
+    };
+
+    } // end namespace detail
+    } // end namespace hoomd
@@ -0,0 +1,427 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "AABBTree.h"
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#ifndef __WIDE_AABB_TREE_H__
+#define __WIDE_AABB_TREE_H__
+
+/*! \file WideAABBTree.h
+    \brief WideAABBTree build and query methods
+*/
+
+namespace hoomd
+    {
+namespace detail
+    {
+const unsigned int WIDE_NODE_WIDTH = 4; //!< Number of children of a node in a WideAABBTree
+
+#ifndef __HIPCC__
+
+//! Node in a WideAABBTree
+/*! Stores the bounds of all WIDE_NODE_WIDTH children of a node in structure of arrays form, so
+    that one query box is tested against all children with a single vector comparison per bound.
+
+    A child with num_particles > 0 is a leaf, and its particles are stored at indices child ...
+    child + num_particles - 1 in the tree's particle list. Otherwise, child is the index of an
+    internal node or INVALID_NODE for an unused slot. Unused slots have inverted bounds so that they
+    never overlap any box.
+*/
+struct PYBIND11_EXPORT WideAABBNode
+    {
+    //! Default constructor
+    WideAABBNode()
+        {
+        for (unsigned int k = 0; k < WIDE_NODE_WIDTH; k++)
+            {
+            lower_x[k] = lower_y[k] = lower_z[k] = std::numeric_limits<float>::infinity();
+            upper_x[k] = upper_y[k] = upper_z[k] = -std::numeric_limits<float>::infinity();
+            child[k] = INVALID_NODE;
+            num_particles[k] = 0;
+            }
+        }
+
+    float lower_x[WIDE_NODE_WIDTH]; //!< Lower x bound of each child
+    float lower_y[WIDE_NODE_WIDTH]; //!< Lower y bound of each child
+    float lower_z[WIDE_NODE_WIDTH]; //!< Lower z bound of each child
+    float upper_x[WIDE_NODE_WIDTH]; //!< Upper x bound of each child
+    float upper_y[WIDE_NODE_WIDTH]; //!< Upper y bound of each child
+    float upper_z[WIDE_NODE_WIDTH]; //!< Upper z bound of each child
+
+    unsigned int child[WIDE_NODE_WIDTH]; //!< Node index (internal) or first particle (leaf)
+    unsigned int num_particles[WIDE_NODE_WIDTH]; //!< Number of particles in a leaf child
+    } __attribute__((aligned(32)));
+
+//! Query box for a WideAABBTree
+/*! The node bounds are stored in single precision. WideAABBQuery converts a query AABB once per
+    query, rounding outward so that the box tests are conservative.
+*/
+struct WideAABBQuery
+    {
+    //! Construct from an AABB
+    explicit WideAABBQuery(const AABB& aabb)
+        {
+        vec3<Scalar> l = aabb.getLower();
+        vec3<Scalar> u = aabb.getUpper();
+        lower_x = roundDown(l.x);
+        lower_y = roundDown(l.y);
+        lower_z = roundDown(l.z);
+        upper_x = roundUp(u.x);
+        upper_y = roundUp(u.y);
+        upper_z = roundUp(u.z);
+        }
+
+    //! Round a value down to the nearest float
+    static inline float roundDown(Scalar x)
+        {
+        float f = float(x);
+        if (Scalar(f) > x)
+            f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+        return f;
+        }
+
+    //! Round a value up to the nearest float
+    static inline float roundUp(Scalar x)
+        {
+        float f = float(x);
+        if (Scalar(f) < x)
+            f = std::nextafter(f, std::numeric_limits<float>::infinity());
+        return f;
+        }
+
+    float lower_x; //!< Lower x bound
+    float lower_y; //!< Lower y bound
+    float lower_z; //!< Lower z bound
+    float upper_x; //!< Upper x bound
+    float upper_y; //!< Upper y bound
+    float upper_z; //!< Upper z bound
+    };
+
+//! Wide AABB Tree
+/*! A WideAABBTree stores a bounding volume hierarchy where every node has up to WIDE_NODE_WIDTH
+    children. It is built top down with the same binned SAH split as AABBTree: starting from the
+    whole particle range of a node, the range with the largest surface area is repeatedly split in
+    two with AABBTree::partitionSAH() until the node is full. Ranges with at most NODE_CAPACITY
+    particles become leaves.
+
+    A wide tree has half the levels of a binary tree, and overlapMask() tests the query box against
+    all children of a node at once with SSE compares. Traversal is depth first with a caller
+    managed stack. AABBTree instead walks its nodes in order and follows skip links past disjoint
+    subtrees, which works because each node tests only its own box. Here the boxes of the children
+    are tested together at the parent, and the mask of overlapping children must be kept while they
+    are visited, so a stack is the simpler and faster choice:
+
+    \code
+    stack.push_back(0);
+    while (!stack.empty())
+        {
+        unsigned int node = stack.back();
+        stack.pop_back();
+        unsigned int mask = tree.overlapMask(node, query);
+        // for each set bit k: push getNodeChild(node, k) when getNodeChildNumParticles(node, k)
+        // is 0, otherwise process the particles in the leaf
+        }
+    \endcode
+
+    WideAABBTree does not support update(). Use AABBTree when the tree must follow small particle
+    moves between builds.
+*/
+class PYBIND11_EXPORT WideAABBTree
+    {
+    public:
+    //! Construct a WideAABBTree
+    WideAABBTree() { }
+
+    //! Build a tree from a list of AABBs
+    inline void buildTree(AABB* aabbs, unsigned int N);
+
+    //! Find all particles that overlap with the query AABB
+    inline unsigned int query(std::vector<unsigned int>& hits, const AABB& aabb) const;
+
+    //! Test the query box against all children of a node
+    /*! \param node Index of the node to test
+        \param q Query box
+        \returns A bit mask with bit k set when child k overlaps the query box
+    */
+    inline unsigned int overlapMask(unsigned int node, const WideAABBQuery& q) const
+        {
+        const WideAABBNode& n = m_nodes[node];
+#if defined(__SSE__)
+        __m128 out = _mm_or_ps(_mm_cmplt_ps(_mm_load_ps(n.upper_x), _mm_set1_ps(q.lower_x)),
+                               _mm_cmpgt_ps(_mm_load_ps(n.lower_x), _mm_set1_ps(q.upper_x)));
+        out = _mm_or_ps(out, _mm_cmplt_ps(_mm_load_ps(n.upper_y), _mm_set1_ps(q.lower_y)));
+        out = _mm_or_ps(out, _mm_cmpgt_ps(_mm_load_ps(n.lower_y), _mm_set1_ps(q.upper_y)));
+        out = _mm_or_ps(out, _mm_cmplt_ps(_mm_load_ps(n.upper_z), _mm_set1_ps(q.lower_z)));
+        out = _mm_or_ps(out, _mm_cmpgt_ps(_mm_load_ps(n.lower_z), _mm_set1_ps(q.upper_z)));
+        return ~(unsigned int)_mm_movemask_ps(out) & 0xf;
+#else
+        unsigned int mask = 0;
+        for (unsigned int k = 0; k < WIDE_NODE_WIDTH; k++)
+            {
+            bool disjoint = n.upper_x[k] < q.lower_x || n.lower_x[k] > q.upper_x
+                            || n.upper_y[k] < q.lower_y || n.lower_y[k] > q.upper_y
+                            || n.upper_z[k] < q.lower_z || n.lower_z[k] > q.upper_z;
+            mask |= (disjoint ? 0 : 1) << k;
+            }
+        return mask;
+#endif
+        }
+
+    //! Get the number of nodes
+    inline unsigned int getNumNodes() const
+        {
+        return (unsigned int)m_nodes.size();
+        }
+
+    //! Get the WideAABBNode
+    /*! \param node Index of the node to query
+     */
+    inline const WideAABBNode& getNode(unsigned int node) const
+        {
+        return m_nodes[node];
+        }
+
+    //! Get a child of a given node
+    /*! \param node Index of the node to query
+        \param k Child slot
+        \returns The index of the child node, or of its first particle when the child is a leaf
+     */
+    inline unsigned int getNodeChild(unsigned int node, unsigned int k) const
+        {
+        return m_nodes[node].child[k];
+        }
+
+    //! Get the number of particles in a child of a given node
+    /*! \param node Index of the node to query
+        \param k Child slot
+        \returns The number of particles in the leaf, or 0 when the child is not a leaf
+     */
+    inline unsigned int getNodeChildNumParticles(unsigned int node, unsigned int k) const
+        {
+        return m_nodes[node].num_particles[k];
+        }
+
+    //! Get a particle index
+    /*! \param i Index in the particle list
+     */
+    inline unsigned int getParticle(unsigned int i) const
+        {
+        return m_particles[i];
+        }
+
+    //! Get the tag associated with a particle
+    /*! \param i Index in the particle list
+     */
+    inline unsigned int getParticleTag(unsigned int i) const
+        {
+        return m_particle_tags[i];
+        }
+
+    private:
+    static_assert(WIDE_NODE_WIDTH == 4, "overlapMask() assumes 4 children per node");
+
+    std::vector<WideAABBNode> m_nodes;         //!< The nodes of the tree
+    std::vector<unsigned int> m_particles;     //!< Particle indices, grouped by leaf
+    std::vector<unsigned int> m_particle_tags; //!< Particle tags, grouped by leaf
+    std::vector<AABB> m_aabb_right;            //!< Temporary AABB list used during the build
+    std::vector<unsigned int> m_idx_right;     //!< Temporary index list used during the build
+
+    //! Build a node and its descendants
+    inline unsigned int buildNode(AABB* aabbs, unsigned int start, unsigned int len);
+
+    //! Merge a range of AABBs
+    static inline AABB mergeRange(const AABB* aabbs, unsigned int len)
+        {
+        AABB result = aabbs[0];
+        for (unsigned int i = 1; i < len; i++)
+            result = merge(result, aabbs[i]);
+        return result;
+        }
+
+    //! Set the bounds and contents of a child slot
+    inline void setChild(unsigned int node,
+                         unsigned int k,
+                         const AABB& aabb,
+                         unsigned int child,
+                         unsigned int num_particles);
+    };
+
+/*! \param aabbs List of AABBs for each particle (must be 32-byte aligned)
+    \param N Number of AABBs in the list
+
+    Data in \a aabbs will be modified during the construction process.
+*/
+inline void WideAABBTree::buildTree(AABB* aabbs, unsigned int N)
+    {
+    m_nodes.clear();
+    m_particles.clear();
+    m_particle_tags.clear();
+
+    if (N == 0)
+        return;
+
+    // buildNode() permutes m_particles along with aabbs, so that each leaf owns a contiguous range
+    m_particles.resize(N);
+    std::iota(m_particles.begin(), m_particles.end(), 0);
+    buildNode(aabbs, 0, N);
+
+    m_particle_tags.resize(N);
+    for (unsigned int i = 0; i < N; i++)
+        m_particle_tags[i] = aabbs[i].tag;
+    }
+
+/*! \param hits Output vector of positive hits.
+    \param aabb The AABB to query
+    \returns the number of nodes tested during the traversal
+
+    The *hits* vector is not cleared, elements are only added with push_back. query() traverses the
+    tree and adds the index of every particle in each leaf that intersects *aabb* to the hits
+    vector.
+*/
+inline unsigned int WideAABBTree::query(std::vector<unsigned int>& hits, const AABB& aabb) const
+    {
+    unsigned int node_overlap_counts = 0;
+    if (m_nodes.empty())
+        return node_overlap_counts;
+
+    WideAABBQuery q(aabb);
+    std::vector<unsigned int> stack(1, 0);
+    while (!stack.empty())
+        {
+        unsigned int node = stack.back();
+        stack.pop_back();
+
+        node_overlap_counts++;
+        unsigned int mask = overlapMask(node, q);
+        for (unsigned int k = 0; k < WIDE_NODE_WIDTH; k++)
+            {
+            if (!(mask & (1 << k)))
+                continue;
+
+            const unsigned int child = m_nodes[node].child[k];
+            const unsigned int num_particles = m_nodes[node].num_particles[k];
+            if (num_particles == 0)
+                {
+                stack.push_back(child);
+                }
+            else
+                {
+                for (unsigned int i = child; i < child + num_particles; i++)
+                    hits.push_back(m_particles[i]);
+                }
+            }
+        }
+
+    return node_overlap_counts;
+    }
+
+/*! \param aabbs List of AABBs
+    \param start Start point in aabbs and m_particles to examine
+    \param len Number of aabbs to examine
+    \returns Index of the new node
+
+    The node owns the particles start to start + len. It splits the range with the largest surface
+   area until it has WIDE_NODE_WIDTH ranges or every range fits in a leaf, then builds a child node
+   for each range that does not fit in a leaf. Nodes are allocated in depth first order, so the root
+   is node 0.
+*/
+inline unsigned int WideAABBTree::buildNode(AABB* aabbs, unsigned int start, unsigned int len)
+    {
+    unsigned int range_start[WIDE_NODE_WIDTH] = {start};
+    unsigned int range_len[WIDE_NODE_WIDTH] = {len};
+    AABB range_aabb[WIDE_NODE_WIDTH];
+    range_aabb[0] = mergeRange(aabbs + start, len);
+    unsigned int num_children = 1;
+
+    while (num_children < WIDE_NODE_WIDTH)
+        {
+        unsigned int split = WIDE_NODE_WIDTH;
+        Scalar split_area = Scalar(-1.0);
+        for (unsigned int k = 0; k < num_children; k++)
+            {
+            if (range_len[k] <= NODE_CAPACITY)
+                continue;
+
+            Scalar area = AABBTree::surfaceArea(range_aabb[k]);
+            if (area > split_area)
+                {
+                split = k;
+                split_area = area;
+                }
+            }
+
+        if (split == WIDE_NODE_WIDTH)
+            break;
+
+        const unsigned int s = range_start[split];
+        const unsigned int l = range_len[split];
+        const unsigned int left_len = AABBTree::partitionSAH(aabbs + s,
+                                                             m_particles.data() + s,
+                                                             l,
+                                                             m_aabb_right,
+                                                             m_idx_right);
+
+        range_len[split] = left_len;
+        range_aabb[split] = mergeRange(aabbs + s, left_len);
+        range_start[num_children] = s + left_len;
+        range_len[num_children] = l - left_len;
+        range_aabb[num_children] = mergeRange(aabbs + s + left_len, l - left_len);
+        num_children++;
+        }
+
+    unsigned int my_idx = (unsigned int)m_nodes.size();
+    m_nodes.push_back(WideAABBNode());
+
+    for (unsigned int k = 0; k < num_children; k++)
+        {
+        if (range_len[k] <= NODE_CAPACITY)
+            {
+            setChild(my_idx, k, range_aabb[k], range_start[k], range_len[k]);
+            }
+        else
+            {
+            // buildNode() may reallocate m_nodes, so set the child after the call
+            unsigned int child = buildNode(aabbs, range_start[k], range_len[k]);
+            setChild(my_idx, k, range_aabb[k], child, 0);
+            }
+        }
+
+    return my_idx;
+    }
+
+/*! \param node Index of the wide node
+    \param k Child slot
+    \param aabb Bounds of the child
+    \param child Index of the child node, or of the first particle of a leaf
+    \param num_particles Number of particles in a leaf, 0 for an internal child
+*/
+inline void WideAABBTree::setChild(unsigned int node,
+                                   unsigned int k,
+                                   const AABB& aabb,
+                                   unsigned int child,
+                                   unsigned int num_particles)
+    {
+    WideAABBQuery bounds(aabb);
+    WideAABBNode& n = m_nodes[node];
+    n.lower_x[k] = bounds.lower_x;
+    n.lower_y[k] = bounds.lower_y;
+    n.lower_z[k] = bounds.lower_z;
+    n.upper_x[k] = bounds.upper_x;
+    n.upper_y[k] = bounds.upper_y;
+    n.upper_z[k] = bounds.upper_z;
+    n.child[k] = child;
+    n.num_particles[k] = num_particles;
+    }
+
+#endif // __HIPCC__
+
+    }; // end namespace detail
+
+    }; // end namespace hoomd
+
+#endif //__WIDE_AABB_TREE_H__
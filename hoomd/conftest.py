@@ -588,6 +588,39 @@ def autotuned_kernel_parameter_check(instance, activate, all_optional=False):
         assert instance.kernel_parameters == initial_kernel_parameters
 
 
+@pytest.fixture(params=(2, 3), ids=lambda n: f"num_cpu_threads_{n}")
+def evaluate_cpu_threads(request, device, simulation_factory):
+    """Compare simulations on one CPU thread with simulations on several.
+
+    The fixture is parameterized over the number of threads. It returns a
+    function ``evaluate(snapshot, simulate)`` that creates a simulation from
+    *snapshot* with 1 CPU thread and then twice with the parameter's number of
+    threads. It calls ``simulate(sim)`` on each and returns the list of the
+    three results. The second threaded result tests that repeated evaluations
+    are identical. ``evaluate`` restores ``device.num_cpu_threads`` when done.
+
+    Tests that use this fixture are skipped on the GPU and when HOOMD is built
+    without TBB.
+    """
+    if not hoomd.version.tbb_enabled:
+        pytest.skip("TBB threading is not enabled")
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip("Threading applies only to the CPU")
+
+    def evaluate(snapshot, simulate):
+        original_num_cpu_threads = device.num_cpu_threads
+        try:
+            results = []
+            for n in (1, request.param, request.param):
+                device.num_cpu_threads = n
+                results.append(simulate(simulation_factory(snapshot)))
+            return results
+        finally:
+            device.num_cpu_threads = original_num_cpu_threads
+
+    return evaluate
+
+
 class ListWriter(hoomd.custom.Action):
     """Log a single quantity to a list.
 
@@ -529,6 +529,62 @@ extern "C"
                         uint8_t flags,
                         const void* data);
 
+    /** Add a data chunk to the current frame and reserve space for its data in the file.
+
+        @param handle Handle to an open GSD file.
+        @param name Name of the data chunk.
+        @param type type ID that identifies the type of data in the chunk.
+        @param N Number of rows in the data.
+        @param M Number of columns in the data.
+        @param flags set to 0, non-zero values reserved for future use.
+        @param location Set to the offset in the file where the data starts.
+
+        @pre *handle* was opened by gsd_open().
+        @pre *name* is a unique name for data chunks in the given frame.
+
+        @post The index is present in the buffer and `N * M * gsd_sizeof_type(type)` bytes at the
+              end of the file are reserved for the data.
+
+        Write the data with one or more calls to gsd_write_reserved_chunk_data() before ending the
+        frame. Use this function instead of gsd_write_chunk() when the data does not fit in memory
+        at once.
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *location* is NULL, *M* == 0, or
+            *flags* != 0.
+          - GSD_ERROR_FILE_MUST_BE_WRITABLE: The file was opened read-only.
+          - GSD_ERROR_NAMELIST_FULL: The file cannot store any additional unique chunk names.
+          - GSD_ERROR_MEMORY_ALLOCATION_FAILED: failed to allocate memory.
+    */
+    int gsd_reserve_chunk(struct gsd_handle* handle,
+                          const char* name,
+                          enum gsd_type type,
+                          uint64_t N,
+                          uint32_t M,
+                          uint8_t flags,
+                          uint64_t* location);
+
+    /** Write part of the data of a chunk reserved with gsd_reserve_chunk().
+
+        @param handle Handle to an open GSD file.
+        @param location Offset in the file to write to.
+        @param data Data buffer.
+        @param size Number of bytes to write.
+
+        @pre [*location*, *location* + *size*) lies in the space reserved by gsd_reserve_chunk().
+
+        @return
+          - GSD_SUCCESS (0) on success. Negative value on failure:
+          - GSD_ERROR_IO: IO error (check errno).
+          - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, or *size* > 0 and *data* is NULL.
+          - GSD_ERROR_FILE_MUST_BE_WRITABLE: The file was opened read-only.
+    */
+    int gsd_write_reserved_chunk_data(struct gsd_handle* handle,
+                                      uint64_t location,
+                                      const void* data,
+                                      size_t size);
+
     /** Find a chunk in the GSD file.
 
         @param handle Handle to an open GSD file
@@ -11,6 +11,12 @@
 #include "IntegratorHPMCMono.h"
 #include "hoomd/RNGIdentifiers.h"
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file ComputeFreeVolume.h
     \brief Defines the template class for an approximate free volume integration
     \note This header cannot be compiled by nvcc
@@ -118,11 +124,14 @@ template<class Shape> void ComputeFreeVolume<Shape>::compute(uint64_t timestep)
     }
 
 /*! \return the current free volume estimate by MC integration
+
+    With TBB, the test insertions are distributed over the CPU threads, each counting overlaps
+    separately. Every insertion draws from its own random number stream, so the total count is
+    identical to the serial one.
  */
 template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t timestep)
     {
     unsigned int overlap_count = 0;
-    unsigned int err_count = 0;
     unsigned int ndim = this->m_sysdef->getNDimensions();
 
     this->m_exec_conf->msg->notice(5) << "HPMC computing free volume " << timestep << std::endl;
@@ -164,8 +173,9 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
         n_sample /= this->m_exec_conf->getNRanks();
 #endif
 
-        for (unsigned int i = 0; i < n_sample; i++)
-            {
+        // test one insertion, return true when it overlaps
+        auto test_insertion = [&](unsigned int i, unsigned int& err_count)
+        {
             // select a random particle coordinate in the box
             hoomd::RandomGenerator rng_i(
                 hoomd::Seed(hoomd::RNGIdentifier::ComputeFreeVolume, timestep, seed),
@@ -251,11 +261,42 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
                     break;
                 } // end loop over images
 
-            if (overlap)
+            return overlap;
+        };
+
+#ifdef ENABLE_TBB
+        tbb::enumerable_thread_specific<unsigned int> thread_overlap_count(0);
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_sample),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      unsigned int& count = thread_overlap_count.local();
+                                      unsigned int err_count = 0;
+                                      for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                          {
+                                          if (test_insertion(i, err_count))
+                                              {
+                                              count++;
+                                              }
+                                          }
+                                  });
+            });
+        for (unsigned int count : thread_overlap_count)
+            {
+            overlap_count += count;
+            }
+#else
+        unsigned int err_count = 0;
+        for (unsigned int i = 0; i < n_sample; i++)
+            {
+            if (test_insertion(i, err_count))
                 {
                 overlap_count++;
                 }
-            } // end loop through all particles
+            }
+#endif
 
         } // end lexical scope
 
@@ -15,6 +15,11 @@
 #include "hoomd/HOOMDMPI.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file ComputeSDF.h
     \brief Defines the template class for an sdf compute
     \note This header cannot be compiled by nvcc
@@ -168,6 +173,11 @@ template<class Shape> class ComputeSDF : public Compute
     std::vector<double> m_hist_expansion;   //!< Raw histogram data
     std::vector<double> m_sdf_expansion;    //!< Computed SDF
 
+    std::vector<size_t> m_particle_bin_compression;    //!< Compression bin of each particle
+    std::vector<size_t> m_particle_bin_expansion;      //!< Expansion bin of each particle
+    std::vector<double> m_particle_weight_compression; //!< Compression weight of each particle
+    std::vector<double> m_particle_weight_expansion;   //!< Expansion weight of each particle
+
     //! Find the maximum particle separation beyond which all interactions are zero
     Scalar getMaxInteractionDiameter();
     Scalar m_last_max_diam; //!< Last recorded maximum diameter
@@ -180,6 +190,9 @@ template<class Shape> class ComputeSDF : public Compute
     void countHistogramBinarySearch(uint64_t timestep);
     void countHistogramLinearSearch(uint64_t timestep);
 
+    //! Call f(i) for every local particle i, in parallel when TBB is enabled
+    template<class Func> void forEachParticle(const Func& f);
+
     //! Determine the s bin of a given particle pair; only used for the binary search
     size_t computeBin(const vec3<Scalar>& r_ij,
                       const quat<Scalar>& orientation_i,
@@ -346,6 +359,10 @@ template<class Shape> Scalar ComputeSDF<Shape>::getMaxInteractionDiameter()
     without any communication.
       - The integrator performs the ghost exchange (with the ghost width extra that we add)
 
+    With TBB, the particles are searched in parallel in the integrator's AABB tree. The bin and
+    weight of each particle are stored and added to the histogram in particle order afterwards, so
+    the histogram is identical to the serial one.
+
     This function is a wrapper that calls the appropriate method depending on whether a binary or
     linear search is required.
 */
@@ -361,6 +378,30 @@ template<class Shape> void ComputeSDF<Shape>::countHistogram(uint64_t timestep)
         }
     } // end countHistogram()
 
+template<class Shape> template<class Func> void ComputeSDF<Shape>::forEachParticle(const Func& f)
+    {
+    const unsigned int N = m_pdata->getN();
+#ifdef ENABLE_TBB
+    m_exec_conf->getTaskArena()->execute(
+        [&]
+        {
+            tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                              [&](const tbb::blocked_range<unsigned int>& r)
+                              {
+                                  for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                      {
+                                      f(i);
+                                      }
+                              });
+        });
+#else
+    for (unsigned int i = 0; i < N; i++)
+        {
+        f(i);
+        }
+#endif
+    }
+
 template<class Shape> void ComputeSDF<Shape>::countHistogramBinarySearch(uint64_t timestep)
     {
     // update the aabb tree
@@ -381,9 +422,11 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramBinarySearch(uint64_
     const std::vector<param_type, hoomd::detail::managed_allocator<param_type>>& params
         = m_mc->getParams();
 
-    // loop through N particles
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        {
+    m_particle_bin_compression.resize(m_pdata->getN());
+
+    // find the bin of each particle
+    auto count_particle = [&](unsigned int i)
+    {
         size_t min_bin = m_hist_compression.size();
         // read in the current position and orientation
         Scalar4 postype_i = h_postype.data[i];
@@ -449,11 +492,19 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramBinarySearch(uint64_
                     }
                 } // end loop over AABB nodes
             }     // end loop over images
+        m_particle_bin_compression[i] = min_bin;
+    };
+    forEachParticle(count_particle);
+
+    // add the particles to the histogram in order
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        size_t min_bin = m_particle_bin_compression[i];
         if (min_bin < m_hist_compression.size())
             {
             m_hist_compression[min_bin]++;
             }
-        } // end loop over all particles
+        }
     }     // end countHistogramBinarySearch()
 
 template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_t timestep)
@@ -486,6 +537,12 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_
     const LongReal min_core_radius = m_mc->getMinCoreDiameter() * LongReal(0.5);
     const auto& pair_energy_search_radius = m_mc->getPairEnergySearchRadius();
 
+    const unsigned int N = m_pdata->getN();
+    m_particle_bin_compression.resize(N);
+    m_particle_bin_expansion.resize(N);
+    m_particle_weight_compression.resize(N);
+    m_particle_weight_expansion.resize(N);
+
     // loop through N particles
     // At the top of this loop, we initialize min_bin to the size of the sdf histogram
     // For each of particle i's neighbors, we find the scaling that produces the first overlap.
@@ -493,8 +550,8 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_
     // up to the minimum bin that we've already found for particle i.
     // Then we add to m_hist_compression[min_bin] the negative Mayer-function corresponding to the
     // type of overlap corresponding to particle i's first overlap.
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        {
+    auto count_particle = [&](unsigned int i)
+    {
         size_t min_bin_compression = m_hist_compression.size();
         size_t min_bin_expansion = m_hist_expansion.size();
         double hist_weight_ptl_i_compression = 2.0;
@@ -690,15 +747,30 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_
                     }
                 } // end loop over AABB nodes
             }     // end loop over images
+        m_particle_bin_compression[i] = min_bin_compression;
+        m_particle_bin_expansion[i] = min_bin_expansion;
+        m_particle_weight_compression[i] = hist_weight_ptl_i_compression;
+        m_particle_weight_expansion[i] = hist_weight_ptl_i_expansion;
+    };
+    forEachParticle(count_particle);
+
+    // add the particles to the histogram in order so that the sums do not depend on the threads
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        const size_t min_bin_compression = m_particle_bin_compression[i];
+        const double hist_weight_ptl_i_compression = m_particle_weight_compression[i];
         if (min_bin_compression < m_hist_compression.size() && hist_weight_ptl_i_compression <= 1.0)
             {
             m_hist_compression[min_bin_compression] += hist_weight_ptl_i_compression;
             }
+
+        const size_t min_bin_expansion = m_particle_bin_expansion[i];
+        const double hist_weight_ptl_i_expansion = m_particle_weight_expansion[i];
         if (min_bin_expansion < m_hist_expansion.size() && hist_weight_ptl_i_expansion <= 1.0)
             {
             m_hist_expansion[min_bin_expansion] += hist_weight_ptl_i_expansion;
             }
-        } // end loop over all particles
+        }
     }     // end countHistogramLinearSearch()
 
 /*! \param r_ij Vector pointing from particle i to j (already wrapped into the box)
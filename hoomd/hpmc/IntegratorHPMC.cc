@@ -45,6 +45,29 @@ IntegratorHPMC::IntegratorHPMC(std::shared_ptr<SystemDefinition> sysdef)
 
     resetStats();
 
+    // the names match the loggable properties of hoomd.hpmc.integrate.HPMCIntegrator
+    LoggableQuantity translate_moves;
+    translate_moves.width = 2;
+    translate_moves.get_int = [this](uint64_t, int64_t* out)
+    {
+        auto counts = getCounters(1).getTranslateCounts();
+        out[0] = counts.first;
+        out[1] = counts.second;
+    };
+    registerLoggable("translate_moves", translate_moves);
+
+    LoggableQuantity rotate_moves;
+    rotate_moves.width = 2;
+    rotate_moves.get_int = [this](uint64_t, int64_t* out)
+    {
+        auto counts = getCounters(1).getRotateCounts();
+        out[0] = counts.first;
+        out[1] = counts.second;
+    };
+    registerLoggable("rotate_moves", rotate_moves);
+
+    registerLoggable("mps", [this](uint64_t) { return getMPS(); });
+
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
@@ -264,6 +287,13 @@ void export_IntegratorHPMC(pybind11::module& m)
         .def("communicate", &IntegratorHPMC::communicate)
         .def("computeTotalPairEnergy", &IntegratorHPMC::computeTotalPairEnergy)
         .def_property("nselect", &IntegratorHPMC::getNSelect, &IntegratorHPMC::setNSelect)
+        .def_property("checkerboard",
+                      &IntegratorHPMC::getCheckerboard,
+                      &IntegratorHPMC::setCheckerboard)
+        .def("getNumCheckerboardSweeps", &IntegratorHPMC::getNumCheckerboardSweeps)
+        .def_property("aabb_refit_threshold",
+                      &IntegratorHPMC::getAABBRefitThreshold,
+                      &IntegratorHPMC::setAABBRefitThreshold)
         .def_property("translation_move_probability",
                       &IntegratorHPMC::getTranslationMoveProbability,
                       &IntegratorHPMC::setTranslationMoveProbability)
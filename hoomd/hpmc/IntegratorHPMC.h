@@ -331,6 +331,36 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return m_nselect;
         }
 
+    //! Set whether to move particles in non-interacting cells concurrently
+    void setCheckerboard(bool checkerboard)
+        {
+        m_checkerboard = checkerboard;
+        }
+
+    //! Get whether to move particles in non-interacting cells concurrently
+    bool getCheckerboard()
+        {
+        return m_checkerboard;
+        }
+
+    //! Get the number of sweeps that moved particles in checkerboard cells
+    uint64_t getNumCheckerboardSweeps()
+        {
+        return m_checkerboard_sweeps;
+        }
+
+    //! Set the relative query cost at which a refit AABB tree is rebuilt
+    void setAABBRefitThreshold(Scalar threshold)
+        {
+        m_aabb_refit_threshold = threshold;
+        }
+
+    //! Get the relative query cost at which a refit AABB tree is rebuilt
+    Scalar getAABBRefitThreshold()
+        {
+        return m_aabb_refit_threshold;
+        }
+
     //! Get performance in moves per second
     virtual double getMPS()
         {
@@ -545,6 +575,9 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     protected:
     unsigned int m_translation_move_probability; //!< Fraction of moves that are translation moves.
     unsigned int m_nselect;                      //!< Number of particles to select for trial moves
+    bool m_checkerboard = false; //!< True to move particles in non-interacting cells concurrently
+    uint64_t m_checkerboard_sweeps = 0; //!< Number of sweeps that used the checkerboard
+    Scalar m_aabb_refit_threshold = 0.0; //!< Rebuild a refit AABB tree above this relative cost
 
     GPUVector<Scalar> m_d; //!< Maximum move displacement by type
     GPUVector<Scalar> m_a; //!< Maximum angular displacement by type
@@ -445,6 +445,8 @@ class IntegratorHPMCMono : public IntegratorHPMC
         hoomd::detail::AABB* m_aabbs;                      //!< list of AABBs, one per particle
         unsigned int m_aabbs_capacity;              //!< Capacity of m_aabbs list
         bool m_aabb_tree_invalid;                   //!< Flag if the aabb tree has been invalidated
+        bool m_aabb_tree_moved;                     //!< Flag if particles moved since the aabb tree was built
+        Scalar m_aabb_tree_build_cost;              //!< Query cost estimate of the aabb tree when it was built
 
         Scalar m_extra_image_width;                 //! Extra width to extend the image list
 
@@ -456,6 +458,53 @@ class IntegratorHPMCMono : public IntegratorHPMC
         /// Cached shape radius by type.
         std::vector<LongReal> m_shape_circumsphere_radius;
 
+        /* Checkerboard sweep related data members */
+
+        static const unsigned int checkerboard_no_cell = 0xffffffff; //!< Cell of particles that do not move
+
+        Index3D m_checkerboard_indexer;                       //!< Indexer for the checkerboard cells
+        Scalar3 m_checkerboard_shift;                         //!< Grid shift in fractional coordinates
+        std::vector<unsigned int> m_checkerboard_cell;        //!< Checkerboard cell of each particle
+        std::vector<unsigned int> m_checkerboard_set;         //!< Set of the checkerboard cell of each particle
+        std::vector<unsigned int> m_checkerboard_cell_start;  //!< First entry of each cell in m_checkerboard_particles
+        std::vector<unsigned int> m_checkerboard_particles;   //!< Local particles sorted by cell, in update order
+        std::vector< std::vector<unsigned int> > m_checkerboard_set_cells; //!< Non-empty cells in each set
+        std::vector<unsigned int> m_checkerboard_set_order;   //!< Order in which to sweep the sets
+
+        //! Assign the local particles to the cells of a randomly shifted checkerboard
+        bool buildCheckerboard(uint64_t timestep, unsigned int i_nselect, Scalar width);
+
+        //! Grow the AABBs of the local particles to cover their next trial move
+        void expandCheckerboardAABBs(const Scalar4* h_postype, const Scalar* h_d);
+
+        //! Perform trial moves for the particles in one checkerboard cell
+        template<class TrialMove>
+        void moveCheckerboardCell(unsigned int cell, hpmc_counters_t& counters, const TrialMove& trial_move)
+            {
+            for (unsigned int k = m_checkerboard_cell_start[cell]; k < m_checkerboard_cell_start[cell + 1]; k++)
+                {
+                trial_move(m_checkerboard_particles[k], counters, cell);
+                }
+            }
+
+        //! Compute the checkerboard cell of a position
+        unsigned int computeCheckerboardCell(const vec3<Scalar>& pos, const BoxDim& box) const
+            {
+            Scalar3 f = box.makeFraction(vec_to_scalar3(pos)) + m_checkerboard_shift;
+            int3 dim = make_int3(m_checkerboard_indexer.getW(), m_checkerboard_indexer.getH(), m_checkerboard_indexer.getD());
+
+            // wrap the cell index, the shifted grid extends across the boundary (2D boxes have a single
+            // layer of cells)
+            int3 c = make_int3(int(floor(f.x * dim.x)) % dim.x,
+                               int(floor(f.y * dim.y)) % dim.y,
+                               dim.z > 1 ? int(floor(f.z * dim.z)) % dim.z : 0);
+            c.x += c.x < 0 ? dim.x : 0;
+            c.y += c.y < 0 ? dim.y : 0;
+            c.z += c.z < 0 ? dim.z : 0;
+
+            return m_checkerboard_indexer(c.x, c.y, c.z);
+            }
+
         /* Depletants related data members */
 
         GlobalVector<Scalar> m_fugacity;            //!< Average depletant number density in free volume, per type
@@ -535,6 +584,8 @@ IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition>
     m_aabbs = NULL;
     m_aabbs_capacity = 0;
     m_aabb_tree_invalid = true;
+    m_aabb_tree_moved = false;
+    m_aabb_tree_build_cost = 0.0;
 
     m_fugacity.resize(this->m_pdata->getNTypes(), 0.0);
     m_ntrial.resize(m_fugacity.getNumElements(), 1);
@@ -670,9 +721,35 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
         m_max_pair_additive_cutoff.push_back(getMaxPairInteractionAdditiveRCut(type));
         }
 
+    // Move particles in non-interacting cells concurrently when requested. Depletants, external
+    // fields, and patch energies are not safe to evaluate from multiple threads.
+    bool checkerboard = m_checkerboard && !has_depletants && !m_external && !m_patch;
+
+    // cells must be at least as wide as the largest distance between interacting particles
+    Scalar checkerboard_width = 0;
+    LongReal max_pair_additive_cutoff = 0;
+    for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+        {
+        checkerboard_width = std::max(checkerboard_width, Scalar(2.0 * m_shape_circumsphere_radius[type]));
+        max_pair_additive_cutoff = std::max(max_pair_additive_cutoff, m_max_pair_additive_cutoff[type]);
+        }
+    if (hasPairInteractions())
+        {
+        checkerboard_width = std::max(checkerboard_width, Scalar(getMaxPairEnergyRCutNonAdditive() + max_pair_additive_cutoff));
+        }
+
+    #ifdef ENABLE_TBB
+    tbb::enumerable_thread_specific<hpmc_counters_t> thread_counters;
+    #endif
+
     // loop over local particles nselect times
     for (unsigned int i_nselect = 0; i_nselect < m_nselect; i_nselect++)
         {
+        // assign the particles to the cells of a randomly shifted checkerboard, or fall back on the
+        // serial sweep when the box is too small
+        if (checkerboard)
+            checkerboard = buildCheckerboard(timestep, i_nselect, checkerboard_width);
+
         // access particle data and system box
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
@@ -685,11 +762,11 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
         ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
         ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
 
-        // loop through N particles in a shuffled order
-        for (unsigned int cur_particle = 0; cur_particle < m_pdata->getN(); cur_particle++)
+        // attempt one trial move of particle i. In a checkerboard sweep, cell_i is the cell of
+        // particle i: moves that leave the cell are rejected and particles in the other cells of
+        // the active set (which other threads may be moving) are ignored.
+        auto trial_move = [&](unsigned int i, hpmc_counters_t& counters, unsigned int cell_i)
             {
-            unsigned int i = m_update_order[cur_particle];
-
             // read in the current position and orientation
             Scalar4 postype_i = h_postype.data[i];
             vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
@@ -699,7 +776,7 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                 {
                 // only move particle if active
                 if (!isActive(make_scalar3(postype_i.x, postype_i.y, postype_i.z), box, ghost_fraction))
-                    continue;
+                    return;
                 }
             #endif
 
@@ -721,7 +798,7 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     {
                     if (!shape_i.ignoreStatistics())
                         counters.translate_accept_count++;
-                    continue;
+                    return;
                     }
 
                 move_translate(pos_i, rng_i, h_d.data[typ_i], ndim);
@@ -731,9 +808,17 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     {
                     // check if particle has moved into the ghost layer, and skip if it is
                     if (!isActive(vec_to_scalar3(pos_i), box, ghost_fraction))
-                        continue;
+                        return;
                     }
                 #endif
+
+                // reject moves that leave the checkerboard cell
+                if (cell_i != checkerboard_no_cell && computeCheckerboardCell(pos_i, box) != cell_i)
+                    {
+                    if (!shape_i.ignoreStatistics())
+                        counters.translate_reject_count++;
+                    return;
+                    }
                 }
             else
                 {
@@ -741,7 +826,7 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     {
                     if (!shape_i.ignoreStatistics())
                         counters.rotate_accept_count++;
-                    continue;
+                    return;
                     }
 
                 if (ndim == 2)
@@ -789,6 +874,11 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                 // read in its position and orientation
                                 unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
 
+                                // skip particles that other threads may be moving
+                                if (cell_i != checkerboard_no_cell && m_checkerboard_set[j] == m_checkerboard_set[i]
+                                    && m_checkerboard_cell[j] != cell_i)
+                                    continue;
+
                                 Scalar4 postype_j;
                                 quat<LongReal> orientation_j;
 
@@ -880,6 +970,11 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                     // read in its position and orientation
                                     unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
 
+                                    // skip particles that other threads may be moving
+                                    if (cell_i != checkerboard_no_cell && m_checkerboard_set[j] == m_checkerboard_set[i]
+                                        && m_checkerboard_cell[j] != cell_i)
+                                        continue;
+
                                     Scalar4 postype_j;
                                     quat<LongReal> orientation_j;
 
@@ -978,7 +1073,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     aabb = hoomd::detail::AABB(pos_i, radius);
                     }
 
-                m_aabb_tree.update(i, aabb);
+                // in a checkerboard sweep, expandCheckerboardAABBs() already covers the new position
+                if (cell_i == checkerboard_no_cell)
+                    m_aabb_tree.update(i, aabb);
 
                 // update position of particle
                 h_postype.data[i] = make_scalar4(pos_i.x,pos_i.y,pos_i.z,postype_i.w);
@@ -1003,9 +1100,57 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                         counters.rotate_reject_count++;
                     }
                 }
-            } // end loop over all particles
+            }; // end trial_move
+
+        if (checkerboard)
+            {
+            expandCheckerboardAABBs(h_postype.data, h_d.data);
+
+            for (unsigned int active_set : m_checkerboard_set_order)
+                {
+                const std::vector<unsigned int>& active_cells = m_checkerboard_set_cells[active_set];
+
+                // cells in the same set do not interact, move their particles concurrently
+                #ifdef ENABLE_TBB
+                m_exec_conf->getTaskArena()->execute([&]{
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, active_cells.size()),
+                    [&](const tbb::blocked_range<size_t>& r)
+                    {
+                    hpmc_counters_t& cell_counters = thread_counters.local();
+                    for (size_t cur_cell = r.begin(); cur_cell != r.end(); ++cur_cell)
+                        {
+                        moveCheckerboardCell(active_cells[cur_cell], cell_counters, trial_move);
+                        }
+                    });
+                }); // end task arena execute()
+                #else
+                for (unsigned int cell : active_cells)
+                    {
+                    moveCheckerboardCell(cell, counters, trial_move);
+                    }
+                #endif
+                }
+
+            m_checkerboard_sweeps++;
+            }
+        else
+            {
+            // loop through N particles in a shuffled order
+            for (unsigned int cur_particle = 0; cur_particle < m_pdata->getN(); cur_particle++)
+                {
+                trial_move(m_update_order[cur_particle], counters, checkerboard_no_cell);
+                }
+            }
         } // end loop over nselect
 
+    #ifdef ENABLE_TBB
+    // reduce the counters of the checkerboard sweep
+    for (const auto& c : thread_counters)
+        {
+        counters = counters + c;
+        }
+    #endif
+
         {
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
         ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
@@ -1050,8 +1195,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     // migrate and exchange particles
     communicate(true);
 
-    // all particle have been moved, the aabb tree is now invalid
-    m_aabb_tree_invalid = true;
+    // all particles have been moved, the aabb tree must be refit or rebuilt (communicate() invalidates
+    // the tree when the particle list changes)
+    m_aabb_tree_moved = true;
 
     // set current MPS value
     hpmc_counters_t run_counters = getCounters(1);
@@ -1707,6 +1853,10 @@ void IntegratorHPMCMono<Shape>::growAABBList(unsigned int N)
     this is on the next timestep. But in some cases (i.e. NPT), the tree may need to be rebuilt several times in a
     single step because of box volume moves.
 
+    update() sets m_aabb_tree_moved instead after a sweep. When the aabb refit threshold is positive and the number
+    of particles is unchanged, buildAABBTree() then refits the existing tree to the new particle AABBs. It rebuilds the
+    tree when the query cost estimate of the refit tree exceeds the threshold times the cost of the last built tree.
+
     Subclasses that override update() or other methods must be user to set m_aabb_tree_invalid appropriately, or
     erroneous simulations will result.
 
@@ -1715,9 +1865,9 @@ void IntegratorHPMCMono<Shape>::growAABBList(unsigned int N)
 template <class Shape>
 const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
     {
-    if (m_aabb_tree_invalid)
+    if (m_aabb_tree_invalid || m_aabb_tree_moved)
         {
-        m_exec_conf->msg->notice(8) << "Building AABB tree: " << m_pdata->getN() << " ptls " << m_pdata->getNGhosts() << " ghosts" << std::endl;
+        m_exec_conf->msg->notice(8) << "Updating AABB tree: " << m_pdata->getN() << " ptls " << m_pdata->getNGhosts() << " ghosts" << std::endl;
         // build the AABB tree
             {
             ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
@@ -1754,16 +1904,155 @@ const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
                         m_aabbs[i] = hoomd::detail::AABB(vec3<Scalar>(h_postype.data[i]), radius);
                         }
                     }
-                m_aabb_tree.buildTree(m_aabbs, n_aabb);
+
+                bool refit = !m_aabb_tree_invalid && m_aabb_refit_threshold > Scalar(0.0)
+                             && m_aabb_tree.getNumParticles() == n_aabb;
+                if (refit)
+                    {
+                    m_aabb_tree.refit(m_aabbs, n_aabb);
+                    refit = m_aabb_tree.getCost() <= m_aabb_refit_threshold * m_aabb_tree_build_cost;
+                    }
+
+                if (!refit)
+                    {
+                    m_exec_conf->msg->notice(8) << "Rebuilding AABB tree" << std::endl;
+                    m_aabb_tree.buildTree(m_aabbs, n_aabb);
+                    m_aabb_tree_build_cost = m_aabb_tree.getCost();
+                    }
                 }
             }
 
         }
 
     m_aabb_tree_invalid = false;
+    m_aabb_tree_moved = false;
     return m_aabb_tree;
     }
 
+/*! \param timestep Current time step
+    \param i_nselect Index of the current sweep in the time step
+    \param width Largest distance between interacting particles
+    \returns false when the local box is too small for a checkerboard
+
+    Divide the local box into an even number of cells at least \a width wide in each direction and
+    assign the cells to 2^ndim sets by the parity of their cell coordinates. Cells in the same set are
+    separated by at least one cell, so particles in different cells of the same set do not interact
+    as long as they stay in their cells. The grid shift and the order of the sets are chosen randomly
+    in each sweep so that every particle has the same chance to move.
+*/
+template <class Shape>
+bool IntegratorHPMCMono<Shape>::buildCheckerboard(uint64_t timestep, unsigned int i_nselect, Scalar width)
+    {
+    const BoxDim box = m_pdata->getBox();
+    unsigned int ndim = m_sysdef->getNDimensions();
+    Scalar3 npd = box.getNearestPlaneDistance();
+
+    if (width <= Scalar(0.0))
+        return false;
+
+    // round down to an even number of cells so that the parity alternates across the boundary
+    uint3 dim = make_uint3(2 * (unsigned int)(npd.x / (Scalar(2.0) * width)),
+                           2 * (unsigned int)(npd.y / (Scalar(2.0) * width)),
+                           ndim == 3 ? 2 * (unsigned int)(npd.z / (Scalar(2.0) * width)) : 1);
+    if (dim.x < 2 || dim.y < 2 || (ndim == 3 && dim.z < 2))
+        return false;
+
+    m_checkerboard_indexer = Index3D(dim.x, dim.y, dim.z);
+    unsigned int n_cells = m_checkerboard_indexer.getNumElements();
+
+    hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoCheckerboard, timestep, m_sysdef->getSeed()),
+                               hoomd::Counter(m_exec_conf->getRank(), i_nselect));
+    m_checkerboard_shift.x = hoomd::UniformDistribution<Scalar>(0, Scalar(1.0) / dim.x)(rng);
+    m_checkerboard_shift.y = hoomd::UniformDistribution<Scalar>(0, Scalar(1.0) / dim.y)(rng);
+    m_checkerboard_shift.z = ndim == 3 ? hoomd::UniformDistribution<Scalar>(0, Scalar(1.0) / dim.z)(rng) : 0;
+
+    unsigned int n_sets = 1 << ndim;
+    m_checkerboard_set_order.resize(n_sets);
+    for (unsigned int s = 0; s < n_sets; s++)
+        {
+        m_checkerboard_set_order[s] = s;
+        }
+    for (unsigned int s = n_sets - 1; s > 0; s--)
+        {
+        std::swap(m_checkerboard_set_order[s], m_checkerboard_set_order[hoomd::UniformIntDistribution(s)(rng)]);
+        }
+
+    // assign the local particles to cells, ghost particles do not move
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    unsigned int N = m_pdata->getN();
+    m_checkerboard_cell.assign(N + m_pdata->getNGhosts(), checkerboard_no_cell);
+    m_checkerboard_set.assign(N + m_pdata->getNGhosts(), checkerboard_no_cell);
+    m_checkerboard_cell_start.assign(n_cells + 1, 0);
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        unsigned int cell = computeCheckerboardCell(vec3<Scalar>(h_postype.data[i]), box);
+        unsigned int cx = cell % dim.x;
+        unsigned int cy = (cell / dim.x) % dim.y;
+        unsigned int cz = cell / (dim.x * dim.y);
+
+        m_checkerboard_cell[i] = cell;
+        m_checkerboard_set[i] = (cx & 1) | ((cy & 1) << 1) | ((cz & 1) << 2);
+        m_checkerboard_cell_start[cell + 1]++;
+        }
+
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        {
+        m_checkerboard_cell_start[cell + 1] += m_checkerboard_cell_start[cell];
+        }
+
+    // sort the particles by cell, keeping the shuffled update order within each cell
+    std::vector<unsigned int> cell_size(n_cells, 0);
+    m_checkerboard_particles.resize(N);
+    for (unsigned int cur_particle = 0; cur_particle < N; cur_particle++)
+        {
+        unsigned int i = m_update_order[cur_particle];
+        unsigned int cell = m_checkerboard_cell[i];
+        m_checkerboard_particles[m_checkerboard_cell_start[cell] + cell_size[cell]] = i;
+        cell_size[cell]++;
+        }
+
+    m_checkerboard_set_cells.resize(n_sets);
+    for (auto& cells : m_checkerboard_set_cells)
+        {
+        cells.clear();
+        }
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        {
+        if (cell_size[cell] > 0)
+            {
+            unsigned int i = m_checkerboard_particles[m_checkerboard_cell_start[cell]];
+            m_checkerboard_set_cells[m_checkerboard_set[i]].push_back(cell);
+            }
+        }
+
+    return true;
+    }
+
+/*! \param h_postype Particle positions
+    \param h_d Maximum move displacement by type
+
+    Threads may not update the AABB tree while other threads search it. Instead, grow the AABB of each
+    local particle before the sweep to contain the particle anywhere within one translation move.
+*/
+template <class Shape>
+void IntegratorHPMCMono<Shape>::expandCheckerboardAABBs(const Scalar4* h_postype, const Scalar* h_d)
+    {
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        Scalar4 postype_i = h_postype[i];
+        unsigned int typ_i = __scalar_as_int(postype_i.w);
+
+        LongReal radius = m_shape_circumsphere_radius[typ_i];
+        if (hasPairInteractions())
+            {
+            radius = std::max(radius, LongReal(0.5) * m_max_pair_additive_cutoff[typ_i]);
+            }
+
+        m_aabb_tree.update(i, hoomd::detail::AABB(vec3<Scalar>(postype_i), radius + h_d[typ_i]));
+        }
+    }
+
 /*! Call to reduce the m_d values down to safe levels for the bvh tree + small box limitations. That code path
     will not work if particles can wander more than one image in a time step.
 
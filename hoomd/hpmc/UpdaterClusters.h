@@ -19,13 +19,16 @@
 #include "HPMCCounters.h"
 #include "IntegratorHPMCMono.h"
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
 #include <tbb/concurrent_unordered_map.h>
 #include <tbb/concurrent_unordered_set.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/parallel_for.h>
-#include <tbb/task.h>
-#include <atomic>
 
 #if TBB_VERSION_MAJOR < 2021
 #define ENABLE_TBB_TASK
@@ -41,49 +44,18 @@ namespace hpmc
 namespace detail
 {
 
-#ifdef ENABLE_TBB_TASK
-//! Wrapper around std::atomic_flag to allow use in a std::vector
-class my_atomic_flag
-    {
-    public:
-        //! Default constructor
-        my_atomic_flag()
-            {
-            f.clear();
-            }
-
-        //! Copy constructor
-        /*! \note this constructor doesn't really copy the value of its argument,
-            it just reset's the flag to zero
-         */
-        my_atomic_flag(const my_atomic_flag& other)
-            {
-            f.clear();
-            }
-
-        //! Assignment operator (non-atomic)
-        /*! \note this assignment operator doesn't really copy the value of its argument,
-            it just reset's the flag to zero
-         */
-        my_atomic_flag& operator =( const my_atomic_flag& other)
-            {
-            f.clear();
-            return *this;
-            }
-
-        //! Sets flag and returns old value
-        bool test_and_set()
-            {
-            return f.test_and_set();
-            }
-
-    private:
-        std::atomic_flag f;
-    };
-#endif
-
-// Graph class represents a undirected graph
-// using adjacency list representation
+//! Undirected graph stored as a flat list of edges
+/*! The connected components are found with a lock-free union-find (the CPU analog of the ECL-CC
+    algorithm used by UpdaterClustersGPU). Every vertex starts as its own root. Linking two
+    components points the root with the larger index to the root with the smaller index with an
+    atomic compare-and-swap, so the parent of a vertex never exceeds its own index and the root of
+    each component is its smallest vertex. With TBB and more than one CPU thread, the edges are
+    linked in parallel. The components are independent of the order in which the edges are linked,
+    and connectedComponents() returns them sorted by their smallest vertex with the vertices of
+    each component in ascending order.
+
+    addEdge() is thread-safe when ENABLE_TBB_TASK is set, where the edges are collected in parallel.
+*/
 class Graph
     {
     public:
@@ -93,179 +65,183 @@ class Graph
 
         inline Graph(unsigned int V);   // Constructor
 
+        //! Set the number of vertices and remove all edges
         inline void resize(unsigned int V);
 
+        //! Add an edge between v and w
         inline void addEdge(unsigned int v, unsigned int w);
 
-        #ifdef ENABLE_TBB_TASK
-        inline void connectedComponents(std::vector<tbb::concurrent_vector<unsigned int> >& cc);
-        #else
+        //! Gather the connected components
         inline void connectedComponents(std::vector<std::vector<unsigned int> >& cc);
-        #endif
 
-        #ifdef ENABLE_TBB_TASK
-        void setTaskArena(std::shared_ptr<tbb::task_arena> task_arena)
+        #ifdef ENABLE_TBB
+        //! Set the execution configuration that provides the CPU threads
+        void setExecConf(std::shared_ptr<const ExecutionConfiguration> exec_conf)
             {
-            m_task_arena = task_arena;
+            m_exec_conf = exec_conf;
             }
         #endif
 
     private:
-        #ifndef ENABLE_TBB_TASK
-        std::multimap<unsigned int,unsigned int> adj;
-        #else
-        tbb::concurrent_unordered_multimap<unsigned int, unsigned int> adj;
-        #endif
+        unsigned int m_V = 0;   //!< Number of vertices
 
-        #ifndef ENABLE_TBB_TASK
-        std::vector<unsigned int> visited;
+        #ifdef ENABLE_TBB_TASK
+        tbb::concurrent_vector<std::pair<unsigned int, unsigned int> > m_edges;
         #else
-        std::vector<my_atomic_flag> visited;
+        std::vector<std::pair<unsigned int, unsigned int> > m_edges;
         #endif
 
-        #ifdef ENABLE_TBB_TASK
-        /// The TBB task arena
-        std::shared_ptr<tbb::task_arena> m_task_arena;
-        #endif
+        //! Parent of each vertex in the union-find forest
+        std::unique_ptr<std::atomic<unsigned int>[]> m_parent;
+        unsigned int m_parent_capacity = 0;  //!< Allocated size of m_parent
 
-        #ifndef ENABLE_TBB_TASK
-        // A function used by DFS
-        inline void DFSUtil(unsigned int v, std::vector<unsigned int>& visited, std::vector<unsigned int>& cur_cc);
-        #endif
+        std::vector<unsigned int> m_root;    //!< Root of each vertex
+        std::vector<unsigned int> m_label;   //!< Component index of each root
 
-        #ifdef ENABLE_TBB_TASK
-        class DFSTask : public tbb::task
-            {
-            public:
-                DFSTask(unsigned int _root, std::vector<my_atomic_flag>& _visited,
-                    tbb::concurrent_vector<unsigned int>& _cc,
-                    const tbb::concurrent_unordered_multimap<unsigned int, unsigned int>& _adj)
-                    : root(_root), visited(_visited), cc(_cc), adj(_adj)
-                    { }
-
-                tbb::task* execute()
-                    {
-                    cc.push_back(root);
+        #ifdef ENABLE_TBB
+        std::shared_ptr<const ExecutionConfiguration> m_exec_conf;
+        #endif
 
-                    unsigned int count = 0;
-                    tbb::task_list list;
+        //! Find the root of v, halving the path on the way
+        inline unsigned int findRoot(unsigned int v);
 
-                    auto begin = adj.equal_range(root).first;
-                    auto end = adj.equal_range(root).second;
+        //! Merge the components of v and w
+        inline void link(unsigned int v, unsigned int w);
 
-                    for (auto it = begin; it != end; ++it)
-                        {
-                        unsigned int neighbor = it->second;
-                        if (!visited[neighbor].test_and_set())
-                            {
-                            if (count++ == 0)
-                                {
-                                root = neighbor; // for task recycling
-                                continue;
-                                }
-                            list.push_back(*new(allocate_child()) DFSTask(neighbor, visited, cc, adj));
-                            }
-                        }
+        //! Call f(first, last) on ranges that together cover [0, n), possibly in parallel
+        template<class Func>
+        void forEachRange(size_t n, const Func& f);
+    };
 
-                    if (count)
-                        {
-                        set_ref_count(count);
-                        spawn(list);
+Graph::Graph(unsigned int V)
+    {
+    resize(V);
+    }
 
-                        recycle_as_safe_continuation();
-                        }
+void Graph::resize(unsigned int V)
+    {
+    if (V > m_parent_capacity)
+        {
+        m_parent.reset(new std::atomic<unsigned int>[V]);
+        m_parent_capacity = V;
+        }
+    m_V = V;
+    m_edges.clear();
+    }
 
-                    return NULL;
-                    }
+void Graph::addEdge(unsigned int v, unsigned int w)
+    {
+    m_edges.push_back(std::make_pair(v,w));
+    }
 
-            private:
-                unsigned int root;
-                std::vector<my_atomic_flag> & visited;
-                tbb::concurrent_vector<unsigned int>& cc;
-                const tbb::concurrent_unordered_multimap<unsigned int, unsigned int>& adj;
-            };
-        #endif // ENABLE_TBB_TASK
+unsigned int Graph::findRoot(unsigned int v)
+    {
+    unsigned int cur = m_parent[v].load(std::memory_order_relaxed);
+    if (cur == v)
+        return v;
 
-    };
+    unsigned int prev = v;
+    unsigned int next;
+    while (cur > (next = m_parent[cur].load(std::memory_order_relaxed)))
+        {
+        // next is an ancestor of prev, so storing it is safe even when another thread has
+        // compressed the same path
+        m_parent[prev].store(next, std::memory_order_relaxed);
+        prev = cur;
+        cur = next;
+        }
+    return cur;
+    }
 
-// Gather connected components in an undirected graph
-#ifdef ENABLE_TBB_TASK
-void Graph::connectedComponents(std::vector<tbb::concurrent_vector<unsigned int> >& cc)
-#else
-void Graph::connectedComponents(std::vector<std::vector<unsigned int> >& cc)
-#endif
+void Graph::link(unsigned int v, unsigned int w)
     {
-    #ifdef ENABLE_TBB_TASK
-    this->m_task_arena->execute([&]{
-    for (unsigned int v = 0; v < visited.size(); ++v)
+    unsigned int root_v = findRoot(v);
+    unsigned int root_w = findRoot(w);
+
+    // hook the larger root onto the smaller one, retry when another thread moved the root first
+    while (root_v != root_w)
         {
-        if (! visited[v].test_and_set())
+        if (root_v < root_w)
             {
-            tbb::concurrent_vector<unsigned int> component;
-            DFSTask& a = *new(tbb::task::allocate_root()) DFSTask(v, visited, component, adj);
-            tbb::task::spawn_root_and_wait(a);
-            cc.push_back(component);
+            unsigned int expected = root_w;
+            if (m_parent[root_w].compare_exchange_strong(expected, root_v))
+                break;
+            root_w = findRoot(expected);
             }
-        }
-    }); // end task arena execute()
-    #else
-    std::fill(visited.begin(), visited.end(), 0);
-
-    // Depth first search
-    for (unsigned int v=0; v<visited.size(); v++)
-        {
-        if (visited[v] == false)
+        else
             {
-            std::vector<unsigned int> cur_cc;
-            DFSUtil(v, visited, cur_cc);
-            cc.push_back(cur_cc);
+            unsigned int expected = root_v;
+            if (m_parent[root_v].compare_exchange_strong(expected, root_w))
+                break;
+            root_v = findRoot(expected);
             }
         }
-    #endif
     }
 
-#ifndef ENABLE_TBB_TASK
-void Graph::DFSUtil(unsigned int v, std::vector<unsigned int>& visited, std::vector<unsigned int>& cur_cc)
+template<class Func>
+void Graph::forEachRange(size_t n, const Func& f)
     {
-    visited[v] = 1;
-    cur_cc.push_back(v);
-
-    // Recur for all the vertices
-    // adjacent to this vertex
-    auto begin = adj.equal_range(v).first;
-    auto end = adj.equal_range(v).second;
-    for(auto i = begin; i != end; ++i)
+    #ifdef ENABLE_TBB
+    if (m_exec_conf && m_exec_conf->getNumThreads() > 1)
         {
-        if(!visited[i->second])
-            DFSUtil(i->second, visited, cur_cc);
+        m_exec_conf->getTaskArena()->execute([&]{
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+            [&](const tbb::blocked_range<size_t>& r)
+            {
+            f(r.begin(), r.end());
+            });
+        }); // end task arena execute()
+        return;
         }
-    }
-#endif
-Graph::Graph(unsigned int V)
-    {
-    #ifndef ENABLE_TBB_TASK
-    visited.resize(V, 0);
-    #else
-    visited.resize(V);
     #endif
+
+    f(size_t(0), n);
     }
 
-void Graph::resize(unsigned int V)
+// Gather connected components in an undirected graph
+void Graph::connectedComponents(std::vector<std::vector<unsigned int> >& cc)
     {
-    #ifndef ENABLE_TBB_TASK
-    visited.resize(V, 0);
-    #else
-    visited.clear();
-    visited.resize(V);
-    #endif
+    // every vertex starts as its own component
+    forEachRange(m_V, [&](size_t first, size_t last)
+        {
+        for (size_t v = first; v < last; ++v)
+            m_parent[v].store((unsigned int)v, std::memory_order_relaxed);
+        });
 
-    adj.clear();
-    }
+    // merge the components along every edge
+    forEachRange(m_edges.size(), [&](size_t first, size_t last)
+        {
+        for (size_t e = first; e < last; ++e)
+            link(m_edges[e].first, m_edges[e].second);
+        });
 
-// method to add a directed edge
-void Graph::addEdge(unsigned int v, unsigned int w)
-    {
-    adj.insert(std::make_pair(v,w));
+    // find the root of every vertex, without compressing paths that other threads are reading
+    m_root.resize(m_V);
+    forEachRange(m_V, [&](size_t first, size_t last)
+        {
+        for (size_t v = first; v < last; ++v)
+            {
+            unsigned int root = (unsigned int)v;
+            unsigned int next;
+            while ((next = m_parent[root].load(std::memory_order_relaxed)) != root)
+                root = next;
+            m_root[v] = root;
+            }
+        });
+
+    // the root of each component is its smallest vertex, so one pass in vertex order numbers the
+    // components by their smallest vertex and lists the vertices in ascending order
+    m_label.resize(m_V);
+    for (unsigned int v = 0; v < m_V; ++v)
+        {
+        unsigned int root = m_root[v];
+        if (root == v)
+            {
+            m_label[v] = (unsigned int)cc.size();
+            cc.emplace_back();
+            }
+        cc[m_label[root]].push_back(v);
+        }
     }
 } // end namespace detail
 
@@ -365,11 +341,7 @@ class UpdaterClusters : public Updater
 
         unsigned int m_instance=0;                  //!< Unique ID for RNG seeding
 
-        #ifdef ENABLE_TBB_TASK
-        std::vector<tbb::concurrent_vector<unsigned int> > m_clusters; //!< Cluster components
-        #else
         std::vector<std::vector<unsigned int> > m_clusters; //!< Cluster components
-        #endif
 
         detail::Graph m_G; //!< The graph
 
@@ -426,8 +398,8 @@ UpdaterClusters<Shape>::UpdaterClusters(std::shared_ptr<SystemDefinition> sysdef
     {
     m_exec_conf->msg->notice(5) << "Constructing UpdaterClusters" << std::endl;
 
-    #ifdef ENABLE_TBB_TASK
-    m_G.setTaskArena(sysdef->getParticleData()->getExecConf()->getTaskArena());
+    #ifdef ENABLE_TBB
+    m_G.setExecConf(m_exec_conf);
     #endif
 
     // initialize stats
@@ -104,6 +104,28 @@ moves per particle when using the parallel code paths. Monitor the number of
 trial moves performed with `HPMCIntegrator.translate_moves` and
 `HPMCIntegrator.rotate_moves`.
 
+When `HPMCIntegrator.checkerboard` is `True`, the CPU implementation divides
+the local box into cells at least as wide as the largest interaction range and
+groups the cells into :math:`2^d` sets in a checkerboard pattern, where
+:math:`d` is the dimensionality. Cells in the same set do not interact, so
+threads perform trial moves for the particles in different cells of the set
+concurrently. `HPMCIntegrator` rejects trial moves that leave the cell and
+chooses the grid offset and the order of the sets randomly in each sweep
+to maintain detailed balance. Use `hoomd.device.CPU.num_cpu_threads` to set the
+number of threads. The checkerboard sweep falls back on the serial loop when
+the box is smaller than two cells in any direction or when the integrator has
+depletants, an external potential, or a `pair_potential
+<HPMCIntegrator.pair_potential>`.
+
+The CPU implementation finds the neighbors of each particle with a bounding
+volume hierarchy, which it builds before every timestep by default. When
+`HPMCIntegrator.aabb_refit_threshold` is positive, it instead updates the
+bounding volumes of the existing hierarchy to the new particle positions, which
+takes less time. The quality of the hierarchy degrades as particles diffuse, so
+`HPMCIntegrator` rebuilds it when the estimated cost of a search exceeds
+``aabb_refit_threshold`` times the cost right after the last build. Values
+between 1.1 and 2 work well for dense systems.
+
 .. rubric:: Random numbers
 
 `HPMCIntegrator` uses a pseudorandom number stream to generate the trial moves.
@@ -363,11 +385,22 @@ class HPMCIntegrator(Integrator):
         nselect (int): Number of trial moves to perform per particle per
             timestep.
 
+        checkerboard (bool): When `True`, perform trial moves for particles
+            in non-interacting cells concurrently on multiple CPU threads
+            (see **Timesteps** above). Has no effect on the GPU. Defaults to
+            `False`.
+
+        aabb_refit_threshold (float): Relative search cost at which to
+            rebuild the refit bounding volume hierarchy (see **Timesteps**
+            above). Set to 0 to rebuild the hierarchy on every timestep. Has no
+            effect on the GPU. Defaults to 0.
+
     .. rubric:: Attributes
     """
     _ext_module = _hpmc
     _remove_for_pickling = Integrator._remove_for_pickling + ('_cpp_cell',)
     _skip_for_equality = Integrator._skip_for_equality | {'_cpp_cell'}
+    _checkpoint_attributes = ('d', 'a')
     _cpp_cls = None
 
     def __init__(self, default_d, default_a, translation_move_probability,
@@ -377,7 +410,9 @@ class HPMCIntegrator(Integrator):
         # Set base parameter dict for hpmc integrators
         param_dict = ParameterDict(
             translation_move_probability=float(translation_move_probability),
-            nselect=int(nselect))
+            nselect=int(nselect),
+            checkerboard=False,
+            aabb_refit_threshold=float(0.0))
         self._param_dict.update(param_dict)
         self._pair_potential = None
         self._external_potential = None
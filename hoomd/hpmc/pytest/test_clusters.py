@@ -7,6 +7,7 @@ import hoomd
 from hoomd.conftest import (operation_pickling_check, logging_check,
                             autotuned_kernel_parameter_check)
 from hoomd.logging import LoggerCategories
+import numpy
 import pytest
 import hoomd.hpmc.pytest.conftest
 
@@ -197,3 +198,36 @@ def test_logging():
             'default': True
         }
     })
+
+
+@pytest.mark.serial
+@pytest.mark.cpu
+def test_cpu_threads(evaluate_cpu_threads, lattice_snapshot_factory):
+    """Test that threaded cluster moves match the serial moves."""
+
+    def simulate(sim):
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.05, default_a=0.1)
+        mc.shape['A'] = dict(diameter=1.1)
+        sim.operations.integrator = mc
+
+        cl = hoomd.hpmc.update.Clusters(trigger=hoomd.trigger.Periodic(1),
+                                        pivot_move_probability=0.5)
+        sim.operations.updaters.append(cl)
+
+        sim.run(10)
+        return (sim.state.get_snapshot().particles.position,
+                cl.avg_cluster_size)
+
+    snap = lattice_snapshot_factory(particle_types=['A'],
+                                    dimensions=3,
+                                    a=1.2,
+                                    n=6,
+                                    r=0.1)
+    serial, threaded, repeat = evaluate_cpu_threads(snap, simulate)
+
+    # The clusters do not depend on the order in which the threads find them.
+    if snap.communicator.rank == 0:
+        assert serial[1] > 0
+        for result in (threaded, repeat):
+            numpy.testing.assert_array_equal(result[0], serial[0])
+            assert result[1] == serial[1]
@@ -118,3 +118,26 @@ def test_2d_free_volume(simulation_factory):
     f = free_volume.free_volume
     if snapshot.communicator.rank == 0:
         assert f == pytest.approx(expected=100 * 100 - math.pi, rel=1e-3)
+
+
+@pytest.mark.cpu
+def test_cpu_threads(evaluate_cpu_threads, lattice_snapshot_factory):
+    """Test that the threaded free volume is identical to the serial one."""
+
+    def simulate(sim):
+        mc = hoomd.hpmc.integrate.Sphere()
+        mc.shape['A'] = dict(diameter=1)
+        sim.operations.integrator = mc
+
+        free_volume = hoomd.hpmc.compute.FreeVolume(test_particle_type='A',
+                                                    num_samples=10000)
+        sim.operations.computes.append(free_volume)
+
+        sim.run(0)
+        return free_volume.free_volume
+
+    serial, threaded, repeat = evaluate_cpu_threads(
+        lattice_snapshot_factory(n=6, a=1.5), simulate)
+
+    assert threaded == serial
+    assert repeat == threaded
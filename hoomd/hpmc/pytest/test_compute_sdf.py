@@ -377,6 +377,37 @@ def test_sdf_expansion(simulation_factory, two_particle_snapshot_factory):
     assert sdf_expansion[-1] != 0
 
 
+@pytest.mark.cpu
+@pytest.mark.parametrize("integrator, shape", [
+    (hoomd.hpmc.integrate.Sphere, dict(diameter=1)),
+    (hoomd.hpmc.integrate.SimplePolygon,
+     dict(vertices=[(-0.5, -0.5), (0.5, -0.5), (0.5, 0.5), (-0.5, 0.5)])),
+])
+def test_cpu_threads(evaluate_cpu_threads, lattice_snapshot_factory,
+                     integrator, shape):
+    """Test that the threaded SDF is identical to the serial SDF."""
+
+    def simulate(sim):
+        mc = integrator()
+        mc.shape['A'] = shape
+        sim.operations.integrator = mc
+
+        sdf = hoomd.hpmc.compute.SDF(xmax=0.1, dx=1e-3)
+        sim.operations.computes.append(sdf)
+
+        sim.run(0)
+        return sdf.sdf_compression, sdf.sdf_expansion
+
+    snapshot = lattice_snapshot_factory(dimensions=2, n=16, a=1.05, r=0.01)
+    serial, threaded, repeat = evaluate_cpu_threads(snapshot, simulate)
+
+    if snapshot.communicator.rank == 0:
+        assert numpy.count_nonzero(serial[0]) > 0
+        for result in (threaded, repeat):
+            numpy.testing.assert_array_equal(result[0], serial[0])
+            numpy.testing.assert_array_equal(result[1], serial[1])
+
+
 def test_logging():
     logging_check(
         hoomd.hpmc.compute.SDF, ('hpmc', 'compute'), {
@@ -130,6 +130,78 @@ def test_moves(simulation_factory, lattice_snapshot_factory, test_moves_args):
         assert accepted_rejected_rot > 0
 
 
+def _run_checkerboard(sim, integrator, args):
+    mc = integrator()
+    mc.shape['A'] = args
+    mc.checkerboard = True
+    assert mc.checkerboard
+
+    sim.operations.add(mc)
+    sim.run(10)
+
+    assert mc.checkerboard
+    assert mc._cpp_obj.getNumCheckerboardSweeps() == 10 * mc.nselect
+    assert mc.overlaps == 0
+    accepted_rejected_trans = sum(mc.translate_moves)
+    assert accepted_rejected_trans > 0
+    if 'sphere' not in str(integrator).lower():
+        accepted_rejected_rot = sum(mc.rotate_moves)
+        assert accepted_rejected_rot > 0
+
+    snapshot = sim.state.get_snapshot()
+    return snapshot.particles.position, snapshot.particles.orientation
+
+
+@pytest.mark.cpu
+def test_checkerboard(simulation_factory, lattice_snapshot_factory,
+                      test_moves_args):
+    integrator = test_moves_args[0]
+    args = test_moves_args[1]
+    n_dimensions = test_moves_args[2]
+    sim = simulation_factory(
+        lattice_snapshot_factory(dimensions=n_dimensions, n=8, a=2.5))
+    _run_checkerboard(sim, integrator, args)
+
+
+@pytest.mark.cpu
+def test_checkerboard_cpu_threads(evaluate_cpu_threads,
+                                  lattice_snapshot_factory, test_moves_args):
+    integrator = test_moves_args[0]
+    args = test_moves_args[1]
+    n_dimensions = test_moves_args[2]
+    snap = lattice_snapshot_factory(dimensions=n_dimensions, n=8, a=2.5)
+
+    # The trajectory does not depend on the number of threads.
+    results = evaluate_cpu_threads(
+        snap, lambda sim: _run_checkerboard(sim, integrator, args))
+    if snap.communicator.rank == 0:
+        for position, orientation in results[1:]:
+            np.testing.assert_array_equal(position, results[0][0])
+            np.testing.assert_array_equal(orientation, results[0][1])
+
+
+@pytest.mark.cpu
+def test_aabb_refit(simulation_factory, lattice_snapshot_factory,
+                    test_moves_args):
+    integrator = test_moves_args[0]
+    args = test_moves_args[1]
+    n_dimensions = test_moves_args[2]
+    mc = integrator()
+    mc.shape['A'] = args
+    mc.aabb_refit_threshold = 1.5
+    assert mc.aabb_refit_threshold == 1.5
+
+    sim = simulation_factory(
+        lattice_snapshot_factory(dimensions=n_dimensions, n=8, a=2.5))
+    sim.operations.add(mc)
+    sim.run(10)
+
+    assert mc.aabb_refit_threshold == 1.5
+    assert mc.overlaps == 0
+    accepted_rejected_trans = sum(sim.operations.integrator.translate_moves)
+    assert accepted_rejected_trans > 0
+
+
 def test_kernel_parameters(simulation_factory, lattice_snapshot_factory,
                            test_moves_args):
     integrator = test_moves_args[0]
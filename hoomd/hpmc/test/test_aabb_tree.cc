@@ -6,6 +6,7 @@
 HOOMD_UP_MAIN();
 
 #include "hoomd/AABBTree.h"
+#include "hoomd/WideAABBTree.h"
 
 #include <algorithm>
 #include <iostream>
@@ -105,3 +106,133 @@ UP_TEST(bigger)
         UP_ASSERT(in(i, hits));
         }
     }
+
+UP_TEST(refit)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(4, 5, 6));
+
+    std::vector<vec3<Scalar>> points(N);
+    std::vector<AABB> aabbs(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(100);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+
+    AABBTree tree;
+    tree.buildTree(aabbs.data(), N);
+    UP_ASSERT_EQUAL(tree.getNumParticles(), N);
+    Scalar build_cost = tree.getCost();
+    UP_ASSERT(build_cost > Scalar(0.0));
+
+    // refitting to the same boxes does not change the tree
+    for (unsigned int i = 0; i < N; i++)
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+    tree.refit(aabbs.data(), N);
+    MY_CHECK_CLOSE(tree.getCost(), build_cost, tol);
+
+    // move all the points and ensure that they are still found after a refit
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] += vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng))
+                     * Scalar(10);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+    tree.refit(aabbs.data(), N);
+
+    std::vector<unsigned int> hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        tree.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+        }
+
+    // the topology no longer matches the positions, so the refit tree is worse than a new one
+    Scalar refit_cost = tree.getCost();
+    tree.buildTree(aabbs.data(), N);
+    UP_ASSERT(refit_cost > tree.getCost());
+    }
+
+UP_TEST(polydisperse)
+    {
+    // the SAH builder must find every overlapping box when the sizes span several orders of
+    // magnitude
+    const unsigned int N = 2000;
+    hoomd::RandomGenerator rng(hoomd::Seed(1, 2, 3), hoomd::Counter(4, 5, 6));
+
+    std::vector<AABB> reference(N);
+    std::vector<AABB> aabbs(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        vec3<Scalar> p(hoomd::detail::generate_canonical<float>(rng),
+                       hoomd::detail::generate_canonical<float>(rng),
+                       hoomd::detail::generate_canonical<float>(rng));
+        Scalar r = (i % 100 == 0) ? Scalar(5.0) : Scalar(0.1);
+        reference[i] = aabbs[i] = AABB(p * Scalar(100), r);
+        }
+
+    AABBTree tree;
+    tree.buildTree(aabbs.data(), N);
+    WideAABBTree wide_tree;
+    aabbs = reference;
+    wide_tree.buildTree(aabbs.data(), N);
+
+    std::vector<unsigned int> hits, wide_hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        wide_hits.clear();
+        tree.query(hits, reference[i]);
+        wide_tree.query(wide_hits, reference[i]);
+
+        std::sort(hits.begin(), hits.end());
+        std::sort(wide_hits.begin(), wide_hits.end());
+
+        std::vector<unsigned int> expected;
+        for (unsigned int j = 0; j < N; j++)
+            {
+            if (reference[i].overlaps(reference[j]))
+                expected.push_back(j);
+            }
+
+        // leaves may report extra candidates, but never miss an overlap
+        for (unsigned int j : expected)
+            {
+            UP_ASSERT(std::binary_search(hits.begin(), hits.end(), j));
+            UP_ASSERT(std::binary_search(wide_hits.begin(), wide_hits.end(), j));
+            }
+        }
+    }
+
+UP_TEST(wide_basic)
+    {
+    // a single leaf and an empty tree
+    AABB aabbs[3];
+    aabbs[0] = AABB(vec3<Scalar>(1, 1, -1), vec3<Scalar>(3, 3, 1));
+    aabbs[1] = AABB(vec3<Scalar>(0, 1, -1), vec3<Scalar>(1, 5, 1));
+    aabbs[2] = AABB(vec3<Scalar>(0, 0, -1), vec3<Scalar>(1, 1, 1));
+
+    WideAABBTree tree;
+    tree.buildTree(aabbs, 3);
+    UP_ASSERT_EQUAL(tree.getNumNodes(), 1);
+
+    std::vector<unsigned int> hits;
+    tree.query(hits, AABB(vec3<Scalar>(0.9, 0.9, 0), vec3<Scalar>(1.1, 1.1, 0.1)));
+    UP_ASSERT_EQUAL(hits.size(), 3);
+
+    hits.clear();
+    tree.query(hits, AABB(vec3<Scalar>(10, 10, 10), vec3<Scalar>(11, 11, 11)));
+    UP_ASSERT_EQUAL(hits.size(), 0);
+
+    tree.buildTree(aabbs, 0);
+    UP_ASSERT_EQUAL(tree.getNumNodes(), 0);
+    tree.query(hits, aabbs[0]);
+    UP_ASSERT_EQUAL(hits.size(), 0);
+    }
@@ -4,6 +4,7 @@
 #include "BondTablePotential.h"
 #include "hoomd/BondedGroupData.h"
 
+#include <sstream>
 #include <stdexcept>
 
 /*! \file BondTablePotential.cc
@@ -21,7 +22,7 @@ namespace md
 */
 BondTablePotential::BondTablePotential(std::shared_ptr<SystemDefinition> sysdef,
                                        unsigned int table_width)
-    : ForceCompute(sysdef), m_table_width(table_width)
+    : BondedForceCompute(sysdef), m_table_width(table_width)
     {
     m_exec_conf->msg->notice(5) << "Constructing BondTablePotential" << endl;
 
@@ -180,113 +181,149 @@ void BondTablePotential::computeForces(uint64_t timestep)
     ArrayHandle<Scalar2> h_tables(m_tables, access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_params(m_params, access_location::host, access_mode::read);
 
+    ArrayHandle<BondData::members_t> h_bonds(m_bond_data->getMembersArray(),
+                                             access_location::host,
+                                             access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_bond_data->getTypeValArray(),
+                                     access_location::host,
+                                     access_mode::read);
+
     // for each of the bonds
     const unsigned int size = (unsigned int)m_bond_data->getN();
-    for (unsigned int i = 0; i < size; i++)
-        {
-        // lookup the tag of each of the particles participating in the bond
-        const BondData::members_t bond = m_bond_data->getMembersByIndex(i);
-        assert(bond.tag[0] < m_pdata->getN());
-        assert(bond.tag[1] < m_pdata->getN());
-
-        // transform a and b into indices into the particle data arrays
-        // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[bond.tag[0]];
-        unsigned int idx_b = h_rtag.data[bond.tag[1]];
-        assert(idx_a <= m_pdata->getMaximumTag());
-        assert(idx_b <= m_pdata->getMaximumTag());
-
-        // throw an error if this bond is incomplete
-        if (idx_a == NOT_LOCAL || idx_b == NOT_LOCAL)
-            {
-            std::ostringstream s;
-            s << "bond.table: bond " << bond.tag[0] << " " << bond.tag[1] << " incomplete.";
-            throw std::runtime_error(s.str());
-            }
-        assert(idx_a <= m_pdata->getN() + m_pdata->getNGhosts());
-        assert(idx_b <= m_pdata->getN() + m_pdata->getNGhosts());
-
-        Scalar3 pa = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
-        Scalar3 pb = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
-        Scalar3 dx = pb - pa;
-
-        // apply periodic boundary conditions
-        dx = box.minImage(dx);
-
-        // access needed parameters
-        unsigned int type = m_bond_data->getTypeByIndex(i);
-        Scalar4 params = h_params.data[type];
-        Scalar rmin = params.x;
-        Scalar rmax = params.y;
-        Scalar delta_r = params.z;
-
-        // start computing the force
-        Scalar rsq = dot(dx, dx);
-        Scalar r = sqrt(rsq);
-
-        // only compute the force if the particles are within the region defined by V
-
-        if (r < rmax && r >= rmin)
-            {
-            // precomputed term
-            Scalar value_f = (r - rmin) / delta_r;
-
-            // compute index into the table and read in values
-
-            /// Here we use the table!!
-            unsigned int value_i = (unsigned int)floor(value_f);
-            Scalar2 VF0 = h_tables.data[m_table_value(value_i, type)];
-            Scalar2 VF1 = h_tables.data[m_table_value(value_i + 1, type)];
-            // unpack the data
-            Scalar V0 = VF0.x;
-            Scalar V1 = VF1.x;
-            Scalar F0 = VF0.y;
-            Scalar F1 = VF1.y;
-
-            // compute the linear interpolation coefficient
-            Scalar f = value_f - Scalar(value_i);
-
-            // interpolate to get V and F;
-            Scalar V = V0 + f * (V1 - V0);
-            Scalar F = F0 + f * (F1 - F0);
-
-            // convert to standard variables used by the other pair computes in HOOMD-blue
-            Scalar force_divr = Scalar(0.0);
-            if (r > Scalar(0.0))
-                force_divr = F / r;
-            Scalar bond_eng = Scalar(0.5) * V;
-
-            // compute the virial
-            Scalar bond_virial[6];
-            Scalar force_div2r = Scalar(0.5) * force_divr;
-            bond_virial[0] = dx.x * dx.x * force_div2r; // xx
-            bond_virial[1] = dx.x * dx.y * force_div2r; // xy
-            bond_virial[2] = dx.x * dx.z * force_div2r; // xz
-            bond_virial[3] = dx.y * dx.y * force_div2r; // yy
-            bond_virial[4] = dx.y * dx.z * force_div2r; // yz
-            bond_virial[5] = dx.z * dx.z * force_div2r; // zz
-
-            // add the force to the particles
-            // (MEM TRANSFER: 20 Scalars / FLOPS 16)
-            h_force.data[idx_b].x += force_divr * dx.x;
-            h_force.data[idx_b].y += force_divr * dx.y;
-            h_force.data[idx_b].z += force_divr * dx.z;
-            h_force.data[idx_b].w += bond_eng;
-            for (unsigned int i = 0; i < 6; i++)
-                h_virial.data[i * m_virial_pitch + idx_b] += bond_virial[i];
-
-            h_force.data[idx_a].x -= force_divr * dx.x;
-            h_force.data[idx_a].y -= force_divr * dx.y;
-            h_force.data[idx_a].z -= force_divr * dx.z;
-            h_force.data[idx_a].w += bond_eng;
-            for (unsigned int i = 0; i < 6; i++)
-                h_virial.data[i * m_virial_pitch + idx_a] += bond_virial[i];
-            }
-        else
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch,
+                             unsigned int offset)
+    {
+        for (unsigned int i = first; i < last; i++)
             {
-            throw std::runtime_error("Table bond out of bounds.");
+            // lookup the tag of each of the particles participating in the bond
+            const BondData::members_t bond = h_bonds.data[i];
+            assert(bond.tag[0] < m_pdata->getN());
+            assert(bond.tag[1] < m_pdata->getN());
+
+            // transform a and b into indices into the particle data arrays
+            // (MEM TRANSFER: 4 integers)
+            unsigned int idx_a = h_rtag.data[bond.tag[0]];
+            unsigned int idx_b = h_rtag.data[bond.tag[1]];
+            assert(idx_a <= m_pdata->getMaximumTag());
+            assert(idx_b <= m_pdata->getMaximumTag());
+
+            // throw an error if this bond is incomplete
+            if (idx_a == NOT_LOCAL || idx_b == NOT_LOCAL)
+                {
+                std::ostringstream s;
+                s << "bond.table: bond " << bond.tag[0] << " " << bond.tag[1] << " incomplete.";
+                throw std::runtime_error(s.str());
+                }
+            assert(idx_a <= m_pdata->getN() + m_pdata->getNGhosts());
+            assert(idx_b <= m_pdata->getN() + m_pdata->getNGhosts());
+
+            Scalar3 pa
+                = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
+            Scalar3 pb
+                = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
+            Scalar3 dx = pb - pa;
+
+            // apply periodic boundary conditions
+            dx = box.minImage(dx);
+
+            // access needed parameters
+            unsigned int type = h_typeval.data[i].type;
+            Scalar4 params = h_params.data[type];
+            Scalar rmin = params.x;
+            Scalar rmax = params.y;
+            Scalar delta_r = params.z;
+
+            // start computing the force
+            Scalar rsq = dot(dx, dx);
+            Scalar r = sqrt(rsq);
+
+            // only compute the force if the particles are within the region defined by V
+
+            if (r < rmax && r >= rmin)
+                {
+                // precomputed term
+                Scalar value_f = (r - rmin) / delta_r;
+
+                // compute index into the table and read in values
+
+                /// Here we use the table!!
+                unsigned int value_i = (unsigned int)floor(value_f);
+                Scalar2 VF0 = h_tables.data[m_table_value(value_i, type)];
+                Scalar2 VF1 = h_tables.data[m_table_value(value_i + 1, type)];
+                // unpack the data
+                Scalar V0 = VF0.x;
+                Scalar V1 = VF1.x;
+                Scalar F0 = VF0.y;
+                Scalar F1 = VF1.y;
+
+                // compute the linear interpolation coefficient
+                Scalar f = value_f - Scalar(value_i);
+
+                // interpolate to get V and F;
+                Scalar V = V0 + f * (V1 - V0);
+                Scalar F = F0 + f * (F1 - F0);
+
+                // convert to standard variables used by the other pair computes in HOOMD-blue
+                Scalar force_divr = Scalar(0.0);
+                if (r > Scalar(0.0))
+                    force_divr = F / r;
+                Scalar bond_eng = Scalar(0.5) * V;
+
+                // compute the virial
+                Scalar bond_virial[6];
+                Scalar force_div2r = Scalar(0.5) * force_divr;
+                bond_virial[0] = dx.x * dx.x * force_div2r; // xx
+                bond_virial[1] = dx.x * dx.y * force_div2r; // xy
+                bond_virial[2] = dx.x * dx.z * force_div2r; // xz
+                bond_virial[3] = dx.y * dx.y * force_div2r; // yy
+                bond_virial[4] = dx.y * dx.z * force_div2r; // yz
+                bond_virial[5] = dx.z * dx.z * force_div2r; // zz
+
+                // add the force to the particles
+                // (MEM TRANSFER: 20 Scalars / FLOPS 16)
+                if (idx_b < m_pdata->getN())
+                    {
+                    force[idx_b - offset].x += force_divr * dx.x;
+                    force[idx_b - offset].y += force_divr * dx.y;
+                    force[idx_b - offset].z += force_divr * dx.z;
+                    force[idx_b - offset].w += bond_eng;
+                    if (virial)
+                        {
+                        for (unsigned int i = 0; i < 6; i++)
+                            virial[i * virial_pitch + idx_b - offset] += bond_virial[i];
+                        }
+                    }
+
+                if (idx_a < m_pdata->getN())
+                    {
+                    force[idx_a - offset].x -= force_divr * dx.x;
+                    force[idx_a - offset].y -= force_divr * dx.y;
+                    force[idx_a - offset].z -= force_divr * dx.z;
+                    force[idx_a - offset].w += bond_eng;
+                    if (virial)
+                        {
+                        for (unsigned int i = 0; i < 6; i++)
+                            virial[i * virial_pitch + idx_a - offset] += bond_virial[i];
+                        }
+                    }
+                }
+            else
+                {
+                throw std::runtime_error("Table bond out of bounds.");
+                }
             }
-        }
+    };
+
+    computeBondedForces(size,
+                        h_bonds.data,
+                        h_rtag.data,
+                        h_force.data,
+                        h_virial.data,
+                        compute_range);
     }
 
 namespace detail
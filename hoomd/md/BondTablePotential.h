@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "BondedForceCompute.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GPUArray.h"
 #include "hoomd/Index1D.h"
@@ -52,7 +53,7 @@ namespace md
    and ri+1 can be calculated via f = (r - rmin) / dr - float(i). And the linear interpolation can
    then be performed via V(r) ~= Vi + f * (Vi+1 - Vi) \ingroup computes
 */
-class PYBIND11_EXPORT BondTablePotential : public ForceCompute
+class PYBIND11_EXPORT BondTablePotential : public BondedForceCompute
     {
     public:
     //! Constructs the compute
@@ -0,0 +1,100 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/BondedGroupData.h"
+#include "hoomd/ForceCompute.h"
+#include "hoomd/ThreadedAccumulation.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+/*! \file BondedForceCompute.h
+    \brief Declares the BondedForceCompute class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Base class for forces that loop over bonded groups on the CPU.
+/** BondedForceCompute splits the loop over the groups between the CPU threads with
+    hoomd::detail::ThreadedForceAccumulator. The buffer of each thread covers the range of local
+    particle indices that the members of its groups span. Subclasses call computeBondedForces()
+    from computeForces().
+*/
+class PYBIND11_EXPORT BondedForceCompute : public ForceCompute
+    {
+    public:
+    /// Construct the force compute.
+    BondedForceCompute(std::shared_ptr<SystemDefinition> sysdef) : ForceCompute(sysdef) { }
+
+    protected:
+    /// Evaluate the bonded groups on the CPU threads.
+    /*! \param n_groups Number of groups
+        \param members Members of the groups
+        \param rtag Reverse lookup table from particle tags to indices
+        \param force Output forces of the local particles, zeroed by the caller
+        \param virial Output virial of the local particles, zeroed by the caller
+        \param compute_range Callable (first, last, force, virial, virial_pitch, offset) that adds
+               the forces and virials of groups [first, last) on local particle i to
+               force[i - offset] and virial[k * virial_pitch + i - offset]
+
+        \a compute_range may only write to the local members of its groups. It receives a null
+        \a virial when the pressure tensor is not requested.
+    */
+    template<unsigned int group_size, class Func>
+    void computeBondedForces(unsigned int n_groups,
+                             const group_storage<group_size>* members,
+                             const unsigned int* rtag,
+                             Scalar4* force,
+                             Scalar* virial,
+                             const Func& compute_range)
+        {
+        const unsigned int N = m_pdata->getN();
+        auto window = [&](unsigned int first, unsigned int last)
+        {
+            unsigned int lo = N;
+            unsigned int hi = 0;
+            for (unsigned int i = first; i < last; i++)
+                {
+                for (unsigned int k = 0; k < group_size; k++)
+                    {
+                    // skip ghost and missing members, compute_range does not write to them
+                    unsigned int idx = rtag[members[i].tag[k]];
+                    if (idx < N)
+                        {
+                        lo = std::min(lo, idx);
+                        hi = std::max(hi, idx + 1);
+                        }
+                    }
+                }
+            return std::make_pair(lo, hi);
+        };
+
+        const bool compute_virial = m_pdata->getFlags()[pdata_flag::pressure_tensor];
+        m_bonded_accumulator.compute(*m_exec_conf,
+                                     n_groups,
+                                     N,
+                                     force,
+                                     compute_virial ? virial : nullptr,
+                                     m_virial_pitch,
+                                     window,
+                                     compute_range);
+        }
+
+    private:
+    /// Per-thread force buffers
+    hoomd::detail::ThreadedForceAccumulator m_bonded_accumulator;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -51,6 +51,58 @@ ComputeThermo::ComputeThermo(std::shared_ptr<SystemDefinition> sysdef,
 #ifdef ENABLE_MPI
     m_properties_reduced = true;
 #endif
+
+    registerLoggables();
+    }
+
+/*! The names match the loggable properties of hoomd.md.compute.ThermodynamicQuantities.
+ */
+void ComputeThermo::registerLoggables()
+    {
+    // quantities that depend on the particle data are computed on demand
+    auto computed = [this](Scalar (ComputeThermo::*getter)())
+    {
+        return [this, getter](uint64_t timestep)
+        {
+            compute(timestep);
+            return double((this->*getter)());
+        };
+    };
+
+    registerLoggable("kinetic_temperature", computed(&ComputeThermo::getTemperature));
+    registerLoggable("pressure", computed(&ComputeThermo::getPressure));
+    registerLoggable("kinetic_energy", computed(&ComputeThermo::getKineticEnergy));
+    registerLoggable("translational_kinetic_energy",
+                     computed(&ComputeThermo::getTranslationalKineticEnergy));
+    registerLoggable("rotational_kinetic_energy",
+                     computed(&ComputeThermo::getRotationalKineticEnergy));
+    registerLoggable("potential_energy", computed(&ComputeThermo::getPotentialEnergy));
+
+    LoggableQuantity pressure_tensor;
+    pressure_tensor.width = 6;
+    pressure_tensor.get_float = [this](uint64_t timestep, double* out)
+    {
+        compute(timestep);
+        PressureTensor p = getPressureTensor();
+        out[0] = p.xx;
+        out[1] = p.xy;
+        out[2] = p.xz;
+        out[3] = p.yy;
+        out[4] = p.yz;
+        out[5] = p.zz;
+    };
+    registerLoggable("pressure_tensor", pressure_tensor);
+
+    registerLoggable("degrees_of_freedom", [this](uint64_t) { return getNDOF(); });
+    registerLoggable("translational_degrees_of_freedom",
+                     [this](uint64_t) { return getTranslationalDOF(); });
+    registerLoggable("rotational_degrees_of_freedom",
+                     [this](uint64_t) { return getRotationalDOF(); });
+    registerLoggable("volume", [this](uint64_t) { return double(getVolume()); });
+
+    LoggableQuantity num_particles;
+    num_particles.get_int = [this](uint64_t, int64_t* out) { out[0] = getNumParticles(); };
+    registerLoggable("num_particles", num_particles);
     }
 
 ComputeThermo::~ComputeThermo()
@@ -339,6 +339,9 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
     //! Does the actual computation
     virtual void computeProperties();
 
+    /// Register the quantities that LogBuffer can sample
+    void registerLoggables();
+
 #ifdef ENABLE_MPI
     bool m_properties_reduced; //!< True if properties have been reduced across MPI
 
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "BondedForceCompute.h"
 #include "hoomd/BondedGroupData.h"
 #include "hoomd/ForceCompute.h"
 
@@ -58,7 +59,7 @@ struct cosinesq_params
     The angles which forces are computed on are accessed from ParticleData::getAngleData
     \ingroup computes
 */
-class PYBIND11_EXPORT CosineSqAngleForceCompute : public ForceCompute
+class PYBIND11_EXPORT CosineSqAngleForceCompute : public BondedForceCompute
     {
     public:
     //! Constructs the compute
@@ -5,6 +5,7 @@
 #define __PAIR_EVALUATOR_ExpandedLJ_H__
 
 #ifndef __HIPCC__
+#include "PairBatch.h"
 #include <string>
 #endif
 
@@ -195,6 +196,56 @@ class EvaluatorPairExpandedLJ
         {
         throw std::runtime_error("Shape definition not supported for this pair potential.");
         }
+
+    //! Evaluate the force and energy for a batch of pairs
+    /*! \param batch Pairs to evaluate (see detail::PairBatch)
+        \param params Per type pair parameters indexed by batch.typpair
+    */
+    static void evalForceAndEnergyBatch(detail::PairBatch& batch, const param_type* params)
+        {
+        Scalar lj1[detail::pair_batch_size];
+        Scalar lj2[detail::pair_batch_size];
+        Scalar delta[detail::pair_batch_size];
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            const param_type& param = params[batch.typpair[b]];
+            lj1[b] = param.epsilon_x_4 * param.sigma_6 * param.sigma_6;
+            lj2[b] = param.epsilon_x_4 * param.sigma_6;
+            delta[b] = param.delta;
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            Scalar mask = batch.rsq[b] < batch.rcutsq[b] ? Scalar(1.0) : Scalar(0.0);
+            mask = lj1[b] != Scalar(0.0) ? mask : Scalar(0.0);
+            Scalar rsq = detail::pair_batch_safe(batch.rsq[b], mask);
+            Scalar rcutsq = detail::pair_batch_safe(batch.rcutsq[b], mask);
+
+            Scalar rinv = fast::rsqrt(rsq);
+            Scalar r = Scalar(1.0) / rinv;
+            Scalar rmd = detail::pair_batch_safe(r - delta[b], mask);
+            Scalar rmdinv = Scalar(1.0) / rmd;
+            Scalar rmd2inv = rmdinv * rmdinv;
+            Scalar rmd6inv = rmd2inv * rmd2inv * rmd2inv;
+            Scalar force_divr = rinv * rmdinv * rmd6inv
+                                * (Scalar(12.0) * lj1[b] * rmd6inv - Scalar(6.0) * lj2[b]);
+            Scalar pair_eng = rmd6inv * (lj1[b] * rmd6inv - lj2[b]);
+
+            // the shifted cutoff is only guaranteed to be positive when the shift is requested
+            Scalar r_cut = fast::sqrt(rcutsq);
+            Scalar r_cut_shifted
+                = detail::pair_batch_safe(r_cut - delta[b], mask * batch.energy_shift[b]);
+            Scalar r_cut_shifted_inv = Scalar(1.0) / r_cut_shifted;
+            Scalar r_cut2_inv = r_cut_shifted_inv * r_cut_shifted_inv;
+            Scalar r_cut6_inv = r_cut2_inv * r_cut2_inv * r_cut2_inv;
+            pair_eng -= batch.energy_shift[b] * r_cut6_inv * (lj1[b] * r_cut6_inv - lj2[b]);
+
+            batch.force_divr[b] = mask * force_divr;
+            batch.pair_eng[b] = mask * pair_eng;
+            batch.evaluated[b] = mask;
+            }
+        }
 #endif
 
     protected:
@@ -5,6 +5,7 @@
 #define __PAIR_EVALUATOR_GAUSS_H__
 
 #ifndef __HIPCC__
+#include "PairBatch.h"
 #include <string>
 #endif
 
@@ -167,6 +168,53 @@ class EvaluatorPairGauss
         {
         throw std::runtime_error("Shape definition not supported for this pair potential.");
         }
+
+    //! Evaluate the force and energy for a batch of pairs
+    /*! \param batch Pairs to evaluate (see detail::PairBatch)
+        \param params Per type pair parameters indexed by batch.typpair
+
+        The exponentials are evaluated in a separate scalar loop: the standard library provides
+        no vector exp without -ffast-math.
+    */
+    static void evalForceAndEnergyBatch(detail::PairBatch& batch, const param_type* params)
+        {
+        Scalar epsilon[detail::pair_batch_size];
+        Scalar sigma_sq[detail::pair_batch_size];
+        Scalar exp_val[detail::pair_batch_size];
+        Scalar exp_cut[detail::pair_batch_size];
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            const param_type& param = params[batch.typpair[b]];
+            epsilon[b] = param.epsilon;
+            sigma_sq[b] = param.sigma * param.sigma;
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            batch.evaluated[b] = batch.rsq[b] < batch.rcutsq[b] ? Scalar(1.0) : Scalar(0.0);
+            sigma_sq[b] = detail::pair_batch_safe(sigma_sq[b], batch.evaluated[b]);
+            }
+
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            Scalar r_over_sigma_sq = batch.rsq[b] / sigma_sq[b];
+            exp_val[b] = fast::exp(-Scalar(1.0) / Scalar(2.0) * r_over_sigma_sq);
+            exp_cut[b] = fast::exp(-Scalar(1.0) / Scalar(2.0) * batch.rcutsq[b] / sigma_sq[b]);
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            Scalar mask = batch.evaluated[b];
+            Scalar force_divr = epsilon[b] / sigma_sq[b] * exp_val[b];
+            Scalar pair_eng = epsilon[b] * exp_val[b];
+            pair_eng -= batch.energy_shift[b] * epsilon[b] * exp_cut[b];
+
+            batch.force_divr[b] = mask * force_divr;
+            batch.pair_eng[b] = mask * pair_eng;
+            }
+        }
 #endif
 
     protected:
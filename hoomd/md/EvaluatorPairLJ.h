@@ -5,6 +5,7 @@
 #define __PAIR_EVALUATOR_LJ_H__
 
 #ifndef __HIPCC__
+#include "PairBatch.h"
 #include <string>
 #endif
 
@@ -260,6 +261,48 @@ class EvaluatorPairLJ
         {
         throw std::runtime_error("Shape definition not supported for this pair potential.");
         }
+
+    //! Evaluate the force and energy for a batch of pairs
+    /*! \param batch Pairs to evaluate (see detail::PairBatch)
+        \param params Per type pair parameters indexed by batch.typpair
+
+        Computes the same quantities as evalForceAndEnergy for all lanes of the batch in a loop
+        that the compiler vectorizes.
+    */
+    static void evalForceAndEnergyBatch(detail::PairBatch& batch, const param_type* params)
+        {
+        Scalar lj1[detail::pair_batch_size];
+        Scalar lj2[detail::pair_batch_size];
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            const param_type& param = params[batch.typpair[b]];
+            lj1[b] = param.epsilon_x_4 * param.sigma_6 * param.sigma_6;
+            lj2[b] = param.epsilon_x_4 * param.sigma_6;
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            Scalar mask = batch.rsq[b] < batch.rcutsq[b] ? Scalar(1.0) : Scalar(0.0);
+            mask = lj1[b] != Scalar(0.0) ? mask : Scalar(0.0);
+            Scalar rsq = detail::pair_batch_safe(batch.rsq[b], mask);
+            Scalar rcutsq = detail::pair_batch_safe(batch.rcutsq[b], mask);
+
+            Scalar r2inv = Scalar(1.0) / rsq;
+            Scalar r6inv = r2inv * r2inv * r2inv;
+            Scalar force_divr
+                = r2inv * r6inv * (Scalar(12.0) * lj1[b] * r6inv - Scalar(6.0) * lj2[b]);
+            Scalar pair_eng = r6inv * (lj1[b] * r6inv - lj2[b]);
+
+            Scalar rcut2inv = Scalar(1.0) / rcutsq;
+            Scalar rcut6inv = rcut2inv * rcut2inv * rcut2inv;
+            pair_eng -= batch.energy_shift[b] * rcut6inv * (lj1[b] * rcut6inv - lj2[b]);
+
+            batch.force_divr[b] = mask * force_divr;
+            batch.pair_eng[b] = mask * pair_eng;
+            batch.evaluated[b] = mask;
+            }
+        }
 #endif
 
     protected:
@@ -14,6 +14,7 @@
 #endif
 
 #ifndef __HIPCC__
+#include "PairBatch.h"
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #endif
@@ -216,6 +217,79 @@ class EvaluatorPairTable
         {
         throw std::runtime_error("Shape definition not supported for this pair potential.");
         }
+
+    //! Evaluate the force and energy for a batch of pairs
+    /*! \param batch Pairs to evaluate (see detail::PairBatch)
+        \param params Per type pair parameters indexed by batch.typpair
+
+        The table lookups are per-lane gathers from different tables, so they are performed in a
+        scalar loop between the vectorized distance and interpolation loops.
+    */
+    static void evalForceAndEnergyBatch(detail::PairBatch& batch, const param_type* params)
+        {
+        Scalar rmin[detail::pair_batch_size];
+        Scalar width[detail::pair_batch_size];
+        Scalar r[detail::pair_batch_size];
+        Scalar value_f[detail::pair_batch_size];
+        Scalar V0[detail::pair_batch_size];
+        Scalar V1[detail::pair_batch_size];
+        Scalar F0[detail::pair_batch_size];
+        Scalar F1[detail::pair_batch_size];
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            const param_type& param = params[batch.typpair[b]];
+            rmin[b] = param.rmin;
+            width[b] = static_cast<Scalar>(param.V_table.size());
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            r[b] = fast::sqrt(batch.rsq[b]);
+            Scalar mask = batch.rsq[b] < batch.rcutsq[b] ? Scalar(1.0) : Scalar(0.0);
+            mask = r[b] < rmin[b] ? Scalar(0.0) : mask;
+            batch.evaluated[b] = mask;
+
+            const Scalar rcut = fast::sqrt(batch.rcutsq[b]);
+            const Scalar delta_r = detail::pair_batch_safe((rcut - rmin[b]) / width[b], mask);
+            value_f[b] = mask * (r[b] - rmin[b]) / delta_r;
+            }
+
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            V0[b] = Scalar(0.0);
+            V1[b] = Scalar(0.0);
+            F0[b] = Scalar(0.0);
+            F1[b] = Scalar(0.0);
+            if (batch.evaluated[b] != Scalar(0.0))
+                {
+                const param_type& param = params[batch.typpair[b]];
+                unsigned int value_i = static_cast<unsigned int>(slow::floor(value_f[b]));
+                V0[b] = param.V_table[value_i];
+                F0[b] = param.F_table[value_i];
+                if (value_i + 1 < param.V_table.size())
+                    {
+                    V1[b] = param.V_table[value_i + 1];
+                    F1[b] = param.F_table[value_i + 1];
+                    }
+                }
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            const Scalar f = value_f[b] - slow::floor(value_f[b]);
+            const Scalar V = V0[b] + f * (V1[b] - V0[b]);
+            const Scalar F = F0[b] + f * (F1[b] - F0[b]);
+
+            // zero padding lanes and lanes outside [rmin, rcut) so that no table entry leaks into
+            // the results
+            const Scalar nonzero = batch.rsq[b] > Scalar(0.0) ? Scalar(1.0) : Scalar(0.0);
+            const Scalar mask = batch.evaluated[b] * nonzero;
+            batch.force_divr[b] = mask * F / detail::pair_batch_safe(r[b], nonzero);
+            batch.pair_eng[b] = mask * V;
+            }
+        }
 #endif
 
     protected:
@@ -5,6 +5,7 @@
 #define __PAIR_EVALUATOR_YUKAWA_H__
 
 #ifndef __HIPCC__
+#include "PairBatch.h"
 #include <string>
 #endif
 
@@ -174,6 +175,58 @@ class EvaluatorPairYukawa
         {
         throw std::runtime_error("Shape definition not supported for this pair potential.");
         }
+
+    //! Evaluate the force and energy for a batch of pairs
+    /*! \param batch Pairs to evaluate (see detail::PairBatch)
+        \param params Per type pair parameters indexed by batch.typpair
+
+        The exponentials are evaluated in a separate scalar loop: the standard library provides
+        no vector exp without -ffast-math.
+    */
+    static void evalForceAndEnergyBatch(detail::PairBatch& batch, const param_type* params)
+        {
+        Scalar epsilon[detail::pair_batch_size];
+        Scalar kappa[detail::pair_batch_size];
+        Scalar rinv[detail::pair_batch_size];
+        Scalar rcutinv[detail::pair_batch_size];
+        Scalar exp_val[detail::pair_batch_size];
+        Scalar exp_cut[detail::pair_batch_size];
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            const param_type& param = params[batch.typpair[b]];
+            epsilon[b] = param.epsilon;
+            kappa[b] = param.kappa;
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            Scalar mask = batch.rsq[b] < batch.rcutsq[b] ? Scalar(1.0) : Scalar(0.0);
+            mask = epsilon[b] != Scalar(0.0) ? mask : Scalar(0.0);
+            batch.evaluated[b] = mask;
+            rinv[b] = fast::rsqrt(detail::pair_batch_safe(batch.rsq[b], mask));
+            rcutinv[b] = fast::rsqrt(detail::pair_batch_safe(batch.rcutsq[b], mask));
+            }
+
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            exp_val[b] = fast::exp(-kappa[b] * (Scalar(1.0) / rinv[b]));
+            exp_cut[b] = fast::exp(-kappa[b] * (Scalar(1.0) / rcutinv[b]));
+            }
+
+#pragma omp simd
+        for (unsigned int b = 0; b < detail::pair_batch_size; b++)
+            {
+            Scalar mask = batch.evaluated[b];
+            Scalar r2inv = rinv[b] * rinv[b];
+            Scalar force_divr = epsilon[b] * exp_val[b] * r2inv * (rinv[b] + kappa[b]);
+            Scalar pair_eng = epsilon[b] * exp_val[b] * rinv[b];
+            pair_eng -= batch.energy_shift[b] * epsilon[b] * exp_cut[b] * rcutinv[b];
+
+            batch.force_divr[b] = mask * force_divr;
+            batch.pair_eng[b] = mask * pair_eng;
+            }
+        }
 #endif
 
     protected:
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "BondedForceCompute.h"
 #include "hoomd/BondedGroupData.h"
 #include "hoomd/ForceCompute.h"
 
@@ -59,7 +60,7 @@ struct dihedral_harmonic_params
     The dihedrals which forces are computed on are accessed from ParticleData::getDihedralData
     \ingroup computes
 */
-class PYBIND11_EXPORT HarmonicDihedralForceCompute : public ForceCompute
+class PYBIND11_EXPORT HarmonicDihedralForceCompute : public BondedForceCompute
     {
     public:
     //! Constructs the compute
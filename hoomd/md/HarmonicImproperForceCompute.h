@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "BondedForceCompute.h"
 #include "hoomd/BondedGroupData.h"
 #include "hoomd/ForceCompute.h"
 
@@ -31,7 +32,7 @@ namespace md
     The impropers which forces are computed on are accessed from ParticleData::getImproperData
     \ingroup computes
 */
-class PYBIND11_EXPORT HarmonicImproperForceCompute : public ForceCompute
+class PYBIND11_EXPORT HarmonicImproperForceCompute : public BondedForceCompute
     {
     public:
     //! Constructs the compute
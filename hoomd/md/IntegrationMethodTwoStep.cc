@@ -157,6 +157,8 @@ void export_IntegrationMethodTwoStep(pybind11::module& m)
                      std::shared_ptr<IntegrationMethodTwoStep>>(m, "IntegrationMethodTwoStep")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<ParticleGroup>>())
         .def("validateGroup", &IntegrationMethodTwoStep::validateGroup)
+        .def("setProfileName", &IntegrationMethodTwoStep::setProfileName)
+        .def("getProfileName", &IntegrationMethodTwoStep::getProfileName)
         .def_property_readonly("filter",
                                [](const std::shared_ptr<IntegrationMethodTwoStep> method)
                                { return method->getGroup()->getFilter(); });
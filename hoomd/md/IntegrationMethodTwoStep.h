@@ -169,6 +169,18 @@ class PYBIND11_EXPORT IntegrationMethodTwoStep : public Autotuned
         return true;
         }
 
+    /// Set the name that identifies this method in the profiler.
+    void setProfileName(const std::string& name)
+        {
+        m_profile_name = name;
+        }
+
+    /// Get the name that identifies this method in the profiler.
+    const std::string& getProfileName() const
+        {
+        return m_profile_name;
+        }
+
     protected:
     const std::shared_ptr<SystemDefinition>
         m_sysdef; //!< The system definition this method is associated with
@@ -180,6 +192,9 @@ class PYBIND11_EXPORT IntegrationMethodTwoStep : public Autotuned
     bool m_aniso;    //!< True if anisotropic integration is requested
 
     Scalar m_deltaT; //!< The time step
+
+    /// Name that identifies this method in the profiler.
+    std::string m_profile_name = "IntegrationMethodTwoStep";
     };
 
     } // end namespace md
@@ -62,6 +62,7 @@ void IntegratorTwoStep::update(uint64_t timestep)
         // files. Work around this by calling setDeltaT every timestep.
         method->setAnisotropic(m_integrate_rotational_dof);
         method->setDeltaT(m_deltaT);
+        ProfilerScope scope(m_exec_conf->getProfiler(), method->getProfileName());
         method->integrateStepOne(timestep);
         }
 
@@ -108,6 +109,7 @@ void IntegratorTwoStep::update(uint64_t timestep)
     for (auto method_ptr = m_methods.rbegin(); method_ptr != m_methods.rend(); method_ptr++)
         {
         auto method = *method_ptr;
+        ProfilerScope scope(m_exec_conf->getProfiler(), method->getProfileName());
         method->integrateStepTwo(timestep);
         method->includeRATTLEForce(timestep + 1);
         }
@@ -296,6 +298,19 @@ PDataFlags IntegratorTwoStep::getRequestedPDataFlags()
     return flags;
     }
 
+#ifdef ENABLE_MPI
+/*! The Communicator updates the rigid body constituent positions after the ghost update, which
+    would invalidate the interior forces.
+*/
+void IntegratorTwoStep::ghostUpdateOverlapCallback(uint64_t timestep)
+    {
+    if (m_rigid_bodies)
+        return;
+
+    Integrator::ghostUpdateOverlapCallback(timestep);
+    }
+#endif
+
 //! Updates the rigid body constituent particles
 void IntegratorTwoStep::updateRigidBodies(uint64_t timestep)
     {
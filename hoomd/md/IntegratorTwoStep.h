@@ -85,6 +85,9 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
 #ifdef ENABLE_MPI
     /// helper function to determine the ghost communication flags
     virtual CommFlags determineFlags(uint64_t timestep);
+
+    /// Callback for computing the interior forces during the ghost update
+    virtual void ghostUpdateOverlapCallback(uint64_t timestep);
 #endif
 
     /// Check if any forces introduce anisotropic degrees of freedom
@@ -31,7 +31,8 @@ namespace md
 */
 NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
     : Compute(sysdef), m_typpair_idx(m_pdata->getNTypes()), m_rcut_max_max(0.0), m_rcut_min(0.0),
-      m_r_buff(r_buff), m_filter_body(false), m_storage_mode(half), m_meshbond_data(NULL),
+      m_r_buff(r_buff), m_filter_body(false), m_storage_mode(half), m_sort_mode(unsorted),
+      m_meshbond_data(NULL),
       m_rcut_changed(true), m_updates(0), m_forced_updates(0), m_dangerous_updates(0),
       m_force_update(true), m_dist_check(true), m_has_been_updated_once(false)
     {
@@ -379,6 +380,8 @@ void NeighborList::compute(uint64_t timestep)
     if (!shouldCompute(timestep) && !m_force_update)
         return;
 
+    ProfilerScope scope(m_exec_conf->getProfiler(), m_profile_name);
+
     // when the number of particles or bonds in the system changes, rebuild the exclusion list
     if (m_n_particles_changed || m_topology_changed)
         {
@@ -405,6 +408,8 @@ void NeighborList::compute(uint64_t timestep)
     // check if the list needs to be updated and update it
     if (needsUpdating(timestep))
         {
+        int64_t start = m_clk.getTime();
+
         // check simulation box size is OK
         checkBoxSize();
 
@@ -429,8 +434,12 @@ void NeighborList::compute(uint64_t timestep)
         if (m_exclusions_set)
             filterNlist();
 
+        if (m_sort_mode != unsorted)
+            sortNlist();
+
         setLastUpdatedPos();
         m_has_been_updated_once = true;
+        m_build_time += m_clk.getTime() - start;
         }
     }
 
@@ -1535,6 +1544,56 @@ void NeighborList::filterNlist()
         }
     }
 
+/*! Sorts the neighbors of each local particle by index (by_index), or by type and then by index
+    (by_type). The sorted list holds the same pairs as the unsorted one.
+*/
+void NeighborList::sortNlist()
+    {
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    const bool sort_type = m_sort_mode == by_type;
+    auto type_less = [&](unsigned int a, unsigned int b)
+    {
+        const unsigned int type_a = __scalar_as_int(h_pos.data[a].w);
+        const unsigned int type_b = __scalar_as_int(h_pos.data[b].w);
+        return type_a < type_b || (type_a == type_b && a < b);
+    };
+
+    auto sort_range = [&](unsigned int first, unsigned int last)
+    {
+        for (unsigned int i = first; i < last; i++)
+            {
+            unsigned int* begin = h_nlist.data + h_head_list.data[i];
+            unsigned int* end = begin + h_n_neigh.data[i];
+            if (sort_type)
+                std::sort(begin, end, type_less);
+            else
+                std::sort(begin, end);
+            }
+    };
+
+    const unsigned int N = m_pdata->getN();
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { sort_range(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif
+        {
+        sort_range(0, N);
+        }
+    }
+
 /*!
  * Iterates through each particle, and calculates a running sum of the starting index for that
  * particle in the flat array of neighbors.
@@ -1997,6 +2056,9 @@ void export_NeighborList(pybind11::module& m)
                       &NeighborList::setRebuildCheckDelay)
         .def_property("check_dist", &NeighborList::getDistCheck, &NeighborList::setDistCheck)
         .def("setStorageMode", &NeighborList::setStorageMode)
+        .def_property("sort",
+                      &NeighborList::getSortModePython,
+                      &NeighborList::setSortModePython)
         .def_property("exclusions", &NeighborList::getExclusions, &NeighborList::setExclusions)
         .def("addMesh", &NeighborList::AddMesh)
         .def("getMaxRCut", &NeighborList::getMaxRCut)
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "hoomd/ClockSource.h"
 #include "hoomd/Compute.h"
 #include "hoomd/GPUFlags.h"
 #include "hoomd/GPUVector.h"
@@ -10,8 +11,11 @@
 #include "hoomd/PythonLocalDataAccess.h"
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
+#include <algorithm>
 #include <memory>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 /*! \file NeighborList.h
@@ -31,6 +35,12 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 namespace md
@@ -69,6 +79,12 @@ namespace md
     \a jf includes flags in the highest bits. The format and use of these flags are yet to be
    determined.
 
+    By default, neighbors are stored in the order the build algorithm finds them. setSortMode()
+   sorts each particle's neighbors by index, or by type and then index, after every build. The
+   particle data is ordered along a space filling curve, so index order turns the random gathers of
+   neighbor data in force computes into mostly ascending memory accesses. Type order additionally
+   lets force computes reuse the per type pair parameters over runs of neighbors with the same type.
+
     \b Filtering:
 
     By default, a neighbor list includes all particles within a single cutoff distance r_cut.
@@ -128,6 +144,14 @@ class PYBIND11_EXPORT NeighborList : public Compute
         full  //!< All neighbors are stored
         };
 
+    //! Simple enum for the neighbor sort modes
+    enum sortMode
+        {
+        unsorted, //!< Neighbors are stored in the order they are found
+        by_index, //!< Neighbors are sorted by index
+        by_type   //!< Neighbors are sorted by type, then by index
+        };
+
     //! Constructs the compute
     NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
 
@@ -235,6 +259,39 @@ class PYBIND11_EXPORT NeighborList : public Compute
         forceUpdate();
         }
 
+    //! Set the sort mode
+    /*! \param mode Sort mode to set
+
+        The neighborlist is not immediately updated to reflect this change. It will take effect
+        when compute is called for the next timestep.
+    */
+    void setSortMode(sortMode mode)
+        {
+        m_sort_mode = mode;
+        forceUpdate();
+        }
+
+    //! Set the sort mode from a string
+    void setSortModePython(const std::string& mode)
+        {
+        if (mode == "none")
+            {
+            setSortMode(unsorted);
+            }
+        else if (mode == "index")
+            {
+            setSortMode(by_index);
+            }
+        else if (mode == "type")
+            {
+            setSortMode(by_type);
+            }
+        else
+            {
+            throw std::runtime_error("Invalid neighbor list sort mode: " + mode);
+            }
+        }
+
     // @}
     //! \name Get properties
     // @{
@@ -245,6 +302,22 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_storage_mode;
         }
 
+    //! Get the sort mode
+    sortMode getSortMode()
+        {
+        return m_sort_mode;
+        }
+
+    //! Get the sort mode as a string
+    std::string getSortModePython()
+        {
+        if (m_sort_mode == by_index)
+            return "index";
+        else if (m_sort_mode == by_type)
+            return "type";
+        return "none";
+        }
+
     //! Get the maximum of all rcut
     Scalar getMaxRCut()
         {
@@ -413,6 +486,27 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_updates + m_forced_updates;
         }
 
+    //! Get the number of dangerous builds
+    uint64_t getNumDangerousUpdates() const
+        {
+        return m_dangerous_updates;
+        }
+
+    //! Get the histogram of the number of steps between updates
+    /*! Element \a i counts the updates that occurred \a i steps after the previous one. The last
+        element also counts all longer periods.
+    */
+    const std::vector<uint64_t>& getUpdatePeriods() const
+        {
+        return m_update_periods;
+        }
+
+    //! Get the total wall clock time (in nanoseconds) spent building the neighbor list
+    int64_t getBuildTime() const
+        {
+        return m_build_time;
+        }
+
 #ifdef ENABLE_MPI
     //! Returns true if the particle migration criterion is fulfilled
     /*! \param timestep The current timestep
@@ -484,6 +578,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
     Scalar m_r_buff;            //!< The buffer around the cutoff
     bool m_filter_body;         //!< Set to true if particles in the same body are to be filtered
     storageMode m_storage_mode; //!< The storage mode
+    sortMode m_sort_mode;       //!< The neighbor sort mode
 
     GlobalArray<unsigned int> m_nlist;   //!< Neighbor list data
     GlobalArray<unsigned int> m_n_neigh; //!< Number of neighbors for each particle
@@ -530,6 +625,55 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
 
+    //! Apply a neighbor list build function to all local particles
+    /*! \param h_conditions Host pointer to the m_conditions array
+        \param build_range Function that builds the neighbor list of particles [first, last) with
+               the signature build_range(first, last, conditions). It must only write the rows of
+               m_nlist and m_n_neigh that belong to its particles, and must record overflows in
+               \a conditions, which is indexed by particle type.
+
+        When TBB is enabled and more than one CPU thread is in use, disjoint ranges of particles
+        are processed concurrently. Each thread records overflow conditions in its own array and
+        the maximum over all threads is written to \a h_conditions. Each particle's neighbors are
+        found by the same serial search, so the neighbor order does not depend on the number of
+        threads.
+    */
+    template<class BuildRange>
+    void buildNlistParticles(unsigned int* h_conditions, const BuildRange& build_range)
+        {
+        const unsigned int N = m_pdata->getN();
+#ifdef ENABLE_TBB
+        if (m_exec_conf->getNumThreads() > 1)
+            {
+            const unsigned int n_types = m_pdata->getNTypes();
+            tbb::enumerable_thread_specific<std::vector<unsigned int>> thread_conditions(
+                std::vector<unsigned int>(h_conditions, h_conditions + n_types));
+
+            m_exec_conf->getTaskArena()->execute(
+                [&]
+                {
+                    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                      [&](const tbb::blocked_range<unsigned int>& r)
+                                      {
+                                          build_range(r.begin(),
+                                                      r.end(),
+                                                      thread_conditions.local().data());
+                                      });
+                });
+
+            for (const auto& conditions : thread_conditions)
+                {
+                for (unsigned int type = 0; type < n_types; ++type)
+                    {
+                    h_conditions[type] = std::max(h_conditions[type], conditions[type]);
+                    }
+                }
+            return;
+            }
+#endif
+        build_range(0, N, h_conditions);
+        }
+
     //! Updates the idx exclusion list
     virtual void updateExListIdx();
 
@@ -542,6 +686,9 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Filter the neighbor list of excluded particles
     virtual void filterNlist();
 
+    //! Sort the neighbors of each particle
+    virtual void sortNlist();
+
     //! Build the head list to allocated memory
     virtual void buildHeadList();
 
@@ -583,6 +730,8 @@ class PYBIND11_EXPORT NeighborList : public Compute
     uint64_t m_updates;           //!< Number of times the neighbor list has been updated
     uint64_t m_forced_updates;    //!< Number of times the neighbor list has been forcibly updated
     uint64_t m_dangerous_updates; //!< Number of dangerous builds counted
+    int64_t m_build_time = 0;     //!< Time spent building the neighbor list (in nanoseconds)
+    ClockSource m_clk;            //!< Clock that times the builds
     bool m_force_update;          //!< Flag to handle the forcing of neighborlist updates
     bool m_dist_check;            //!< Set to false to disable distance checks (nlist always built
                                   //!< m_rebuild_check_delay steps)
@@ -0,0 +1,309 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListAdaptive.cc
+    \brief Defines the NeighborListAdaptive class
+*/
+
+#include "NeighborListAdaptive.h"
+#include "NeighborListStencil.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Steps on which to adjust the neighbor list
+    \param nlist Neighbor list to adjust
+    \param minimum_buffer Smallest buffer
+    \param maximum_buffer Largest buffer
+*/
+NeighborListAdaptive::NeighborListAdaptive(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<Trigger> trigger,
+                                           std::shared_ptr<NeighborList> nlist,
+                                           Scalar minimum_buffer,
+                                           Scalar maximum_buffer)
+    : Tuner(sysdef, trigger), m_nlist(nlist)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListAdaptive" << std::endl;
+
+    // kernel launches are asynchronous, so the measured times do not reflect the GPU cost
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        throw std::invalid_argument("NeighborListAdaptive is not supported on the GPU");
+        }
+
+    setMinimumBuffer(minimum_buffer);
+    setMaximumBuffer(maximum_buffer);
+    }
+
+NeighborListAdaptive::~NeighborListAdaptive()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListAdaptive" << std::endl;
+    }
+
+void NeighborListAdaptive::setMinimumBuffer(Scalar minimum_buffer)
+    {
+    if (minimum_buffer < Scalar(0.0))
+        {
+        throw std::invalid_argument("minimum_buffer must be non-negative");
+        }
+    m_minimum_buffer = minimum_buffer;
+    }
+
+void NeighborListAdaptive::setMaximumBuffer(Scalar maximum_buffer)
+    {
+    if (maximum_buffer <= Scalar(0.0))
+        {
+        throw std::invalid_argument("maximum_buffer must be positive");
+        }
+    m_maximum_buffer = maximum_buffer;
+    }
+
+void NeighborListAdaptive::setMaxChange(Scalar max_change)
+    {
+    if (max_change <= Scalar(0.0) || max_change >= Scalar(1.0))
+        {
+        throw std::invalid_argument("max_change must be in the range (0, 1)");
+        }
+    m_max_change = max_change;
+    }
+
+/*! \param timestep Current time step
+
+    Record the counters of the neighbor list and the force compute time at the start of a window.
+*/
+void NeighborListAdaptive::startWindow(uint64_t timestep)
+    {
+    m_last_timestep = timestep;
+    m_last_builds = m_nlist->getNumUpdates();
+    m_last_dangerous = m_nlist->getNumDangerousUpdates();
+    m_last_build_time = getBuildTime();
+    m_last_force_time = getForceComputeTime();
+    m_last_update_periods = m_nlist->getUpdatePeriods();
+    m_window_started = true;
+    }
+
+/*! \param timestep Current time step
+
+    Evaluate the window that ends at \a timestep, adjust the neighbor list, and start the next
+    window. The first call only starts a window.
+*/
+void NeighborListAdaptive::update(uint64_t timestep)
+    {
+    Tuner::update(timestep);
+
+    if (!m_window_started || timestep <= m_last_timestep)
+        {
+        startWindow(timestep);
+        return;
+        }
+
+    const uint64_t steps = timestep - m_last_timestep;
+    uint64_t builds = m_nlist->getNumUpdates() - m_last_builds;
+    uint64_t dangerous = m_nlist->getNumDangerousUpdates() - m_last_dangerous;
+    double build_time = double(getBuildTime() - m_last_build_time);
+    double force_time = double(getForceComputeTime() - m_last_force_time);
+
+    // find the shortest period between builds in this window
+    const std::vector<uint64_t>& periods = m_nlist->getUpdatePeriods();
+    uint64_t shortest = steps;
+    for (size_t i = 1; i < periods.size(); i++)
+        {
+        uint64_t last = i < m_last_update_periods.size() ? m_last_update_periods[i] : 0;
+        if (periods[i] > last)
+            {
+            shortest = std::min<uint64_t>(i, shortest);
+            break;
+            }
+        }
+
+#ifdef ENABLE_MPI
+    // the slowest rank sets the pace, and all ranks must make the same decisions
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+        MPI_Allreduce(MPI_IN_PLACE, &build_time, 1, MPI_DOUBLE, MPI_MAX, mpi_comm);
+        MPI_Allreduce(MPI_IN_PLACE, &force_time, 1, MPI_DOUBLE, MPI_MAX, mpi_comm);
+        MPI_Allreduce(MPI_IN_PLACE, &builds, 1, MPI_UINT64_T, MPI_MAX, mpi_comm);
+        MPI_Allreduce(MPI_IN_PLACE, &dangerous, 1, MPI_UINT64_T, MPI_MAX, mpi_comm);
+        MPI_Allreduce(MPI_IN_PLACE, &shortest, 1, MPI_UINT64_T, MPI_MIN, mpi_comm);
+        }
+#endif
+
+    // the force computes include the neighbor list builds they trigger
+    const double other_force_time = std::max(force_time - build_time, 0.0);
+    m_build_period = Scalar(steps) / Scalar(std::max<uint64_t>(builds, 1));
+    m_build_fraction = force_time > 0 ? Scalar(build_time / force_time) : Scalar(0.0);
+
+    // adjust the check delay
+    if (m_nlist->getDistCheck())
+        {
+        uint64_t delay = m_nlist->getRebuildCheckDelay();
+        uint64_t new_delay = delay;
+        if (dangerous > 0)
+            {
+            new_delay = std::max<uint64_t>(delay / 2, 1);
+            }
+        else if (builds > 0 && 4 * (delay + 1) <= shortest)
+            {
+            new_delay = delay + 1;
+            }
+
+        if (new_delay != delay)
+            {
+            m_exec_conf->msg->notice(6) << "NeighborListAdaptive: rebuild_check_delay = "
+                                        << new_delay << std::endl;
+            m_nlist->setRebuildCheckDelay(new_delay);
+            }
+        }
+
+    // adjust the cell width of stencil neighbor lists, holding the buffer fixed while exploring
+    bool exploring = false;
+    if (std::dynamic_pointer_cast<NeighborListStencil>(m_nlist))
+        {
+        updateCellWidth(build_time, builds);
+        exploring = !m_cell_widths.empty();
+        }
+
+    // adjust the buffer
+    if (!exploring && builds > 0)
+        {
+        const Scalar buffer = m_nlist->getRBuff();
+        const Scalar new_buffer = optimizeBuffer(build_time / double(builds),
+                                                 other_force_time / double(steps),
+                                                 double(m_build_period));
+        if (std::abs(new_buffer - buffer) > Scalar(1e-3) * std::max(buffer, Scalar(1e-3)))
+            {
+            m_exec_conf->msg->notice(6)
+                << "NeighborListAdaptive: buffer = " << new_buffer << std::endl;
+            m_nlist->setRBuff(new_buffer);
+            }
+        }
+
+    startWindow(timestep);
+    }
+
+/*! \param build_time Time per build
+    \param force_time Time per step spent in force computes, excluding builds
+    \param period Steps per build
+    \returns The buffer in the allowed range that minimizes the estimated cost
+*/
+Scalar NeighborListAdaptive::optimizeBuffer(double build_time, double force_time, double period)
+    {
+    const double r_cut = m_nlist->getMaxRCut();
+    const double b0 = std::max(double(m_nlist->getRBuff()), 1e-3);
+
+    // the buffer moves by at most m_max_change per window
+    double lower = std::max(double(m_minimum_buffer), b0 * (1.0 - m_max_change));
+    double upper = std::min(double(m_maximum_buffer), b0 * (1.0 + m_max_change));
+    if (lower > upper)
+        {
+        // the current buffer is outside the allowed range
+        return b0 < m_minimum_buffer ? m_minimum_buffer : m_maximum_buffer;
+        }
+    lower = std::max(lower, 1e-6);
+
+    auto cost = [&](double b)
+    {
+        double s = (r_cut + b) / (r_cut + b0);
+        return s * s * s * (build_time / period * b0 / b + force_time);
+    };
+
+    // the cost is smooth and has a single minimum, sample it on a fine grid
+    const unsigned int n_samples = 64;
+    double best = b0;
+    double best_cost = cost(std::min(std::max(b0, lower), upper));
+    for (unsigned int i = 0; i <= n_samples; i++)
+        {
+        double b = lower + (upper - lower) * double(i) / double(n_samples);
+        double c = cost(b);
+        if (c < best_cost)
+            {
+            best = b;
+            best_cost = c;
+            }
+        }
+
+    return Scalar(std::min(std::max(best, lower), upper));
+    }
+
+/*! \param build_time Build time in the last window
+    \param builds Number of builds in the last window
+
+    Measure the build time with each candidate cell width in turn, then select the fastest.
+*/
+void NeighborListAdaptive::updateCellWidth(double build_time, uint64_t builds)
+    {
+    auto stencil = std::static_pointer_cast<NeighborListStencil>(m_nlist);
+    const Scalar buffer = m_nlist->getRBuff();
+
+    if (m_cell_widths.empty())
+        {
+        if (m_explored_buffer >= Scalar(0.0)
+            && std::abs(buffer - m_explored_buffer) <= Scalar(0.1) * m_explored_buffer)
+            {
+            return;
+            }
+
+        const Scalar r_list = m_nlist->getMaxRList();
+        m_cell_widths = {r_list, r_list / Scalar(2.0), r_list / Scalar(3.0)};
+        m_cell_width_times.clear();
+        m_cell_width_index = 0;
+        m_explored_buffer = buffer;
+        stencil->setCellWidth(m_cell_widths[0]);
+        return;
+        }
+
+    // keep measuring when there were no builds in the window
+    if (builds == 0)
+        return;
+
+    m_cell_width_times.push_back(build_time / double(builds));
+    m_cell_width_index++;
+    if (m_cell_width_index < m_cell_widths.size())
+        {
+        stencil->setCellWidth(m_cell_widths[m_cell_width_index]);
+        return;
+        }
+
+    size_t best = std::min_element(m_cell_width_times.begin(), m_cell_width_times.end())
+                  - m_cell_width_times.begin();
+    m_exec_conf->msg->notice(6) << "NeighborListAdaptive: cell_width = " << m_cell_widths[best]
+                                << std::endl;
+    stencil->setCellWidth(m_cell_widths[best]);
+    m_cell_widths.clear();
+    }
+
+namespace detail
+    {
+void export_NeighborListAdaptive(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListAdaptive, Tuner, std::shared_ptr<NeighborListAdaptive>>(
+        m,
+        "NeighborListAdaptive")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar,
+                            Scalar>())
+        .def_property("minimum_buffer",
+                      &NeighborListAdaptive::getMinimumBuffer,
+                      &NeighborListAdaptive::setMinimumBuffer)
+        .def_property("maximum_buffer",
+                      &NeighborListAdaptive::getMaximumBuffer,
+                      &NeighborListAdaptive::setMaximumBuffer)
+        .def_property("max_change",
+                      &NeighborListAdaptive::getMaxChange,
+                      &NeighborListAdaptive::setMaxChange)
+        .def_property_readonly("build_period", &NeighborListAdaptive::getBuildPeriod)
+        .def_property_readonly("build_fraction", &NeighborListAdaptive::getBuildFraction);
+    }
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
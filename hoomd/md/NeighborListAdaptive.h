@@ -0,0 +1,169 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListAdaptive.h
+    \brief Declares the NeighborListAdaptive class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#pragma once
+
+#include "NeighborList.h"
+#include "hoomd/Tuner.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Continuously adjust the neighbor list buffer, check delay, and stencil cell width
+/** NeighborListAdaptive measures the performance of the simulation over the window of steps
+    between two calls to update() and adjusts the neighbor list for the next window.
+
+    <b>Buffer:</b> In a window of \f$ n \f$ steps with \f$ n_b \f$ builds, let \f$ t_b \f$ be the
+    time per build, \f$ t_f \f$ the time per step spent in force computes other than the build,
+    and \f$ p = n / n_b \f$ the build period. The estimated cost per step as a function of the
+    buffer \f$ b \f$ is
+
+    \f[ C(b) = s(b) \left( \frac{t_b}{p} \frac{b_0}{b} + t_f \right), \quad
+        s(b) = \left( \frac{r_\mathrm{cut} + b}{r_\mathrm{cut} + b_0} \right)^3 \f]
+
+    where \f$ b_0 \f$ is the current buffer. The number of neighbors, and with it the build and
+    force costs, scale with the volume of the neighbor sphere. The build period scales linearly
+    with the buffer, as it does for ballistic motion on the short time between builds. The buffer
+    moves toward the minimum of \f$ C \f$ in [minimum buffer, maximum buffer], but by no more than a
+    fraction max_change per window. The measurements and the model are refreshed every window, so
+    the buffer follows the changes of density and temperature during the run.
+
+    <b>Check delay:</b> A dangerous build in the window halves the check delay. Otherwise, the
+    delay grows by one step while it is less than a quarter of the shortest build period in the
+    window.
+
+    <b>Cell width:</b> With a NeighborListStencil, the tuner measures the build time with cell
+    widths of 1, 1/2, and 1/3 of the largest list radius in consecutive windows and keeps the
+    fastest. The buffer is held fixed while exploring. The widths are explored again when the buffer
+    has changed by more than 10% since the last exploration.
+
+    With MPI, the slowest rank determines the times and all ranks make the same decisions.
+
+    The times are wall clock times measured on the host, so NeighborListAdaptive supports only the
+    CPU.
+*/
+class PYBIND11_EXPORT NeighborListAdaptive : public Tuner
+    {
+    public:
+    /// Constructor
+    NeighborListAdaptive(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<Trigger> trigger,
+                         std::shared_ptr<NeighborList> nlist,
+                         Scalar minimum_buffer,
+                         Scalar maximum_buffer);
+
+    /// Destructor
+    virtual ~NeighborListAdaptive();
+
+    /// Adjust the neighbor list
+    virtual void update(uint64_t timestep);
+
+    /// Get the smallest buffer
+    Scalar getMinimumBuffer() const
+        {
+        return m_minimum_buffer;
+        }
+
+    /// Set the smallest buffer
+    void setMinimumBuffer(Scalar minimum_buffer);
+
+    /// Get the largest buffer
+    Scalar getMaximumBuffer() const
+        {
+        return m_maximum_buffer;
+        }
+
+    /// Set the largest buffer
+    void setMaximumBuffer(Scalar maximum_buffer);
+
+    /// Get the largest relative change of the buffer in one window
+    Scalar getMaxChange() const
+        {
+        return m_max_change;
+        }
+
+    /// Set the largest relative change of the buffer in one window
+    void setMaxChange(Scalar max_change);
+
+    /// Get the average number of steps between builds in the last window
+    Scalar getBuildPeriod() const
+        {
+        return m_build_period;
+        }
+
+    /// Get the fraction of the force compute time spent building the neighbor list in the last
+    /// window
+    Scalar getBuildFraction() const
+        {
+        return m_build_fraction;
+        }
+
+    protected:
+    std::shared_ptr<NeighborList> m_nlist; //!< The neighbor list to adjust
+    Scalar m_minimum_buffer;               //!< Smallest buffer
+    Scalar m_maximum_buffer;               //!< Largest buffer
+    Scalar m_max_change = Scalar(0.2);     //!< Largest relative change of the buffer per window
+
+    Scalar m_build_period = Scalar(0.0);   //!< Steps per build in the last window
+    Scalar m_build_fraction = Scalar(0.0); //!< Fraction of the force time spent in builds
+
+    /// Measurements at the start of the current window
+    bool m_window_started = false;
+    uint64_t m_last_timestep = 0;
+    uint64_t m_last_builds = 0;
+    uint64_t m_last_dangerous = 0;
+    int64_t m_last_build_time = 0;
+    int64_t m_last_force_time = 0;
+    std::vector<uint64_t> m_last_update_periods;
+
+    /// Stencil cell width exploration
+    std::vector<Scalar> m_cell_widths;       //!< Cell widths to explore (empty when not exploring)
+    std::vector<double> m_cell_width_times;  //!< Measured time per build for each width
+    unsigned int m_cell_width_index = 0;     //!< Index of the width being measured
+    Scalar m_explored_buffer = Scalar(-1.0); //!< Buffer at the last exploration
+
+    /// Get the total time (in nanoseconds) spent building the neighbor list
+    /** Tests override the time getters to make the decisions of the tuner deterministic.
+     */
+    virtual int64_t getBuildTime()
+        {
+        return m_nlist->getBuildTime();
+        }
+
+    /// Get the total time (in nanoseconds) spent in force computes
+    virtual int64_t getForceComputeTime()
+        {
+        return m_sysdef->getForceComputeTime();
+        }
+
+    /// Choose the buffer that minimizes the estimated cost
+    Scalar optimizeBuffer(double build_time, double force_time, double period);
+
+    /// Adjust the cell width of a stencil neighbor list
+    void updateCellWidth(double build_time, uint64_t builds);
+
+    /// Start a new measurement window
+    void startWindow(uint64_t timestep);
+    };
+
+namespace detail
+    {
+/// Export NeighborListAdaptive to python
+void export_NeighborListAdaptive(pybind11::module& m);
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -89,93 +89,97 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     // get periodic flags
     uchar3 periodic = box.getPeriodic();
 
-    // for each local particle
-    unsigned int nparticles = m_pdata->getN();
-
-    for (int i = 0; i < (int)nparticles; i++)
-        {
-        unsigned int cur_n_neigh = 0;
-
-        const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int body_i = h_body.data[i];
-
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t head_idx_i = h_head_list.data[i];
-
-        // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(my_pos, ghost_width);
-        int ib = (unsigned int)(f.x * dim.x);
-        int jb = (unsigned int)(f.y * dim.y);
-        int kb = (unsigned int)(f.z * dim.z);
-
-        // need to handle the case where the particle is exactly at the box hi
-        if (ib == (int)dim.x && periodic.x)
-            ib = 0;
-        if (jb == (int)dim.y && periodic.y)
-            jb = 0;
-        if (kb == (int)dim.z && periodic.z)
-            kb = 0;
-
-        // identify the bin
-        unsigned int my_cell = ci(ib, jb, kb);
-
-        // loop through all neighboring bins
-        for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
+    // build the neighbor list of each local particle
+    auto build_range = [&](unsigned int first, unsigned int last, unsigned int* conditions)
+    {
+        for (int i = (int)first; i < (int)last; i++)
             {
-            unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
-
-            // check against all the particles in that neighboring bin to see if it is a neighbor
-            unsigned int size = h_cell_size.data[neigh_cell];
-            for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+            unsigned int cur_n_neigh = 0;
+
+            const Scalar3 my_pos
+                = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int body_i = h_body.data[i];
+
+            const unsigned int Nmax_i = h_Nmax.data[type_i];
+            const size_t head_idx_i = h_head_list.data[i];
+
+            // find the bin each particle belongs in
+            Scalar3 f = box.makeFraction(my_pos, ghost_width);
+            int ib = (unsigned int)(f.x * dim.x);
+            int jb = (unsigned int)(f.y * dim.y);
+            int kb = (unsigned int)(f.z * dim.z);
+
+            // need to handle the case where the particle is exactly at the box hi
+            if (ib == (int)dim.x && periodic.x)
+                ib = 0;
+            if (jb == (int)dim.y && periodic.y)
+                jb = 0;
+            if (kb == (int)dim.z && periodic.z)
+                kb = 0;
+
+            // identify the bin
+            unsigned int my_cell = ci(ib, jb, kb);
+
+            // loop through all neighboring bins
+            for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
                 {
-                Scalar4& cur_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
-                unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
-
-                // get the current neighbor type from the position data (will use TypeBody on the
-                // GPU)
-                unsigned int cur_neigh_type = __scalar_as_int(h_pos.data[cur_neigh].w);
-                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_neigh_type)];
-
-                // automatically exclude particles without a distance check when:
-                // (1) they are the same particle, or
-                // (2) the r_cut(i,j) indicates to skip, or
-                // (3) they are in the same body
-                bool excluded = ((i == (int)cur_neigh) || (r_cut <= Scalar(0.0)));
-                if (m_filter_body && body_i != NO_BODY)
-                    excluded = excluded | (body_i == h_body.data[cur_neigh]);
-                if (excluded)
-                    continue;
-
-                Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
-                Scalar3 dx = my_pos - neigh_pos;
-                dx = box.minImage(dx);
-
-                Scalar dr_sq = dot(dx, dx);
-
-                Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
-                if (dr_sq <= r_listsq && !excluded)
+                unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
+
+                // check against all the particles in that neighboring bin to see if it is a
+                // neighbor
+                unsigned int size = h_cell_size.data[neigh_cell];
+                for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
                     {
-                    // Add the neighbor index to the list.
-                    if (m_storage_mode == full || i < (int)cur_neigh)
+                    Scalar4& cur_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
+                    unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
+
+                    // get the current neighbor type from the position data (will use TypeBody on
+                    // the GPU)
+                    unsigned int cur_neigh_type = __scalar_as_int(h_pos.data[cur_neigh].w);
+                    Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_neigh_type)];
+
+                    // automatically exclude particles without a distance check when:
+                    // (1) they are the same particle, or
+                    // (2) the r_cut(i,j) indicates to skip, or
+                    // (3) they are in the same body
+                    bool excluded = ((i == (int)cur_neigh) || (r_cut <= Scalar(0.0)));
+                    if (m_filter_body && body_i != NO_BODY)
+                        excluded = excluded | (body_i == h_body.data[cur_neigh]);
+                    if (excluded)
+                        continue;
+
+                    Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
+                    Scalar3 dx = my_pos - neigh_pos;
+                    dx = box.minImage(dx);
+
+                    Scalar dr_sq = dot(dx, dx);
+
+                    Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
+                    if (dr_sq <= r_listsq && !excluded)
                         {
-                        // local neighbor
-                        if (cur_n_neigh < Nmax_i)
+                        // Add the neighbor index to the list.
+                        if (m_storage_mode == full || i < (int)cur_neigh)
                             {
-                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            // local neighbor
+                            if (cur_n_neigh < Nmax_i)
+                                {
+                                h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                                }
+                            else
+                                conditions[type_i] = max(conditions[type_i], cur_n_neigh + 1);
+
+                            cur_n_neigh++;
                             }
-                        else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
-
-                        cur_n_neigh++;
                         }
                     }
                 }
+
+            h_n_neigh.data[i] = cur_n_neigh;
             }
+    };
 
-        h_n_neigh.data[i] = cur_n_neigh;
-        }
+    buildNlistParticles(h_conditions.data, build_range);
     }
 
 namespace detail
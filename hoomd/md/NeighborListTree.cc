@@ -193,7 +193,7 @@ void NeighborListTree::updateImageVectors()
     }
 
 /*!
- * \note AABBTree implements its own build routine, so this is a wrapper to call this for multiple
+ * \note WideAABBTree implements its own build routine, so this is a wrapper to call this for multiple
  * tree types.
  */
 void NeighborListTree::buildTree()
@@ -267,10 +267,10 @@ void NeighborListTree::buildTree()
     }
 
 /*!
- * Each AABBTree is traversed in a stackless fashion. One traversal is performed (per particle)-(per
- * tree)-(per image). The stackless traversal is a variation on left descent, where each node knows
- * how far ahead to advance in the list of nodes if there is no intersection between the current
- * node AABB and the query AABB. Otherwise, the search advances by one to the next node in the list.
+ * Each WideAABBTree is traversed depth first. One traversal is performed (per particle)-(per
+ * tree)-(per image). Each step tests the query AABB against all children of a node at once, pushes
+ * the overlapping internal children onto the stack, and checks the particles in the overlapping
+ * leaves.
  */
 void NeighborListTree::traverseTree()
     {
@@ -294,59 +294,77 @@ void NeighborListTree::traverseTree()
     ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
 
     // Loop over all particles
-    for (unsigned int i = 0; i < m_pdata->getN(); ++i)
-        {
-        // read in the current position and orientation
-        const Scalar4 postype_i = h_postype.data[i];
-        const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
-        const unsigned int type_i = __scalar_as_int(postype_i.w);
-        const unsigned int body_i = h_body.data[i];
-
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t nlist_head_i = h_head_list.data[i];
-
-        unsigned int n_neigh_i = 0;
-        for (unsigned int cur_pair_type = 0; cur_pair_type < m_pdata->getNTypes();
-             ++cur_pair_type) // loop on pair types
-            {
-            // pass on empty types
-            if (!m_num_per_type[cur_pair_type])
-                continue;
+    auto build_range = [&](unsigned int first, unsigned int last, unsigned int* conditions)
+    {
+        // traversal stack, reused for all particles in the range
+        std::vector<unsigned int> node_stack;
 
-            // Check if this tree type should be excluded by r_cut(i,j) <= 0.0
-            Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_pair_type)];
-            if (r_cut <= Scalar(0.0))
-                continue;
+        for (unsigned int i = first; i < last; ++i)
+            {
+            // read in the current position and orientation
+            const Scalar4 postype_i = h_postype.data[i];
+            const vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+            const unsigned int type_i = __scalar_as_int(postype_i.w);
+            const unsigned int body_i = h_body.data[i];
+
+            const unsigned int Nmax_i = h_Nmax.data[type_i];
+            const size_t nlist_head_i = h_head_list.data[i];
+
+            unsigned int n_neigh_i = 0;
+            for (unsigned int cur_pair_type = 0; cur_pair_type < m_pdata->getNTypes();
+                 ++cur_pair_type) // loop on pair types
+                {
+                // pass on empty types
+                if (!m_num_per_type[cur_pair_type])
+                    continue;
 
-            // Determine the minimum r_cut_i (with buffer) for this particle
-            Scalar r_cut_i = r_cut + m_r_buff;
-            Scalar r_cutsq_i = r_cut_i * r_cut_i;
-            Scalar r_list_i = r_cut_i;
+                // Check if this tree type should be excluded by r_cut(i,j) <= 0.0
+                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_pair_type)];
+                if (r_cut <= Scalar(0.0))
+                    continue;
 
-            hoomd::detail::AABBTree* cur_aabb_tree = &m_aabb_trees[cur_pair_type];
+                // Determine the minimum r_cut_i (with buffer) for this particle
+                Scalar r_cut_i = r_cut + m_r_buff;
+                Scalar r_cutsq_i = r_cut_i * r_cut_i;
+                Scalar r_list_i = r_cut_i;
 
-            for (unsigned int cur_image = 0; cur_image < m_n_images;
-                 ++cur_image) // for each image vector
-                {
-                // make an AABB for the image of this particle
-                vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
-                hoomd::detail::AABB aabb = hoomd::detail::AABB(pos_i_image, r_list_i);
+                hoomd::detail::WideAABBTree* cur_aabb_tree = &m_aabb_trees[cur_pair_type];
 
-                // stackless traversal of the tree
-                for (unsigned int cur_node_idx = 0; cur_node_idx < cur_aabb_tree->getNumNodes();
-                     ++cur_node_idx)
+                for (unsigned int cur_image = 0; cur_image < m_n_images;
+                     ++cur_image) // for each image vector
                     {
-                    if (aabb.overlaps(cur_aabb_tree->getNodeAABB(cur_node_idx)))
+                    // make an AABB for the image of this particle
+                    vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+                    hoomd::detail::WideAABBQuery query(
+                        hoomd::detail::AABB(pos_i_image, r_list_i));
+
+                    // depth first traversal of the tree
+                    node_stack.clear();
+                    node_stack.push_back(0);
+                    while (!node_stack.empty())
                         {
-                        if (cur_aabb_tree->isNodeLeaf(cur_node_idx))
+                        unsigned int cur_node_idx = node_stack.back();
+                        node_stack.pop_back();
+
+                        unsigned int mask = cur_aabb_tree->overlapMask(cur_node_idx, query);
+                        for (unsigned int k = 0; k < hoomd::detail::WIDE_NODE_WIDTH; ++k)
                             {
-                            for (unsigned int cur_p = 0;
-                                 cur_p < cur_aabb_tree->getNodeNumParticles(cur_node_idx);
-                                 ++cur_p)
+                            if (!(mask & (1 << k)))
+                                continue;
+
+                            unsigned int child = cur_aabb_tree->getNodeChild(cur_node_idx, k);
+                            unsigned int n_leaf
+                                = cur_aabb_tree->getNodeChildNumParticles(cur_node_idx, k);
+                            if (n_leaf == 0)
+                                {
+                                node_stack.push_back(child);
+                                continue;
+                                }
+
+                            for (unsigned int cur_p = child; cur_p < child + n_leaf; ++cur_p)
                                 {
                                 // neighbor j
-                                unsigned int j
-                                    = cur_aabb_tree->getNodeParticleTag(cur_node_idx, cur_p);
+                                unsigned int j = cur_aabb_tree->getParticleTag(cur_p);
 
                                 // skip self-interaction always
                                 bool excluded = (i == j);
@@ -370,8 +388,8 @@ void NeighborListTree::traverseTree()
                                             if (n_neigh_i < Nmax_i)
                                                 h_nlist.data[nlist_head_i + n_neigh_i] = j;
                                             else
-                                                h_conditions.data[type_i]
-                                                    = max(h_conditions.data[type_i], n_neigh_i + 1);
+                                                conditions[type_i]
+                                                    = max(conditions[type_i], n_neigh_i + 1);
 
                                             ++n_neigh_i;
                                             }
@@ -379,17 +397,14 @@ void NeighborListTree::traverseTree()
                                     }
                                 }
                             }
-                        }
-                    else
-                        {
-                        // skip ahead
-                        cur_node_idx += cur_aabb_tree->getNodeSkip(cur_node_idx);
-                        }
-                    } // end stackless search
-                }     // end loop over images
-            }         // end loop over pair types
-        h_n_neigh.data[i] = n_neigh_i;
-        } // end loop over particles
+                        } // end tree traversal
+                    }     // end loop over images
+                }         // end loop over pair types
+            h_n_neigh.data[i] = n_neigh_i;
+            } // end loop over particles
+    };
+
+    buildNlistParticles(h_conditions.data, build_range);
     }
 
 namespace detail
@@ -2,7 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "NeighborList.h"
-#include "hoomd/AABBTree.h"
+#include "hoomd/WideAABBTree.h"
 #include <vector>
 
 /*! \file NeighborListTree.h
@@ -81,7 +81,7 @@ class PYBIND11_EXPORT NeighborListTree : public NeighborList
 
     // we use stl vectors here because these tree data structures should *never* be
     // accessed on the GPU, they were optimized for the CPU with SIMD support
-    std::vector<hoomd::detail::AABBTree> m_aabb_trees; //!< Flat array of AABB trees of all types
+    std::vector<hoomd::detail::WideAABBTree> m_aabb_trees; //!< Flat array of AABB trees of all types
     GPUVector<hoomd::detail::AABB> m_aabbs;            //!< Flat array of AABBs of all types
     std::vector<unsigned int> m_num_per_type;          //!< Total number of particles per type
     std::vector<unsigned int> m_type_head; //!< Index of first particle of each type, after sorting
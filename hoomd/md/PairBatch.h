@@ -0,0 +1,86 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_BATCH_H__
+#define __PAIR_BATCH_H__
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file PairBatch.h
+    \brief Defines the structure of arrays used by the vectorized CPU pair loop
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Number of neighbors evaluated together by the vectorized CPU pair loop
+const unsigned int pair_batch_size = 16;
+
+//! A batch of neighbor pairs stored as a structure of arrays
+/*! PotentialPair gathers up to pair_batch_size neighbors of a particle into a PairBatch and pads
+    the remaining lanes with pairs that are beyond the cutoff (rsq = 1, rcutsq = 0, typpair = 0).
+    Evaluators that implement
+
+    \code
+    static void evalForceAndEnergyBatch(detail::PairBatch& batch, const param_type* params);
+    \endcode
+
+    process all pair_batch_size lanes in one loop the compiler can vectorize. They write
+    force_divr and pair_eng for each lane and set evaluated to 1 for lanes inside the cutoff and 0
+    for all others. Results in lanes with evaluated == 0 must be 0 and must not be NaN.
+
+    Charges are not gathered, so only evaluators that do not need charges may implement
+    evalForceAndEnergyBatch.
+
+    Per-lane flags are stored as Scalar so that every array in the loop has the same vector width.
+    Evaluators should select lanes by multiplying with the mask rather than branching, which
+    compilers otherwise turn into control flow that prevents vectorization.
+*/
+struct PairBatch
+    {
+    /// Index of the type pair (into the parameter array).
+    unsigned int typpair[pair_batch_size];
+
+    /// Squared distance between the particles.
+    alignas(64) Scalar rsq[pair_batch_size];
+
+    /// Squared cutoff radius.
+    alignas(64) Scalar rcutsq[pair_batch_size];
+
+    /// 1 when the energy should be shifted to 0 at the cutoff, 0 otherwise.
+    alignas(64) Scalar energy_shift[pair_batch_size];
+
+    /// Output: force divided by r.
+    alignas(64) Scalar force_divr[pair_batch_size];
+
+    /// Output: pair energy.
+    alignas(64) Scalar pair_eng[pair_batch_size];
+
+    /// Output: 1 when the pair is inside the cutoff and was evaluated, 0 otherwise.
+    alignas(64) Scalar evaluated[pair_batch_size];
+    };
+
+//! Replace masked out lanes of a value with 1
+/*! \param value Value in the lane
+    \param mask 1 for active lanes, 0 for inactive lanes
+    \returns \a value in active lanes and 1 in inactive lanes
+
+    Use this to keep divisions and square roots in inactive lanes finite without branches.
+*/
+inline Scalar pair_batch_safe(Scalar value, Scalar mask)
+    {
+    return value * mask + (Scalar(1.0) - mask);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_BATCH_H__
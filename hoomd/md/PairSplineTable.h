@@ -0,0 +1,257 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_SPLINE_TABLE_H__
+#define __PAIR_SPLINE_TABLE_H__
+
+#include "hoomd/HOOMDMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/*! \file PairSplineTable.h
+    \brief Defines the cubic spline tables used by the tabulated CPU pair loop
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Number of intervals in each PairSplineTable
+const unsigned int pair_spline_table_size = 1024;
+
+//! Cubic spline table of the force and energy of one type pair in r^2
+/*! build() samples an isotropic pair evaluator at pair_spline_table_size + 1 knots evenly spaced
+    in r^2 on [0, r_cut^2] and interpolates the samples with clamped cubic splines. The energy
+    spline uses the exact derivative dE/d(r^2) = -force_divr / 2 at the ends of the range. The
+    force spline uses fourth order finite differences of the samples.
+
+    Interpolation errors grow quickly at short distances where the potentials diverge. build()
+    compares the splines to the evaluator at three points inside each interval and measures the
+    error relative to the larger of the exact value and the largest magnitude of the value at
+    r >= r_cut / 2. The table covers the range of intervals down from r_cut where every interval
+    meets the tolerance. eval() returns false below that range and the caller evaluates the
+    analytic form there.
+
+    The table stores the four cubic coefficients of the force and the energy of each interval next
+    to each other, so one evaluation reads two adjacent Scalar4 values.
+*/
+class PairSplineTable
+    {
+    public:
+    /// Tabulate an evaluator for one type pair
+    /*! \param param Parameters of the type pair
+        \param rcutsq Squared cutoff radius
+        \param energy_shift Passed to evalForceAndEnergy()
+        \param tolerance Largest relative error allowed in the tabulated range
+    */
+    template<class evaluator>
+    void build(const typename evaluator::param_type& param,
+               Scalar rcutsq,
+               bool energy_shift,
+               Scalar tolerance)
+        {
+        const unsigned int n = pair_spline_table_size;
+        m_rsq_min = rcutsq;
+        m_error = Scalar(0.0);
+        m_coeffs.clear();
+        if (!(rcutsq > Scalar(0.0)))
+            return;
+
+        auto sample = [&](double rsq, double& force_divr, double& pair_eng)
+        {
+            // the evaluators return 0 at r_cut, sample the limit from below instead
+            Scalar x = std::min(Scalar(rsq), std::nextafter(rcutsq, Scalar(0.0)));
+            Scalar f = Scalar(0.0);
+            Scalar e = Scalar(0.0);
+            evaluator eval(x, rcutsq, param);
+            eval.evalForceAndEnergy(f, e, energy_shift);
+            force_divr = f;
+            pair_eng = e;
+        };
+
+        // sample the knots down from r_cut until a value is not finite
+        const double h = double(rcutsq) / double(n);
+        std::vector<double> f(n + 1, 0.0);
+        std::vector<double> e(n + 1, 0.0);
+        unsigned int first = n + 1;
+        while (first > 0)
+            {
+            sample(h * (first - 1), f[first - 1], e[first - 1]);
+            if (!std::isfinite(f[first - 1]) || !std::isfinite(e[first - 1]))
+                break;
+            first--;
+            }
+
+        // the finite difference end derivatives need 5 knots
+        if (first + 4 > n)
+            return;
+
+        std::vector<double> df(n + 1, 0.0);
+        std::vector<double> de(n + 1, 0.0);
+        double df_first = (-25.0 * f[first] + 48.0 * f[first + 1] - 36.0 * f[first + 2]
+                           + 16.0 * f[first + 3] - 3.0 * f[first + 4])
+                          / (12.0 * h);
+        double df_last
+            = (25.0 * f[n] - 48.0 * f[n - 1] + 36.0 * f[n - 2] - 16.0 * f[n - 3] + 3.0 * f[n - 4])
+              / (12.0 * h);
+        solveSlopes(f, first, h, df_first, df_last, df);
+        solveSlopes(e, first, h, -0.5 * f[first], -0.5 * f[n], de);
+
+        m_coeffs.assign(2 * size_t(n), make_scalar4(0, 0, 0, 0));
+        for (unsigned int k = first; k < n; k++)
+            {
+            m_coeffs[2 * k] = hermite(f[k], f[k + 1], df[k] * h, df[k + 1] * h);
+            m_coeffs[2 * k + 1] = hermite(e[k], e[k + 1], de[k] * h, de[k + 1] * h);
+            }
+
+        // errors are relative to the scale of the values near the cutoff
+        double f_scale = std::numeric_limits<double>::min();
+        double e_scale = std::numeric_limits<double>::min();
+        for (unsigned int k = n / 4; k <= n; k++)
+            {
+            f_scale = std::max(f_scale, std::abs(f[k]));
+            e_scale = std::max(e_scale, std::abs(e[k]));
+            }
+
+        // extend the table down from r_cut while the intervals meet the tolerance
+        unsigned int valid = n;
+        double max_error = 0.0;
+        for (unsigned int k = n; k > first; k--)
+            {
+            double interval_error = 0.0;
+            for (double t : {0.25, 0.5, 0.75})
+                {
+                double f_exact, e_exact;
+                sample(h * (k - 1 + t), f_exact, e_exact);
+                Scalar f_table, e_table;
+                evalInterval(k - 1, Scalar(t), f_table, e_table);
+                double f_error = std::abs(f_table - f_exact) / std::max(std::abs(f_exact), f_scale);
+                double e_error = std::abs(e_table - e_exact) / std::max(std::abs(e_exact), e_scale);
+                interval_error = std::max({interval_error, f_error, e_error});
+                }
+
+            if (!(interval_error <= tolerance))
+                break;
+
+            valid = k - 1;
+            max_error = std::max(max_error, interval_error);
+            }
+
+        m_inv_delta = Scalar(1.0 / h);
+        m_rsq_min = valid < n ? Scalar(h * valid) : rcutsq;
+        m_error = Scalar(max_error);
+        }
+
+    /// Evaluate the force and energy from the table
+    /*! \param rsq Squared distance, less than the squared cutoff radius
+        \param force_divr Output force divided by r
+        \param pair_eng Output pair energy
+        \returns false when \a rsq is below the tabulated range
+    */
+    bool eval(Scalar rsq, Scalar& force_divr, Scalar& pair_eng) const
+        {
+        if (rsq < m_rsq_min)
+            return false;
+
+        Scalar x = rsq * m_inv_delta;
+        unsigned int k = std::min((unsigned int)x, pair_spline_table_size - 1);
+        evalInterval(k, x - Scalar(k), force_divr, pair_eng);
+        return true;
+        }
+
+    /// Get the shortest distance evaluated from the table
+    Scalar getRMin() const
+        {
+        return fast::sqrt(m_rsq_min);
+        }
+
+    /// Get the largest relative error measured in the tabulated range
+    Scalar getError() const
+        {
+        return m_error;
+        }
+
+    private:
+    /// Smallest squared distance in the tabulated range
+    Scalar m_rsq_min = std::numeric_limits<Scalar>::infinity();
+
+    Scalar m_inv_delta = Scalar(0.0); //!< Inverse of the knot spacing in r^2
+    Scalar m_error = Scalar(0.0);     //!< Largest relative error in the tabulated range
+
+    /// Coefficients of the force (even) and energy (odd) cubics of each interval
+    std::vector<Scalar4> m_coeffs;
+
+    /// Evaluate the cubics of interval \a k at \a t in [0, 1]
+    void evalInterval(unsigned int k, Scalar t, Scalar& force_divr, Scalar& pair_eng) const
+        {
+        const Scalar4& cf = m_coeffs[2 * k];
+        const Scalar4& ce = m_coeffs[2 * k + 1];
+        force_divr = ((cf.w * t + cf.z) * t + cf.y) * t + cf.x;
+        pair_eng = ((ce.w * t + ce.z) * t + ce.y) * t + ce.x;
+        }
+
+    /// Coefficients of the cubic with values \a y0, \a y1 and derivatives \a m0, \a m1 at t = 0, 1
+    static Scalar4 hermite(double y0, double y1, double m0, double m1)
+        {
+        double dy = y1 - y0;
+        return make_scalar4(Scalar(y0),
+                            Scalar(m0),
+                            Scalar(3.0 * dy - 2.0 * m0 - m1),
+                            Scalar(-2.0 * dy + m0 + m1));
+        }
+
+    /// Solve for the slopes of the clamped cubic spline through y[first], ..., y[n]
+    /*! \param y Values at the knots
+        \param first Index of the first knot
+        \param h Knot spacing
+        \param d_first Derivative at the first knot
+        \param d_last Derivative at the last knot
+        \param d Output derivatives at the knots
+    */
+    static void solveSlopes(const std::vector<double>& y,
+                            unsigned int first,
+                            double h,
+                            double d_first,
+                            double d_last,
+                            std::vector<double>& d)
+        {
+        const unsigned int n = (unsigned int)y.size() - 1;
+        d[first] = d_first;
+        d[n] = d_last;
+
+        // d[k-1] + 4 d[k] + d[k+1] = 3 (y[k+1] - y[k-1]) / h for the interior knots
+        std::vector<double> c(n + 1, 0.0);
+        double prev_c = 0.0;
+        double prev_d = d_first;
+        for (unsigned int k = first + 1; k < n; k++)
+            {
+            double rhs = 3.0 * (y[k + 1] - y[k - 1]) / h - prev_d;
+            if (k == n - 1)
+                rhs -= d_last;
+            double denom = 4.0 - prev_c;
+            c[k] = 1.0 / denom;
+            d[k] = rhs / denom;
+            prev_c = c[k];
+            prev_d = d[k];
+            }
+        for (unsigned int k = n - 2; k > first; k--)
+            {
+            d[k] -= c[k] * d[k + 1];
+            }
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_SPLINE_TABLE_H__
@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "PeriodicImproper.h"
+#include "BondedForceCompute.h"
 #include "hoomd/BondedGroupData.h"
 #include "hoomd/ForceCompute.h"
 
@@ -27,7 +28,7 @@ namespace md
     The impropers which forces are computed on are accessed from ParticleData::getimproperData
     \ingroup computes
 */
-class PYBIND11_EXPORT PeriodicImproperForceCompute : public ForceCompute
+class PYBIND11_EXPORT PeriodicImproperForceCompute : public BondedForceCompute
     {
     public:
     //! Constructs the compute
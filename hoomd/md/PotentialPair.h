@@ -4,17 +4,23 @@
 #ifndef __POTENTIAL_PAIR_H__
 #define __POTENTIAL_PAIR_H__
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <stdexcept>
+#include <type_traits>
 
 #include "NeighborList.h"
+#include "PairBatch.h"
+#include "PairSplineTable.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GlobalArray.h"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
+#include "hoomd/ThreadedAccumulation.h"
 #include "hoomd/managed_allocator.h"
 #include "hoomd/md/EvaluatorPairLJ.h"
 
@@ -26,6 +32,11 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file PotentialPair.h
     \brief Defines the template class for standard pair potentials
     \details The heart of the code that computes pair potentials is in this file.
@@ -40,6 +51,20 @@ namespace hoomd
     {
 namespace md
     {
+namespace detail
+    {
+//! Detect evaluators that implement evalForceAndEnergyBatch (see PairBatch)
+template<class evaluator, class Enable = void> struct has_batch_evaluation : std::false_type
+    {
+    };
+
+template<class evaluator>
+struct has_batch_evaluation<evaluator, std::void_t<decltype(&evaluator::evalForceAndEnergyBatch)>>
+    : std::true_type
+    {
+    };
+    } // end namespace detail
+
 //! Template class for computing pair potentials
 /*! <b>Overview:</b>
     PotentialPair computes standard pair potentials (and forces) between all particle pairs in the
@@ -72,6 +97,17 @@ namespace md
    potentials are used. Thus, the combination of XPLOR switching + shifted potentials will not be
    supported to avoid slowing down the calculation for everyone.
 
+    <b>Tabulation</b>
+
+    When the tabulation tolerance is positive, the CPU pair loop evaluates the force and energy of
+   each type pair from a cubic spline table in r^2 (see detail::PairSplineTable) instead of calling
+   the evaluator. This is faster for evaluators that call exp, pow, or erfc. The tables are rebuilt
+   on the next force computation after any change of the parameters, cutoffs, or shift mode. Each
+   table covers the range down from r_cut where the interpolation meets the tolerance, and the
+   evaluator computes the shorter distances. XPLOR switching is applied to the tabulated values.
+   Evaluators that need charges cannot be tabulated. Derived classes that override computeForces()
+   (such as PotentialPairGPU) ignore the tolerance.
+
     <b>Implementation details</b>
 
     rcutsq, ronsq, and the params are stored per particle type pair. It wastes a little bit of
@@ -124,6 +160,7 @@ template<class evaluator> class PotentialPair : public ForceCompute
     void setShiftMode(energyShiftMode mode)
         {
         m_shift_mode = mode;
+        m_tables_dirty = true;
         }
 
     void setShiftModePython(std::string mode)
@@ -144,6 +181,7 @@ template<class evaluator> class PotentialPair : public ForceCompute
             {
             throw std::runtime_error("Invalid energy shift mode.");
             }
+        m_tables_dirty = true;
         }
 
     /// Get the mode used for the energy shifting
@@ -182,9 +220,30 @@ template<class evaluator> class PotentialPair : public ForceCompute
         return m_tail_correction_enabled;
         }
 
+    /// Set the relative error tolerance of the tabulated evaluation (0 evaluates the analytic form)
+    void setTabulationTolerance(Scalar tolerance);
+
+    /// Get the relative error tolerance of the tabulated evaluation
+    Scalar getTabulationTolerance()
+        {
+        return m_tabulation_tolerance;
+        }
+
+    /// Get the tabulated range and measured error for a single type pair
+    pybind11::dict getTabulationAccuracy(pybind11::tuple types);
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
+
+    /// The CPU pair loop can compute the interior forces during the ghost update
+    virtual bool canComputeInteriorForces()
+        {
+        return true;
+        }
+
+    //! Compute the forces on particles that have no ghost neighbors
+    virtual void computeInteriorForces(uint64_t timestep);
 #endif
 
     //! Calculates the energy between two lists of particles.
@@ -222,6 +281,12 @@ template<class evaluator> class PotentialPair : public ForceCompute
     /// Check if autotuning is complete.
     virtual bool isAutotuningComplete();
 
+    /// The CPU pair loop can add directly to the net force
+    virtual bool canAccumulateNetForce()
+        {
+        return true;
+        }
+
     protected:
     std::shared_ptr<NeighborList> m_nlist; //!< The neighborlist to use for the computation
     energyShiftMode m_shift_mode; //!< Store the mode with which to handle the energy shift at r_cut
@@ -242,14 +307,58 @@ template<class evaluator> class PotentialPair : public ForceCompute
     /// Keep track of number of each type of particle
     std::vector<unsigned int> m_num_particles_by_type;
 
+    /// Relative error tolerance of the tabulated evaluation, 0 to evaluate the analytic form
+    Scalar m_tabulation_tolerance = Scalar(0.0);
+
+    /// Spline tables per type pair (valid when m_tables_dirty is false)
+    std::vector<detail::PairSplineTable> m_tables;
+
+    /// Set when the parameters change and the tables need to be rebuilt
+    bool m_tables_dirty = true;
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
 #endif
 
+    /// Subsets of the local particles evaluated by computePairForces
+    enum pairForcePass
+        {
+        all_particles,      //!< All local particles
+        interior_particles, //!< Particles with no ghost neighbors
+        boundary_particles  //!< Particles with at least one ghost neighbor
+        };
+
+    /// 1 for local particles with a ghost neighbor, 0 otherwise (valid for m_boundary_nlist_updates)
+    std::vector<unsigned char> m_boundary;
+
+    /// Number of neighbor list updates when m_boundary was determined
+    uint64_t m_boundary_nlist_updates = 0;
+
+    /// True when m_force and m_virial hold the interior forces for m_interior_timestep
+    bool m_interior_computed = false;
+
+    /// Time step of the interior forces
+    uint64_t m_interior_timestep = 0;
+
+    /// Number of neighbor list updates when the interior forces were computed
+    uint64_t m_interior_nlist_updates = 0;
+
+    /// Particle data flags when the interior forces were computed
+    PDataFlags m_interior_flags;
+
+    /// Per-thread force buffers used with a half neighbor list
+    hoomd::detail::ThreadedForceAccumulator m_force_accumulator;
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
 
+    //! Evaluate the pair forces on a subset of the local particles
+    void computePairForces(pairForcePass pass);
+
+    /// Tabulate the evaluator for all type pairs
+    void updateTables();
+
     //! Compute the long-range corrections to energy and pressure to account for truncating the pair
     //! potentials
     virtual void computeTailCorrection()
@@ -471,6 +580,7 @@ void PotentialPair<evaluator>::setParams(unsigned int typ1,
     validateTypes(typ1, typ2, "setting params");
     m_params[m_typpair_idx(typ1, typ2)] = param;
     m_params[m_typpair_idx(typ2, typ1)] = param;
+    m_tables_dirty = true;
     }
 
 template<class evaluator>
@@ -528,6 +638,7 @@ void PotentialPair<evaluator>::setRcut(unsigned int typ1, unsigned int typ2, Sca
 
     // notify the neighbor list that we have changed r_cut values
     m_nlist->notifyRCutMatrixChange();
+    m_tables_dirty = true;
     }
 
 template<class evaluator>
@@ -560,6 +671,7 @@ void PotentialPair<evaluator>::setRon(unsigned int typ1, unsigned int typ2, Scal
     ArrayHandle<Scalar> h_ronsq(m_ronsq, access_location::host, access_mode::readwrite);
     h_ronsq.data[m_typpair_idx(typ1, typ2)] = ron * ron;
     h_ronsq.data[m_typpair_idx(typ2, typ1)] = ron * ron;
+    m_tables_dirty = true;
     }
 
 template<class evaluator> Scalar PotentialPair<evaluator>::getROn(pybind11::tuple types)
@@ -579,9 +691,102 @@ void PotentialPair<evaluator>::setROnPython(pybind11::tuple types, Scalar r_on)
     setRon(typ1, typ2, r_on);
     }
 
+/*! \param tolerance Largest relative error of the tabulated force and energy, 0 to evaluate the
+    analytic form
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::setTabulationTolerance(Scalar tolerance)
+    {
+    if (!(tolerance >= Scalar(0.0)))
+        {
+        throw std::invalid_argument("tabulation_tolerance must be non-negative");
+        }
+    if (tolerance > Scalar(0.0) && evaluator::needsCharge())
+        {
+        throw std::invalid_argument(evaluator::getName()
+                                    + " depends on the particle charges and cannot be tabulated");
+        }
+    m_tabulation_tolerance = tolerance;
+    m_tables_dirty = true;
+    }
+
+/*! \param types Type pair
+    \returns A dict with the shortest distance evaluated from the table (r_min) and the largest
+    relative error measured in the tabulated range (error). r_min is r_cut when nothing is
+    tabulated.
+*/
+template<class evaluator>
+pybind11::dict PotentialPair<evaluator>::getTabulationAccuracy(pybind11::tuple types)
+    {
+    auto typ1 = m_pdata->getTypeByName(types[0].cast<std::string>());
+    auto typ2 = m_pdata->getTypeByName(types[1].cast<std::string>());
+    validateTypes(typ1, typ2, "getting tabulation accuracy");
+
+    pybind11::dict result;
+    if (m_tabulation_tolerance > Scalar(0.0))
+        {
+        if (m_tables_dirty)
+            {
+            updateTables();
+            }
+        const detail::PairSplineTable& table = m_tables[m_typpair_idx(typ1, typ2)];
+        result["r_min"] = table.getRMin();
+        result["error"] = table.getError();
+        }
+    else
+        {
+        ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+        result["r_min"] = sqrt(h_rcutsq.data[m_typpair_idx(typ1, typ2)]);
+        result["error"] = Scalar(0.0);
+        }
+    return result;
+    }
+
+/*! Sample the evaluator of each type pair with the current parameters, cutoff, and energy shift
+    into a PairSplineTable.
+*/
+template<class evaluator> void PotentialPair<evaluator>::updateTables()
+    {
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_ronsq(m_ronsq, access_location::host, access_mode::read);
+
+    const unsigned int n_types = m_pdata->getNTypes();
+    m_tables.resize(m_typpair_idx.getNumElements());
+    for (unsigned int typ1 = 0; typ1 < n_types; typ1++)
+        {
+        for (unsigned int typ2 = typ1; typ2 < n_types; typ2++)
+            {
+            const unsigned int typpair_idx = m_typpair_idx(typ1, typ2);
+            const Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+            // the same energy shift as in computePairForces()
+            const bool energy_shift
+                = m_shift_mode == shift
+                  || (m_shift_mode == xplor && h_ronsq.data[typpair_idx] > rcutsq);
+
+            detail::PairSplineTable& table = m_tables[typpair_idx];
+            table.template build<evaluator>(m_params[typpair_idx],
+                                            rcutsq,
+                                            energy_shift,
+                                            m_tabulation_tolerance);
+            m_tables[m_typpair_idx(typ2, typ1)] = table;
+
+            m_exec_conf->msg->notice(6)
+                << "PotentialPair<" << evaluator::getName() << ">: tabulated (" << typ1 << ", "
+                << typ2 << ") for r >= " << table.getRMin() << " with relative error "
+                << table.getError() << std::endl;
+            }
+        }
+
+    m_tables_dirty = false;
+    }
+
 /*! \post The pair forces are computed for the given timestep. The neighborlist's compute method is
    called to ensure that it is up to date before proceeding.
 
+    When computeInteriorForces() computed the forces on the interior particles at this time step
+    and nothing has changed since, only the boundary particles remain to be evaluated.
+
     \param timestep specifies the current time step of the simulation
 */
 template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t timestep)
@@ -589,6 +794,113 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     // start by updating the neighborlist
     m_nlist->compute(timestep);
 
+    bool interior_current = m_interior_computed && m_interior_timestep == timestep
+                            && m_interior_nlist_updates == m_nlist->getNumUpdates()
+                            && m_interior_flags == m_pdata->getFlags() && !m_accumulate_net_force;
+    m_interior_computed = false;
+
+    if (interior_current)
+        {
+        computePairForces(boundary_particles);
+        }
+    else
+        {
+        computePairForces(all_particles);
+        }
+
+    computeTailCorrection();
+    }
+
+#ifdef ENABLE_MPI
+/*! Evaluate the pair forces on the particles whose neighbors are all local while the Communicator
+    updates the ghost positions. With a half neighbor list, each pair is stored with only one of its
+    particles, so the interior and boundary passes together evaluate every pair exactly once. The
+    order of the floating point additions differs from a single pass.
+
+    The interior forces use the neighbor list from a previous step. When the neighbor list needs
+    to be rebuilt at this step, the rebuild requires the ghost positions and computeForces()
+    evaluates all particles instead.
+
+    \param timestep Current time step
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::computeInteriorForces(uint64_t timestep)
+    {
+    m_interior_computed = false;
+
+    // only compute when compute() will call computeForces() at this step
+    if (!peekCompute(timestep) || m_nlist->peekUpdate(timestep))
+        return;
+
+    int64_t start = m_clk.getTime();
+
+    // mark the particles that have ghost neighbors when the neighbor list changes
+    const unsigned int N = m_pdata->getN();
+    if (m_boundary.size() != N || m_boundary_nlist_updates != m_nlist->getNumUpdates())
+        {
+        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                        access_location::host,
+                                        access_mode::read);
+
+        m_boundary.resize(N);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const size_t head = h_head_list.data[i];
+            unsigned char boundary = 0;
+            for (unsigned int k = 0; k < h_n_neigh.data[i]; k++)
+                {
+                if (h_nlist.data[head + k] >= N)
+                    {
+                    boundary = 1;
+                    break;
+                    }
+                }
+            m_boundary[i] = boundary;
+            }
+        m_boundary_nlist_updates = m_nlist->getNumUpdates();
+        }
+
+    computePairForces(interior_particles);
+
+    m_interior_computed = true;
+    m_interior_timestep = timestep;
+    m_interior_nlist_updates = m_nlist->getNumUpdates();
+    m_interior_flags = m_pdata->getFlags();
+
+    m_sysdef->addForceComputeTime(m_clk.getTime() - start);
+    }
+#endif
+
+/*! \param pass Subset of the local particles to evaluate
+
+    The interior and all particle passes start from zero forces. The boundary pass adds to the
+    forces computed by the interior pass.
+
+    When HOOMD is built with TBB and more than one CPU thread is requested, the particle loop is
+    split over the threads. With a full neighbor list each thread writes only the forces of its own
+    particles. With a half neighbor list, a particle also writes to its neighbors, so
+    detail::ThreadedForceAccumulator buffers each thread's forces over the range of particles that
+    its chunk and their neighbors span.
+*/
+template<class evaluator> void PotentialPair<evaluator>::computePairForces(pairForcePass pass)
+    {
+    // rebuild the spline tables after parameter changes
+    const detail::PairSplineTable* tables = nullptr;
+    if (m_tabulation_tolerance > Scalar(0.0))
+        {
+        if (m_tables_dirty)
+            {
+            updateTables();
+            }
+        tables = m_tables.data();
+        }
+
     // depending on the neighborlist settings, we can take advantage of newton's third law
     // to reduce computations at the cost of memory access complexity: set that flag now
     bool third_law = m_nlist->getStorageMode() == NeighborList::half;
@@ -608,9 +920,17 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
 
-    // force arrays
-    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
-    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+    // force arrays: this force's own arrays, or the net force when the Integrator fuses the sum
+    const GlobalArray<Scalar4>& force_array
+        = m_accumulate_net_force ? m_pdata->getNetForce() : m_force;
+    const GlobalArray<Scalar>& virial_array
+        = m_accumulate_net_force ? m_pdata->getNetVirial() : m_virial;
+    const access_mode::Enum output_mode = (m_accumulate_net_force || pass == boundary_particles)
+                                              ? access_mode::readwrite
+                                              : access_mode::overwrite;
+    ArrayHandle<Scalar4> h_force(force_array, access_location::host, output_mode);
+    ArrayHandle<Scalar> h_virial(virial_array, access_location::host, output_mode);
+    const size_t output_virial_pitch = virial_array.getPitch();
 
     const BoxDim box = m_pdata->getGlobalBox();
     ArrayHandle<Scalar> h_ronsq(m_ronsq, access_location::host, access_mode::read);
@@ -619,94 +939,65 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     PDataFlags flags = this->m_pdata->getFlags();
     bool compute_virial = flags[pdata_flag::pressure_tensor];
 
-    // need to start from a zero force, energy and virial
-    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
-    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
-
-    // for each particle
-    for (int i = 0; i < (int)m_pdata->getN(); i++)
+    // need to start from a zero force, energy and virial (the Integrator zeroes the net force)
+    if (!m_accumulate_net_force && pass != boundary_particles)
         {
-        // access the particle's position and type (MEM TRANSFER: 4 scalars)
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+        memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        }
 
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
+    const unsigned int N = m_pdata->getN();
 
-        // access charge (if needed)
-        Scalar qi = Scalar(0.0);
-        if (evaluator::needsCharge())
-            qi = h_charge.data[i];
+    // 1 for the particles to skip in this pass
+    const unsigned char skip_value = (pass == interior_particles) ? 1 : 0;
+    const unsigned char* skip = (pass == all_particles) ? nullptr : m_boundary.data();
 
-        // initialize current particle force, potential energy, and virial to 0
-        Scalar3 fi = make_scalar3(0, 0, 0);
-        Scalar pei = 0.0;
-        Scalar virialxxi = 0.0;
-        Scalar virialxyi = 0.0;
-        Scalar virialxzi = 0.0;
-        Scalar virialyyi = 0.0;
-        Scalar virialyzi = 0.0;
-        Scalar virialzzi = 0.0;
-
-        // loop over all of the neighbors of this particle
-        const size_t myHead = h_head_list.data[i];
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int k = 0; k < size; k++)
+    // accumulate the pair forces on particles [first, last) into the given force and virial arrays,
+    // which start at particle index offset
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch,
+                             unsigned int offset)
+    {
+        // for each particle
+        for (unsigned int i = first; i < last; i++)
             {
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int j = h_nlist.data[myHead + k];
-            assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+            if (skip && skip[i] == skip_value)
+                continue;
 
-            // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-            Scalar3 dx = pi - pj;
+            // access the particle's position and type (MEM TRANSFER: 4 scalars)
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
 
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-            assert(typej < m_pdata->getNTypes());
+            // sanity check
+            assert(typei < m_pdata->getNTypes());
 
             // access charge (if needed)
-            Scalar qj = Scalar(0.0);
-            if (evaluator::needsCharge())
-                qj = h_charge.data[j];
-
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
-
-            // calculate r_ij squared (FLOPS: 5)
-            Scalar rsq = dot(dx, dx);
-
-            // get parameters for this type pair
-            unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            const param_type& param = m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-            Scalar ronsq = Scalar(0.0);
-            if (m_shift_mode == xplor)
-                ronsq = h_ronsq.data[typpair_idx];
-
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            // or 2) shift mode is explor and ron > rcut
-            bool energy_shift = false;
-            if (m_shift_mode == shift)
-                energy_shift = true;
-            else if (m_shift_mode == xplor)
-                {
-                if (ronsq > rcutsq)
-                    energy_shift = true;
-                }
-
-            // compute the force and potential energy
-            Scalar force_divr = Scalar(0.0);
-            Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
+            Scalar qi = Scalar(0.0);
             if (evaluator::needsCharge())
-                eval.setCharge(qi, qj);
-
-            bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
-
-            if (evaluated)
-                {
+                qi = h_charge.data[i];
+
+            // initialize current particle force, potential energy, and virial to 0
+            Scalar3 fi = make_scalar3(0, 0, 0);
+            Scalar pei = 0.0;
+            Scalar virialxxi = 0.0;
+            Scalar virialxyi = 0.0;
+            Scalar virialxzi = 0.0;
+            Scalar virialyyi = 0.0;
+            Scalar virialyzi = 0.0;
+            Scalar virialzzi = 0.0;
+
+            // add the force, energy and virial of the pair (i, j) to the accumulators
+            auto accumulate_pair = [&](unsigned int j,
+                                       const Scalar3& dx,
+                                       Scalar rsq,
+                                       Scalar rcutsq,
+                                       Scalar ronsq,
+                                       Scalar force_divr,
+                                       Scalar pair_eng)
+            {
                 // modify the potential for xplor shifting
                 if (m_shift_mode == xplor)
                     {
@@ -730,8 +1021,8 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
                         // make modifications to the old pair energy and force
                         pair_eng = old_pair_eng * s;
-                        // note: I'm not sure why the minus sign needs to be there: my notes have a
-                        // + But this is verified correct via plotting
+                        // note: I'm not sure why the minus sign needs to be there: my notes
+                        // have a + But this is verified correct via plotting
                         force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
                         }
                     }
@@ -753,44 +1044,309 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
                 // add the force to particle j if we are using the third law (MEM TRANSFER: 10
                 // scalars / FLOPS: 8) only add force to local particles
-                if (third_law && j < m_pdata->getN())
+                if (third_law && j < N)
                     {
-                    unsigned int mem_idx = j;
-                    h_force.data[mem_idx].x -= dx.x * force_divr;
-                    h_force.data[mem_idx].y -= dx.y * force_divr;
-                    h_force.data[mem_idx].z -= dx.z * force_divr;
-                    h_force.data[mem_idx].w += pair_eng * Scalar(0.5);
+                    unsigned int mem_idx = j - offset;
+                    force[mem_idx].x -= dx.x * force_divr;
+                    force[mem_idx].y -= dx.y * force_divr;
+                    force[mem_idx].z -= dx.z * force_divr;
+                    force[mem_idx].w += pair_eng * Scalar(0.5);
                     if (compute_virial)
                         {
-                        h_virial.data[0 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
-                        h_virial.data[1 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
-                        h_virial.data[2 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
-                        h_virial.data[3 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
-                        h_virial.data[4 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
-                        h_virial.data[5 * m_virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
+                        virial[0 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
+                        virial[1 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
+                        virial[2 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
+                        virial[3 * virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
+                        virial[4 * virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
+                        virial[5 * virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
+                        }
+                    }
+            };
+
+            // design specifies that energies are shifted if
+            // 1) shift mode is set to shift
+            // or 2) shift mode is explor and ron > rcut
+            auto needs_energy_shift = [&](Scalar rcutsq, Scalar ronsq)
+            {
+                if (m_shift_mode == shift)
+                    return true;
+                else if (m_shift_mode == xplor)
+                    return ronsq > rcutsq;
+                return false;
+            };
+
+            // loop over all of the neighbors of this particle
+            const size_t myHead = h_head_list.data[i];
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+
+            if (tables)
+                {
+                // evaluate the pairs from the spline tables, and call the evaluator below the
+                // tabulated range (tabulated evaluators do not need charges)
+                unsigned int cur_typej = std::numeric_limits<unsigned int>::max();
+                const param_type* param = nullptr;
+                const detail::PairSplineTable* table = nullptr;
+                Scalar rcutsq = Scalar(0.0);
+                Scalar ronsq = Scalar(0.0);
+                bool energy_shift = false;
+
+                for (unsigned int k = 0; k < size; k++)
+                    {
+                    // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                    unsigned int j = h_nlist.data[myHead + k];
+                    assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                    // calculate dr_ji and apply periodic boundary conditions
+                    Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                    Scalar3 dx = box.minImage(pi - pj);
+                    Scalar rsq = dot(dx, dx);
+
+                    // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                    unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                    assert(typej < m_pdata->getNTypes());
+
+                    // get parameters for this type pair
+                    if (typej != cur_typej)
+                        {
+                        unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                        param = &m_params[typpair_idx];
+                        table = &tables[typpair_idx];
+                        rcutsq = h_rcutsq.data[typpair_idx];
+                        ronsq = Scalar(0.0);
+                        if (m_shift_mode == xplor)
+                            ronsq = h_ronsq.data[typpair_idx];
+
+                        energy_shift = needs_energy_shift(rcutsq, ronsq);
+                        cur_typej = typej;
+                        }
+
+                    if (rsq >= rcutsq)
+                        continue;
+
+                    Scalar force_divr = Scalar(0.0);
+                    Scalar pair_eng = Scalar(0.0);
+                    bool evaluated = table->eval(rsq, force_divr, pair_eng);
+                    if (!evaluated)
+                        {
+                        evaluator eval(rsq, rcutsq, *param);
+                        evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+                        }
+
+                    if (evaluated)
+                        {
+                        accumulate_pair(j, dx, rsq, rcutsq, ronsq, force_divr, pair_eng);
+                        }
+                    }
+                }
+            else if constexpr (detail::has_batch_evaluation<evaluator>::value)
+                {
+                // Process the neighbors in batches. Gather the pair geometry, evaluate all lanes of
+                // the batch in the evaluator's vectorized loop, then accumulate the forces in
+                // neighbor list order.
+                constexpr unsigned int batch_size = detail::pair_batch_size;
+                detail::PairBatch batch;
+                unsigned int b_j[batch_size];
+                Scalar3 b_dx[batch_size];
+                Scalar b_ronsq[batch_size];
+
+                for (unsigned int k_first = 0; k_first < size; k_first += batch_size)
+                    {
+                    const unsigned int n_batch = std::min(batch_size, size - k_first);
+
+                    for (unsigned int b = 0; b < n_batch; b++)
+                        {
+                        // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                        unsigned int j = h_nlist.data[myHead + k_first + b];
+                        assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                        // calculate dr_ji and apply periodic boundary conditions
+                        Scalar3 pj
+                            = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                        Scalar3 dx = box.minImage(pi - pj);
+
+                        // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                        unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                        assert(typej < m_pdata->getNTypes());
+
+                        unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                        b_j[b] = j;
+                        b_dx[b] = dx;
+                        b_ronsq[b] = Scalar(0.0);
+                        if (m_shift_mode == xplor)
+                            b_ronsq[b] = h_ronsq.data[typpair_idx];
+
+                        batch.typpair[b] = typpair_idx;
+                        batch.rsq[b] = dot(dx, dx);
+                        batch.rcutsq[b] = h_rcutsq.data[typpair_idx];
+                        batch.energy_shift[b]
+                            = needs_energy_shift(batch.rcutsq[b], b_ronsq[b]) ? Scalar(1.0)
+                                                                              : Scalar(0.0);
+                        }
+
+                    // pad the batch with pairs beyond the cutoff
+                    for (unsigned int b = n_batch; b < batch_size; b++)
+                        {
+                        batch.typpair[b] = 0;
+                        batch.rsq[b] = Scalar(1.0);
+                        batch.rcutsq[b] = Scalar(0.0);
+                        batch.energy_shift[b] = Scalar(0.0);
+                        }
+
+                    evaluator::evalForceAndEnergyBatch(batch, m_params.data());
+
+                    for (unsigned int b = 0; b < n_batch; b++)
+                        {
+                        if (batch.evaluated[b] != Scalar(0.0))
+                            {
+                            accumulate_pair(b_j[b],
+                                            b_dx[b],
+                                            batch.rsq[b],
+                                            batch.rcutsq[b],
+                                            b_ronsq[b],
+                                            batch.force_divr[b],
+                                            batch.pair_eng[b]);
+                            }
                         }
                     }
                 }
+            else
+                {
+                // parameters of the current neighbor type, reused over runs of neighbors with the
+                // same type (see NeighborList::setSortMode())
+                unsigned int cur_typej = std::numeric_limits<unsigned int>::max();
+                const param_type* param = nullptr;
+                Scalar rcutsq = Scalar(0.0);
+                Scalar ronsq = Scalar(0.0);
+                bool energy_shift = false;
+
+                for (unsigned int k = 0; k < size; k++)
+                    {
+                    // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                    unsigned int j = h_nlist.data[myHead + k];
+                    assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                    // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                    Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                    Scalar3 dx = pi - pj;
+
+                    // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                    unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                    assert(typej < m_pdata->getNTypes());
+
+                    // access charge (if needed)
+                    Scalar qj = Scalar(0.0);
+                    if (evaluator::needsCharge())
+                        qj = h_charge.data[j];
+
+                    // apply periodic boundary conditions
+                    dx = box.minImage(dx);
+
+                    // calculate r_ij squared (FLOPS: 5)
+                    Scalar rsq = dot(dx, dx);
+
+                    // get parameters for this type pair
+                    if (typej != cur_typej)
+                        {
+                        unsigned int typpair_idx = m_typpair_idx(typei, typej);
+                        param = &m_params[typpair_idx];
+                        rcutsq = h_rcutsq.data[typpair_idx];
+                        ronsq = Scalar(0.0);
+                        if (m_shift_mode == xplor)
+                            ronsq = h_ronsq.data[typpair_idx];
+
+                        energy_shift = needs_energy_shift(rcutsq, ronsq);
+                        cur_typej = typej;
+                        }
+
+                    // compute the force and potential energy
+                    Scalar force_divr = Scalar(0.0);
+                    Scalar pair_eng = Scalar(0.0);
+                    evaluator eval(rsq, rcutsq, *param);
+                    if (evaluator::needsCharge())
+                        eval.setCharge(qi, qj);
+
+                    bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+                    if (evaluated)
+                        {
+                        accumulate_pair(j, dx, rsq, rcutsq, ronsq, force_divr, pair_eng);
+                        }
+                    }
+                }
+
+            // finally, increment the force, potential energy and virial for particle i
+            unsigned int mem_idx = i - offset;
+            force[mem_idx].x += fi.x;
+            force[mem_idx].y += fi.y;
+            force[mem_idx].z += fi.z;
+            force[mem_idx].w += pei;
+            if (compute_virial)
+                {
+                virial[0 * virial_pitch + mem_idx] += virialxxi;
+                virial[1 * virial_pitch + mem_idx] += virialxyi;
+                virial[2 * virial_pitch + mem_idx] += virialxzi;
+                virial[3 * virial_pitch + mem_idx] += virialyyi;
+                virial[4 * virial_pitch + mem_idx] += virialyzi;
+                virial[5 * virial_pitch + mem_idx] += virialzzi;
+                }
             }
+    };
 
-        // finally, increment the force, potential energy and virial for particle i
-        unsigned int mem_idx = i;
-        h_force.data[mem_idx].x += fi.x;
-        h_force.data[mem_idx].y += fi.y;
-        h_force.data[mem_idx].z += fi.z;
-        h_force.data[mem_idx].w += pei;
-        if (compute_virial)
+    Scalar* virial = compute_virial ? h_virial.data : nullptr;
+#ifdef ENABLE_TBB
+    if (!third_law && m_exec_conf->getNumThreads() > 1)
+        {
+        // with a full neighbor list, each particle writes only to its own force and virial
+        m_exec_conf->getTaskArena()->execute(
+            [&]
             {
-            h_virial.data[0 * m_virial_pitch + mem_idx] += virialxxi;
-            h_virial.data[1 * m_virial_pitch + mem_idx] += virialxyi;
-            h_virial.data[2 * m_virial_pitch + mem_idx] += virialxzi;
-            h_virial.data[3 * m_virial_pitch + mem_idx] += virialyyi;
-            h_virial.data[4 * m_virial_pitch + mem_idx] += virialyzi;
-            h_virial.data[5 * m_virial_pitch + mem_idx] += virialzzi;
-            }
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      compute_range(r.begin(),
+                                                    r.end(),
+                                                    h_force.data,
+                                                    virial,
+                                                    output_virial_pitch,
+                                                    0);
+                                  });
+            });
+        return;
         }
+#endif
 
-    computeTailCorrection();
+    // with a half neighbor list, particles [first, last) also write to their neighbors j < N
+    auto window = [&](unsigned int first, unsigned int last)
+    {
+        unsigned int lo = first;
+        unsigned int hi = last;
+        if (third_law)
+            {
+            for (unsigned int i = first; i < last; i++)
+                {
+                const size_t head_i = h_head_list.data[i];
+                for (unsigned int k = 0; k < h_n_neigh.data[i]; k++)
+                    {
+                    unsigned int j = h_nlist.data[head_i + k];
+                    if (j < N)
+                        {
+                        lo = std::min(lo, j);
+                        hi = std::max(hi, j + 1);
+                        }
+                    }
+                }
+            }
+        return std::make_pair(lo, hi);
+    };
+
+    m_force_accumulator.compute(*m_exec_conf,
+                                N,
+                                N,
+                                h_force.data,
+                                virial,
+                                output_virial_pitch,
+                                window,
+                                compute_range);
     }
 
 #ifdef ENABLE_MPI
@@ -1032,6 +1588,10 @@ template<class T> void export_PotentialPair(pybind11::module& m, const std::stri
         .def_property("tail_correction",
                       &PotentialPair<T>::getTailCorrectionEnabled,
                       &PotentialPair<T>::setTailCorrectionEnabled)
+        .def_property("tabulation_tolerance",
+                      &PotentialPair<T>::getTabulationTolerance,
+                      &PotentialPair<T>::setTabulationTolerance)
+        .def("getTabulationAccuracy", &PotentialPair<T>::getTabulationAccuracy)
         .def("computeEnergyBetweenSets", &PotentialPair<T>::computeEnergyBetweenSetsPythonList);
     }
 
@@ -57,6 +57,20 @@ class PotentialPairAlchemical : public PotentialPair<evaluator>
     //! Destructor
     virtual ~PotentialPairAlchemical();
 
+    //! This computeForces overwrites m_force and m_virial
+    virtual bool canAccumulateNetForce()
+        {
+        return false;
+        }
+
+#ifdef ENABLE_MPI
+    //! This computeForces evaluates all particles
+    virtual bool canComputeInteriorForces()
+        {
+        return false;
+        }
+#endif
+
     std::shared_ptr<alpha_particle_type> getAlchemicalPairParticle(pybind11::tuple types,
                                                                    std::string param_name)
         {
@@ -53,6 +53,20 @@ template<class evaluator> class PotentialPairDPDThermo : public PotentialPair<ev
     //! Destructor
     virtual ~PotentialPairDPDThermo() {};
 
+    //! This computeForces overwrites m_force and m_virial
+    virtual bool canAccumulateNetForce()
+        {
+        return false;
+        }
+
+#ifdef ENABLE_MPI
+    //! This computeForces evaluates all particles
+    virtual bool canComputeInteriorForces()
+        {
+        return false;
+        }
+#endif
+
     //! Set the temperature
     virtual void setT(std::shared_ptr<Variant> T);
 
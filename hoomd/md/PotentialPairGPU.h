@@ -51,6 +51,20 @@ template<class evaluator> class PotentialPairGPU : public PotentialPair<evaluato
     //! Destructor
     virtual ~PotentialPairGPU() { }
 
+    //! The GPU kernels overwrite m_force and m_virial
+    virtual bool canAccumulateNetForce()
+        {
+        return false;
+        }
+
+#ifdef ENABLE_MPI
+    //! The GPU kernels evaluate all particles
+    virtual bool canComputeInteriorForces()
+        {
+        return false;
+        }
+#endif
+
     protected:
     std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
 
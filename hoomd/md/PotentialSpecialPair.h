@@ -1,9 +1,11 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "BondedForceCompute.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GPUArray.h"
 #include <memory>
+#include <sstream>
 
 #include <vector>
 
@@ -31,7 +33,7 @@ namespace md
 
     \ingroup computes
 */
-template<class evaluator> class PotentialSpecialPair : public ForceCompute
+template<class evaluator> class PotentialSpecialPair : public BondedForceCompute
     {
     public:
     //! Param type from evaluator
@@ -77,7 +79,7 @@ template<class evaluator> class PotentialSpecialPair : public ForceCompute
  */
 template<class evaluator>
 PotentialSpecialPair<evaluator>::PotentialSpecialPair(std::shared_ptr<SystemDefinition> sysdef)
-    : ForceCompute(sysdef)
+    : BondedForceCompute(sysdef)
     {
     m_exec_conf->msg->notice(5) << "Constructing PotentialSpecialPair<" << evaluator::getName()
                                 << ">" << std::endl;
@@ -211,10 +213,6 @@ template<class evaluator> void PotentialSpecialPair<evaluator>::computeForces(ui
     PDataFlags flags = this->m_pdata->getFlags();
     bool compute_virial = flags[pdata_flag::pressure_tensor];
 
-    Scalar bond_virial[6];
-    for (unsigned int i = 0; i < 6; i++)
-        bond_virial[i] = Scalar(0.0);
-
     ArrayHandle<typename PairData::members_t> h_bonds(m_pair_data->getMembersArray(),
                                                       access_location::host,
                                                       access_mode::read);
@@ -226,110 +224,126 @@ template<class evaluator> void PotentialSpecialPair<evaluator>::computeForces(ui
 
     // for each of the bonds
     const unsigned int size = (unsigned int)m_pair_data->getN();
-    for (unsigned int i = 0; i < size; i++)
-        {
-        // lookup the tag of each of the particles participating in the bond
-        const typename PairData::members_t& bond = h_bonds.data[i];
-        assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
-        assert(bond.tag[1] < m_pdata->getMaximumTag() + 1);
-
-        // transform a and b into indices into the particle data arrays
-        // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[bond.tag[0]];
-        unsigned int idx_b = h_rtag.data[bond.tag[1]];
-
-        // throw an error if this bond is incomplete
-        if (idx_a >= max_local || idx_b >= max_local)
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch,
+                             unsigned int offset)
+    {
+        for (unsigned int i = first; i < last; i++)
             {
-            this->m_exec_conf->msg->error()
-                << "special_pair." << evaluator::getName() << ": bond " << bond.tag[0] << " "
-                << bond.tag[1] << " incomplete." << std::endl
-                << std::endl;
-            throw std::runtime_error("Error in bond calculation");
-            }
+            // lookup the tag of each of the particles participating in the bond
+            const typename PairData::members_t& bond = h_bonds.data[i];
+            assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
+            assert(bond.tag[1] < m_pdata->getMaximumTag() + 1);
+
+            // transform a and b into indices into the particle data arrays
+            // (MEM TRANSFER: 4 integers)
+            unsigned int idx_a = h_rtag.data[bond.tag[0]];
+            unsigned int idx_b = h_rtag.data[bond.tag[1]];
+
+            // throw an error if this bond is incomplete
+            if (idx_a >= max_local || idx_b >= max_local)
+                {
+                std::ostringstream s;
+                s << "special_pair." << evaluator::getName() << ": bond " << bond.tag[0] << " "
+                  << bond.tag[1] << " incomplete.";
+                throw std::runtime_error(s.str());
+                }
 
-        // calculate d\vec{r}
-        // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
-        Scalar3 posa = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
-        Scalar3 posb = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
+            // calculate d\vec{r}
+            // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
+            Scalar3 posa
+                = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
+            Scalar3 posb
+                = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
 
-        Scalar3 dx = posb - posa;
+            Scalar3 dx = posb - posa;
 
-        // access charge (if needed)
-        Scalar charge_a = Scalar(0.0);
-        Scalar charge_b = Scalar(0.0);
-        if (evaluator::needsCharge())
-            {
-            charge_a = h_charge.data[idx_a];
-            charge_b = h_charge.data[idx_b];
-            }
+            // access charge (if needed)
+            Scalar charge_a = Scalar(0.0);
+            Scalar charge_b = Scalar(0.0);
+            if (evaluator::needsCharge())
+                {
+                charge_a = h_charge.data[idx_a];
+                charge_b = h_charge.data[idx_b];
+                }
 
-        // if the vector crosses the box, pull it back
-        dx = box.minImage(dx);
+            // if the vector crosses the box, pull it back
+            dx = box.minImage(dx);
 
-        // calculate r_ab squared
-        Scalar rsq = dot(dx, dx);
+            // calculate r_ab squared
+            Scalar rsq = dot(dx, dx);
 
-        // get parameters for this bond type
-        const param_type& param = h_params.data[h_typeval.data[i].type];
+            // get parameters for this bond type
+            const param_type& param = h_params.data[h_typeval.data[i].type];
 
-        // compute the force and potential energy
-        Scalar force_divr = Scalar(0.0);
-        Scalar bond_eng = Scalar(0.0);
-        evaluator eval(rsq, param);
-        if (evaluator::needsCharge())
-            eval.setCharge(charge_a, charge_b);
+            // compute the force and potential energy
+            Scalar force_divr = Scalar(0.0);
+            Scalar bond_eng = Scalar(0.0);
+            evaluator eval(rsq, param);
+            if (evaluator::needsCharge())
+                eval.setCharge(charge_a, charge_b);
 
-        bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
+            bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
 
-        // Bond energy must be halved
-        bond_eng *= Scalar(0.5);
+            // Bond energy must be halved
+            bond_eng *= Scalar(0.5);
 
-        if (evaluated)
-            {
-            // calculate virial
-            if (compute_virial)
+            if (evaluated)
                 {
-                Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
-                bond_virial[0] = dx.x * dx.x * force_div2r; // xx
-                bond_virial[1] = dx.x * dx.y * force_div2r; // xy
-                bond_virial[2] = dx.x * dx.z * force_div2r; // xz
-                bond_virial[3] = dx.y * dx.y * force_div2r; // yy
-                bond_virial[4] = dx.y * dx.z * force_div2r; // yz
-                bond_virial[5] = dx.z * dx.z * force_div2r; // zz
-                }
-
-            // add the force to the particles (only for non-ghost particles)
-            if (idx_b < m_pdata->getN())
-                {
-                h_force.data[idx_b].x += force_divr * dx.x;
-                h_force.data[idx_b].y += force_divr * dx.y;
-                h_force.data[idx_b].z += force_divr * dx.z;
-                h_force.data[idx_b].w += bond_eng;
+                // calculate virial
+                Scalar bond_virial[6] = {0, 0, 0, 0, 0, 0};
                 if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_b] += bond_virial[i];
+                    {
+                    Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
+                    bond_virial[0] = dx.x * dx.x * force_div2r; // xx
+                    bond_virial[1] = dx.x * dx.y * force_div2r; // xy
+                    bond_virial[2] = dx.x * dx.z * force_div2r; // xz
+                    bond_virial[3] = dx.y * dx.y * force_div2r; // yy
+                    bond_virial[4] = dx.y * dx.z * force_div2r; // yz
+                    bond_virial[5] = dx.z * dx.z * force_div2r; // zz
+                    }
+
+                // add the force to the particles (only for non-ghost particles)
+                if (idx_b < m_pdata->getN())
+                    {
+                    force[idx_b - offset].x += force_divr * dx.x;
+                    force[idx_b - offset].y += force_divr * dx.y;
+                    force[idx_b - offset].z += force_divr * dx.z;
+                    force[idx_b - offset].w += bond_eng;
+                    if (compute_virial)
+                        for (unsigned int i = 0; i < 6; i++)
+                            virial[i * virial_pitch + idx_b - offset] += bond_virial[i];
+                    }
+
+                if (idx_a < m_pdata->getN())
+                    {
+                    force[idx_a - offset].x -= force_divr * dx.x;
+                    force[idx_a - offset].y -= force_divr * dx.y;
+                    force[idx_a - offset].z -= force_divr * dx.z;
+                    force[idx_a - offset].w += bond_eng;
+                    if (compute_virial)
+                        for (unsigned int i = 0; i < 6; i++)
+                            virial[i * virial_pitch + idx_a - offset] += bond_virial[i];
+                    }
                 }
-
-            if (idx_a < m_pdata->getN())
+            else
                 {
-                h_force.data[idx_a].x -= force_divr * dx.x;
-                h_force.data[idx_a].y -= force_divr * dx.y;
-                h_force.data[idx_a].z -= force_divr * dx.z;
-                h_force.data[idx_a].w += bond_eng;
-                if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_a] += bond_virial[i];
+                std::ostringstream s;
+                s << "special_pair." << evaluator::getName() << ": bond out of bounds";
+                throw std::runtime_error(s.str());
                 }
             }
-        else
-            {
-            this->m_exec_conf->msg->error()
-                << "special_pair." << evaluator::getName() << ": bond out of bounds" << std::endl
-                << std::endl;
-            throw std::runtime_error("Error in special pair calculation");
-            }
-        }
+    };
+
+    computeBondedForces(size,
+                        h_bonds.data,
+                        h_rtag.data,
+                        h_force.data,
+                        h_virial.data,
+                        compute_range);
     }
 
 #ifdef ENABLE_MPI
@@ -3,6 +3,7 @@
 
 #include "TableAngleForceCompute.h"
 
+#include <sstream>
 #include <stdexcept>
 
 /*! \file TableAngleForceCompute.cc
@@ -23,7 +24,7 @@ namespace md
 */
 TableAngleForceCompute::TableAngleForceCompute(std::shared_ptr<SystemDefinition> sysdef,
                                                unsigned int table_width)
-    : ForceCompute(sysdef), m_table_width(table_width)
+    : BondedForceCompute(sysdef), m_table_width(table_width)
     {
     m_exec_conf->msg->notice(5) << "Constructing TableAngleForceCompute" << endl;
 
@@ -149,7 +150,6 @@ void TableAngleForceCompute::computeForces(uint64_t timestep)
     assert(h_pos.data);
     assert(h_rtag.data);
 
-    size_t virial_pitch = m_virial.getPitch();
 
     // Zero data for force calculation.
     memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
@@ -161,165 +161,195 @@ void TableAngleForceCompute::computeForces(uint64_t timestep)
     // access the table data
     ArrayHandle<Scalar2> h_tables(m_tables, access_location::host, access_mode::read);
 
+    ArrayHandle<AngleData::members_t> h_angles(m_angle_data->getMembersArray(),
+                                               access_location::host,
+                                               access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_angle_data->getTypeValArray(),
+                                     access_location::host,
+                                     access_mode::read);
+
     // for each of the angles
     const unsigned int size = (unsigned int)m_angle_data->getN();
-    for (unsigned int i = 0; i < size; i++)
-        {
-        // lookup the tag of each of the particles participating in the angle
-        const AngleData::members_t& angle = m_angle_data->getMembersByIndex(i);
-        assert(angle.tag[0] <= m_pdata->getMaximumTag());
-        assert(angle.tag[1] <= m_pdata->getMaximumTag());
-        assert(angle.tag[2] <= m_pdata->getMaximumTag());
-
-        // transform a, b, and c into indices into the particle data arrays
-        // MEM TRANSFER: 6 ints
-        unsigned int idx_a = h_rtag.data[angle.tag[0]];
-        unsigned int idx_b = h_rtag.data[angle.tag[1]];
-        unsigned int idx_c = h_rtag.data[angle.tag[2]];
-
-        // throw an error if this angle is incomplete
-        if (idx_a == NOT_LOCAL || idx_b == NOT_LOCAL || idx_c == NOT_LOCAL)
-            {
-            this->m_exec_conf->msg->error()
-                << "angle.table: angle " << angle.tag[0] << " " << angle.tag[1] << " "
-                << angle.tag[2] << " incomplete." << endl
-                << endl;
-            throw std::runtime_error("Error in angle calculation");
-            }
-
-        assert(idx_a < m_pdata->getN() + m_pdata->getNGhosts());
-        assert(idx_b < m_pdata->getN() + m_pdata->getNGhosts());
-        assert(idx_c < m_pdata->getN() + m_pdata->getNGhosts());
-
-        // calculate d\vec{r}
-        Scalar3 dab;
-        dab.x = h_pos.data[idx_a].x - h_pos.data[idx_b].x;
-        dab.y = h_pos.data[idx_a].y - h_pos.data[idx_b].y;
-        dab.z = h_pos.data[idx_a].z - h_pos.data[idx_b].z;
-
-        Scalar3 dcb;
-        dcb.x = h_pos.data[idx_c].x - h_pos.data[idx_b].x;
-        dcb.y = h_pos.data[idx_c].y - h_pos.data[idx_b].y;
-        dcb.z = h_pos.data[idx_c].z - h_pos.data[idx_b].z;
-
-        Scalar3 dac;
-        dac.x = h_pos.data[idx_a].x - h_pos.data[idx_c].x; // used for the 1-3 JL interaction
-        dac.y = h_pos.data[idx_a].y - h_pos.data[idx_c].y;
-        dac.z = h_pos.data[idx_a].z - h_pos.data[idx_c].z;
-
-        // apply minimum image conventions to all 3 vectors
-        dab = box.minImage(dab);
-        dcb = box.minImage(dcb);
-        dac = box.minImage(dac);
-
-        Scalar delta_th = Scalar(M_PI) / Scalar(m_table_width - 1);
-
-        // start computing the force
-        Scalar rsqab = dab.x * dab.x + dab.y * dab.y + dab.z * dab.z;
-        Scalar rab = sqrt(rsqab);
-        Scalar rsqcb = dcb.x * dcb.x + dcb.y * dcb.y + dcb.z * dcb.z;
-        Scalar rcb = sqrt(rsqcb);
-
-        // cosine of theta
-        Scalar c_abbc = dab.x * dcb.x + dab.y * dcb.y + dab.z * dcb.z;
-        c_abbc /= rab * rcb;
-
-        if (c_abbc > 1.0)
-            c_abbc = 1.0;
-        if (c_abbc < -1.0)
-            c_abbc = -1.0;
-
-        // 1/sine of theta
-        Scalar s_abbc = sqrt(1.0 - c_abbc * c_abbc);
-        if (s_abbc < SMALL)
-            s_abbc = SMALL;
-        s_abbc = 1.0 / s_abbc;
-
-        // theta
-        Scalar theta = acos(c_abbc);
-
-        // precomputed term
-        Scalar value_f = theta / delta_th;
-
-        // compute index into the table and read in values
-
-        /// Here we use the table!!
-        unsigned int angle_type = m_angle_data->getTypeByIndex(i);
-        unsigned int value_i = (unsigned int)(slow::floor(value_f));
-        Scalar2 VT0 = h_tables.data[m_table_value(value_i, angle_type)];
-        Scalar2 VT1 = h_tables.data[m_table_value(value_i + 1, angle_type)];
-        // unpack the data
-        Scalar V0 = VT0.x;
-        Scalar V1 = VT1.x;
-        Scalar T0 = VT0.y;
-        Scalar T1 = VT1.y;
-
-        // compute the linear interpolation coefficient
-        Scalar f = value_f - Scalar(value_i);
-
-        // interpolate to get V and T;
-        Scalar V = V0 + f * (V1 - V0);
-        Scalar T = T0 + f * (T1 - T0);
-
-        Scalar a = T * s_abbc;
-        Scalar a11 = a * c_abbc / rsqab;
-        Scalar a12 = -a / (rab * rcb);
-        Scalar a22 = a * c_abbc / rsqcb;
-
-        Scalar fab[3], fcb[3];
-
-        fab[0] = a11 * dab.x + a12 * dcb.x;
-        fab[1] = a11 * dab.y + a12 * dcb.y;
-        fab[2] = a11 * dab.z + a12 * dcb.z;
-
-        fcb[0] = a22 * dcb.x + a12 * dab.x;
-        fcb[1] = a22 * dcb.y + a12 * dab.y;
-        fcb[2] = a22 * dcb.z + a12 * dab.z;
-
-        Scalar angle_eng = V * Scalar(1.0 / 3.0);
-
-        // compute 1/3 of the virial, 1/3 for each atom in the angle
-        // symmetrized version of virial tensor
-        Scalar angle_virial[6];
-        angle_virial[0] = Scalar(1. / 3.) * (dab.x * fab[0] + dcb.x * fcb[0]);
-        angle_virial[1] = Scalar(1. / 3.) * (dab.y * fab[0] + dcb.y * fcb[0]);
-        angle_virial[2] = Scalar(1. / 3.) * (dab.z * fab[0] + dcb.z * fcb[0]);
-        angle_virial[3] = Scalar(1. / 3.) * (dab.y * fab[1] + dcb.y * fcb[1]);
-        angle_virial[4] = Scalar(1. / 3.) * (dab.z * fab[1] + dcb.z * fcb[1]);
-        angle_virial[5] = Scalar(1. / 3.) * (dab.z * fab[2] + dcb.z * fcb[2]);
-
-        // Now, apply the force to each individual atom a,b,c, and accumulate the energy/virial
-        // only apply force to local atoms
-        if (idx_a < m_pdata->getN())
-            {
-            h_force.data[idx_a].x += fab[0];
-            h_force.data[idx_a].y += fab[1];
-            h_force.data[idx_a].z += fab[2];
-            h_force.data[idx_a].w += angle_eng;
-            for (int j = 0; j < 6; j++)
-                h_virial.data[j * virial_pitch + idx_a] += angle_virial[j];
-            }
-
-        if (idx_b < m_pdata->getN())
-            {
-            h_force.data[idx_b].x -= fab[0] + fcb[0];
-            h_force.data[idx_b].y -= fab[1] + fcb[1];
-            h_force.data[idx_b].z -= fab[2] + fcb[2];
-            h_force.data[idx_b].w += angle_eng;
-            for (int j = 0; j < 6; j++)
-                h_virial.data[j * virial_pitch + idx_b] += angle_virial[j];
-            }
-
-        if (idx_c < m_pdata->getN())
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch,
+                             unsigned int offset)
+    {
+        for (unsigned int i = first; i < last; i++)
             {
-            h_force.data[idx_c].x += fcb[0];
-            h_force.data[idx_c].y += fcb[1];
-            h_force.data[idx_c].z += fcb[2];
-            h_force.data[idx_c].w += angle_eng;
-            for (int j = 0; j < 6; j++)
-                h_virial.data[j * virial_pitch + idx_c] += angle_virial[j];
+            // lookup the tag of each of the particles participating in the angle
+            const AngleData::members_t& angle = h_angles.data[i];
+            assert(angle.tag[0] <= m_pdata->getMaximumTag());
+            assert(angle.tag[1] <= m_pdata->getMaximumTag());
+            assert(angle.tag[2] <= m_pdata->getMaximumTag());
+
+            // transform a, b, and c into indices into the particle data arrays
+            // MEM TRANSFER: 6 ints
+            unsigned int idx_a = h_rtag.data[angle.tag[0]];
+            unsigned int idx_b = h_rtag.data[angle.tag[1]];
+            unsigned int idx_c = h_rtag.data[angle.tag[2]];
+
+            // throw an error if this angle is incomplete
+            if (idx_a == NOT_LOCAL || idx_b == NOT_LOCAL || idx_c == NOT_LOCAL)
+                {
+                std::ostringstream s;
+                s << "angle.table: angle " << angle.tag[0] << " " << angle.tag[1] << " "
+                  << angle.tag[2] << " incomplete.";
+                throw std::runtime_error(s.str());
+                }
+
+            assert(idx_a < m_pdata->getN() + m_pdata->getNGhosts());
+            assert(idx_b < m_pdata->getN() + m_pdata->getNGhosts());
+            assert(idx_c < m_pdata->getN() + m_pdata->getNGhosts());
+
+            // calculate d\vec{r}
+            Scalar3 dab;
+            dab.x = h_pos.data[idx_a].x - h_pos.data[idx_b].x;
+            dab.y = h_pos.data[idx_a].y - h_pos.data[idx_b].y;
+            dab.z = h_pos.data[idx_a].z - h_pos.data[idx_b].z;
+
+            Scalar3 dcb;
+            dcb.x = h_pos.data[idx_c].x - h_pos.data[idx_b].x;
+            dcb.y = h_pos.data[idx_c].y - h_pos.data[idx_b].y;
+            dcb.z = h_pos.data[idx_c].z - h_pos.data[idx_b].z;
+
+            Scalar3 dac;
+            dac.x = h_pos.data[idx_a].x - h_pos.data[idx_c].x; // used for the 1-3 JL interaction
+            dac.y = h_pos.data[idx_a].y - h_pos.data[idx_c].y;
+            dac.z = h_pos.data[idx_a].z - h_pos.data[idx_c].z;
+
+            // apply minimum image conventions to all 3 vectors
+            dab = box.minImage(dab);
+            dcb = box.minImage(dcb);
+            dac = box.minImage(dac);
+
+            Scalar delta_th = Scalar(M_PI) / Scalar(m_table_width - 1);
+
+            // start computing the force
+            Scalar rsqab = dab.x * dab.x + dab.y * dab.y + dab.z * dab.z;
+            Scalar rab = sqrt(rsqab);
+            Scalar rsqcb = dcb.x * dcb.x + dcb.y * dcb.y + dcb.z * dcb.z;
+            Scalar rcb = sqrt(rsqcb);
+
+            // cosine of theta
+            Scalar c_abbc = dab.x * dcb.x + dab.y * dcb.y + dab.z * dcb.z;
+            c_abbc /= rab * rcb;
+
+            if (c_abbc > 1.0)
+                c_abbc = 1.0;
+            if (c_abbc < -1.0)
+                c_abbc = -1.0;
+
+            // 1/sine of theta
+            Scalar s_abbc = sqrt(1.0 - c_abbc * c_abbc);
+            if (s_abbc < SMALL)
+                s_abbc = SMALL;
+            s_abbc = 1.0 / s_abbc;
+
+            // theta
+            Scalar theta = acos(c_abbc);
+
+            // precomputed term
+            Scalar value_f = theta / delta_th;
+
+            // compute index into the table and read in values
+
+            /// Here we use the table!!
+            unsigned int angle_type = h_typeval.data[i].type;
+            unsigned int value_i = (unsigned int)(slow::floor(value_f));
+            Scalar2 VT0 = h_tables.data[m_table_value(value_i, angle_type)];
+            Scalar2 VT1 = h_tables.data[m_table_value(value_i + 1, angle_type)];
+            // unpack the data
+            Scalar V0 = VT0.x;
+            Scalar V1 = VT1.x;
+            Scalar T0 = VT0.y;
+            Scalar T1 = VT1.y;
+
+            // compute the linear interpolation coefficient
+            Scalar f = value_f - Scalar(value_i);
+
+            // interpolate to get V and T;
+            Scalar V = V0 + f * (V1 - V0);
+            Scalar T = T0 + f * (T1 - T0);
+
+            Scalar a = T * s_abbc;
+            Scalar a11 = a * c_abbc / rsqab;
+            Scalar a12 = -a / (rab * rcb);
+            Scalar a22 = a * c_abbc / rsqcb;
+
+            Scalar fab[3], fcb[3];
+
+            fab[0] = a11 * dab.x + a12 * dcb.x;
+            fab[1] = a11 * dab.y + a12 * dcb.y;
+            fab[2] = a11 * dab.z + a12 * dcb.z;
+
+            fcb[0] = a22 * dcb.x + a12 * dab.x;
+            fcb[1] = a22 * dcb.y + a12 * dab.y;
+            fcb[2] = a22 * dcb.z + a12 * dab.z;
+
+            Scalar angle_eng = V * Scalar(1.0 / 3.0);
+
+            // compute 1/3 of the virial, 1/3 for each atom in the angle
+            // symmetrized version of virial tensor
+            Scalar angle_virial[6];
+            angle_virial[0] = Scalar(1. / 3.) * (dab.x * fab[0] + dcb.x * fcb[0]);
+            angle_virial[1] = Scalar(1. / 3.) * (dab.y * fab[0] + dcb.y * fcb[0]);
+            angle_virial[2] = Scalar(1. / 3.) * (dab.z * fab[0] + dcb.z * fcb[0]);
+            angle_virial[3] = Scalar(1. / 3.) * (dab.y * fab[1] + dcb.y * fcb[1]);
+            angle_virial[4] = Scalar(1. / 3.) * (dab.z * fab[1] + dcb.z * fcb[1]);
+            angle_virial[5] = Scalar(1. / 3.) * (dab.z * fab[2] + dcb.z * fcb[2]);
+
+            // Now, apply the force to each individual atom a,b,c, and accumulate the energy/virial
+            // only apply force to local atoms
+            if (idx_a < m_pdata->getN())
+                {
+                force[idx_a - offset].x += fab[0];
+                force[idx_a - offset].y += fab[1];
+                force[idx_a - offset].z += fab[2];
+                force[idx_a - offset].w += angle_eng;
+                if (virial)
+                    {
+                    for (int j = 0; j < 6; j++)
+                        virial[j * virial_pitch + idx_a - offset] += angle_virial[j];
+                    }
+                }
+
+            if (idx_b < m_pdata->getN())
+                {
+                force[idx_b - offset].x -= fab[0] + fcb[0];
+                force[idx_b - offset].y -= fab[1] + fcb[1];
+                force[idx_b - offset].z -= fab[2] + fcb[2];
+                force[idx_b - offset].w += angle_eng;
+                if (virial)
+                    {
+                    for (int j = 0; j < 6; j++)
+                        virial[j * virial_pitch + idx_b - offset] += angle_virial[j];
+                    }
+                }
+
+            if (idx_c < m_pdata->getN())
+                {
+                force[idx_c - offset].x += fcb[0];
+                force[idx_c - offset].y += fcb[1];
+                force[idx_c - offset].z += fcb[2];
+                force[idx_c - offset].w += angle_eng;
+                if (virial)
+                    {
+                    for (int j = 0; j < 6; j++)
+                        virial[j * virial_pitch + idx_c - offset] += angle_virial[j];
+                    }
+                }
             }
-        }
+    };
+
+    computeBondedForces(size,
+                        h_angles.data,
+                        h_rtag.data,
+                        h_force.data,
+                        h_virial.data,
+                        compute_range);
     }
 
 namespace detail
@@ -153,6 +153,13 @@ class Integrator(_DynamicIntegrator):
         half_step_hook (hoomd.md.HalfStepHook): Enables the user to perform
             arbitrary computations during the half-step of the integration.
 
+        fuse_net_force (bool): When True, forces that support it add directly
+            to the net force.
+
+        overlap_communication (bool): When True, forces that support it
+            compute the forces between local particles while the ghost
+            particle positions are communicated.
+
     `Integrator` is the top level class that orchestrates the time integration
     step in molecular dynamics simulations. The integration `methods` define
     the equations of motion to integrate under the influence of the given
@@ -191,6 +198,35 @@ class Integrator(_DynamicIntegrator):
     special case, as it only integrates the degrees of freedom of each body's
     center of mass. See `hoomd.md.constrain.Rigid` for details.
 
+    .. rubric:: Fused net force
+
+    By default, each force stores its per-particle forces, energies, and
+    virials in its own arrays and `Integrator` sums these arrays to compute the
+    net force. When `fuse_net_force` is ``True``, forces that support it (pair
+    forces on the CPU) add their contributions directly to the net force. This
+    avoids writing and reading back one set of per-particle arrays for each
+    force on every step. Per-force quantities such as
+    `hoomd.md.force.Force.energy` remain available: the force recomputes them
+    on the steps where you access them (e.g. when a logger writes them).
+
+    Note:
+        `fuse_net_force` has no effect on the GPU.
+
+    .. rubric:: Communication overlap
+
+    In MPI simulations, each rank receives the positions of the ghost particles
+    near its domain boundary from its neighbors on every step. When
+    `overlap_communication` is ``True``, forces that support it (pair forces on
+    the CPU) compute the forces on particles that have no ghost neighbors while
+    these messages are in flight and finish the remaining particles once they
+    arrive. This hides part of the communication latency when there are many
+    ranks. The forces are the same up to the order of floating point additions.
+
+    Note:
+        `overlap_communication` has no effect on the GPU, in simulations with
+        rigid bodies, or on forces that add directly to the net force (see
+        `fuse_net_force`).
+
     .. rubric:: Degrees of freedom
 
     `Integrator` always integrates the translational degrees of freedom.
@@ -262,6 +298,13 @@ class Integrator(_DynamicIntegrator):
 
         half_step_hook (hoomd.md.HalfStepHook): User defined implementation to
             perform computations during the half-step of the integration.
+
+        fuse_net_force (bool): When True, forces that support it add directly
+            to the net force.
+
+        overlap_communication (bool): When True, forces that support it
+            compute the forces between local particles while the ghost
+            particle positions are communicated.
     """
 
     def __init__(self,
@@ -271,7 +314,9 @@ class Integrator(_DynamicIntegrator):
                  constraints=None,
                  methods=None,
                  rigid=None,
-                 half_step_hook=None):
+                 half_step_hook=None,
+                 fuse_net_force=False,
+                 overlap_communication=False):
 
         super().__init__(forces, constraints, methods, rigid)
 
@@ -279,6 +324,8 @@ class Integrator(_DynamicIntegrator):
             ParameterDict(
                 dt=float(dt),
                 integrate_rotational_dof=bool(integrate_rotational_dof),
+                fuse_net_force=bool(fuse_net_force),
+                overlap_communication=bool(overlap_communication),
                 half_step_hook=OnlyTypes(hoomd.md.HalfStepHook,
                                          allow_none=True)))
 
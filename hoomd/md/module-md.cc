@@ -36,6 +36,7 @@ void export_NeighborList(pybind11::module& m);
 void export_NeighborListBinned(pybind11::module& m);
 void export_NeighborListStencil(pybind11::module& m);
 void export_NeighborListTree(pybind11::module& m);
+void export_NeighborListAdaptive(pybind11::module& m);
 void export_MolecularForceCompute(pybind11::module& m);
 void export_ForceDistanceConstraint(pybind11::module& m);
 void export_ForceComposite(pybind11::module& m);
@@ -366,6 +367,7 @@ PYBIND11_MODULE(_md, m)
     export_NeighborListBinned(m);
     export_NeighborListStencil(m);
     export_NeighborListTree(m);
+    export_NeighborListAdaptive(m);
     export_MolecularForceCompute(m);
     export_ForceDistanceConstraint(m);
     export_ForceComposite(m);
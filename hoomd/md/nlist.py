@@ -89,6 +89,18 @@ class NeighborList(Compute):
 
     `NeighborList` is the base class for all neighbor lists.
 
+    By default, neighbor lists store the neighbors of each particle in the order
+    that the build algorithm finds them. Set `sort` to ``'index'`` to sort each
+    particle's neighbors by particle index, or to ``'type'`` to sort them by
+    particle type and then by index. HOOMD-blue orders particles in memory
+    along a space filling curve, so sorted neighbors are read from nearby
+    memory locations. Sorting adds time to every neighbor list build and can
+    reduce the time spent in pair force computations on the CPU, especially in
+    large systems. ``'type'`` lets pair potentials reuse the parameters of
+    consecutive neighbors with the same type. Benchmark your system to choose
+    the best option. Sorting is only implemented on the CPU, `sort` must be
+    ``'none'`` when the simulation runs on a GPU.
+
     Warning:
         Users should not instantiate this class directly. The class can be used
         for `isinstance` or `issubclass` checks.
@@ -103,6 +115,8 @@ class NeighborList(Compute):
         mesh (Mesh): mesh data structure (optional)
         default_r_cut (float): Default cutoff distance :math:`[\mathrm{length}]`
             (optional).
+        sort (str): Order of the neighbors of each particle: ``'none'``,
+            ``'index'``, or ``'type'``.
 
     .. py:attribute:: r_cut
 
@@ -114,8 +128,14 @@ class NeighborList(Compute):
         `float`])
     """
 
-    def __init__(self, buffer, exclusions, rebuild_check_delay, check_dist,
-                 mesh, default_r_cut):
+    def __init__(self,
+                 buffer,
+                 exclusions,
+                 rebuild_check_delay,
+                 check_dist,
+                 mesh,
+                 default_r_cut,
+                 sort='none'):
 
         validate_exclusions = OnlyFrom([
             'bond', 'angle', 'constraint', 'dihedral', 'special_pair', 'body',
@@ -134,8 +154,10 @@ class NeighborList(Compute):
         params = ParameterDict(exclusions=[validate_exclusions],
                                buffer=float(buffer),
                                rebuild_check_delay=int(rebuild_check_delay),
-                               check_dist=bool(check_dist))
+                               check_dist=bool(check_dist),
+                               sort=OnlyFrom(['none', 'index', 'type']))
         params["exclusions"] = exclusions
+        params["sort"] = sort
         self._param_dict.update(params)
 
         self._mesh = validate_mesh(mesh)
@@ -143,9 +165,21 @@ class NeighborList(Compute):
         self._in_context_manager = False
 
     def _attach_hook(self):
+        self._check_sort(self.sort)
         if self._mesh is not None:
             self._cpp_obj.addMesh(self._mesh._cpp_obj)
 
+    def _setattr_param(self, attr, value):
+        if attr == "sort" and self._attached:
+            self._check_sort(value)
+        super()._setattr_param(attr, value)
+
+    def _check_sort(self, sort):
+        if (sort != 'none'
+                and isinstance(self._simulation.device, hoomd.device.GPU)):
+            raise RuntimeError("Neighbor list sorting is not implemented on "
+                               "the GPU, set sort='none'.")
+
     def _detach_hook(self):
         if self._mesh is not None:
             self._mesh._detach_hook()
@@ -338,7 +372,10 @@ class Cell(NeighborList):
         mesh (Mesh): When a mesh object is passed, the neighbor list uses the
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
-        default_r_cut
+        default_r_cut (float): Default cutoff distance
+            :math:`[\mathrm{length}]`.
+        sort (str): Order of the neighbors of each particle: ``'none'``,
+            ``'index'``, or ``'type'``. See `NeighborList` for details.
 
     `Cell` finds neighboring particles using a fixed width cell list, allowing
     for *O(kN)* construction of the neighbor list where *k* is the number of
@@ -379,10 +416,11 @@ class Cell(NeighborList):
                  check_dist=True,
                  deterministic=False,
                  mesh=None,
-                 default_r_cut=0.0):
+                 default_r_cut=0.0,
+                 sort='none'):
 
         super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
-                         mesh, default_r_cut)
+                         mesh, default_r_cut, sort)
 
         self._param_dict.update(
             ParameterDict(deterministic=bool(deterministic)))
@@ -435,6 +473,8 @@ class Stencil(NeighborList):
         mesh (Mesh): When a mesh object is passed, the neighbor list uses the
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
+        sort (str): Order of the neighbors of each particle: ``'none'``,
+            ``'index'``, or ``'type'``. See `NeighborList` for details.
 
     `Stencil` finds neighboring particles using a fixed width cell list, for
     *O(kN)* construction of the neighbor list where *k* is the number of
@@ -487,10 +527,11 @@ class Stencil(NeighborList):
                  check_dist=True,
                  deterministic=False,
                  mesh=None,
-                 default_r_cut=0.0):
+                 default_r_cut=0.0,
+                 sort='none'):
 
         super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
-                         mesh, default_r_cut)
+                         mesh, default_r_cut, sort)
 
         params = ParameterDict(deterministic=bool(deterministic),
                                cell_width=float(cell_width))
@@ -520,6 +561,8 @@ class Tree(NeighborList):
         mesh (Mesh): When a mesh object is passed, the neighbor list uses the
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
+        sort (str): Order of the neighbors of each particle: ``'none'``,
+            ``'index'``, or ``'type'``. See `NeighborList` for details.
 
     `Tree` creates a neighbor list using a bounding volume hierarchy (BVH) tree
     traversal in :math:`O(N \\log N)` time. A BVH tree of axis-aligned bounding
@@ -560,10 +603,11 @@ class Tree(NeighborList):
                  rebuild_check_delay=1,
                  check_dist=True,
                  mesh=None,
-                 default_r_cut=0.0):
+                 default_r_cut=0.0,
+                 sort='none'):
 
         super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
-                         mesh, default_r_cut)
+                         mesh, default_r_cut, sort)
 
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.CPU):
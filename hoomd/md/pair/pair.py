@@ -54,12 +54,38 @@ class Pair(force.Force):
         Neighbor list used to compute the pair force.
 
         Type: `hoomd.md.nlist.NeighborList`
+
+    .. py:attribute:: tabulation_tolerance
+
+        Relative error tolerance of the tabulated force and energy. When
+        positive, the CPU evaluates the force and energy of each type pair from
+        a cubic spline table in :math:`r^2` that is built when the simulation
+        starts and whenever ``params``, `r_cut`, `r_on`, or `mode` change. Each
+        table covers the range from :math:`r_\mathrm{cut}` down to the distance
+        where the relative error of the interpolation exceeds the tolerance.
+        Shorter distances evaluate the analytic form. Tabulation speeds up
+        potentials that evaluate exponentials or non-integer powers. Set to
+        ``0`` to always evaluate the analytic form. *Optional*: defaults to
+        ``0.0``.
+
+        Not available for forces that depend on the particle charges or compute
+        the force differently (`Ewald`, `ReactionField`, `Table`, `DPD`,
+        `DPDLJ`, and the anisotropic and alchemical pair forces).
+
+        Note:
+            The GPU always evaluates the analytic form.
+
+        Type: `float`
     """
 
     # The accepted modes for the potential. Should be reset by subclasses with
     # restricted modes.
     _accepted_modes = ("none", "shift", "xplor")
 
+    # Whether the C++ class can evaluate the force from spline tables. Set to
+    # False in subclasses that cannot.
+    _tabulation_supported = True
+
     # Module where the C++ class is defined. Reassign this when developing an
     # external plugin.
     _ext_module = _md
@@ -84,6 +110,9 @@ class Pair(force.Force):
         self._param_dict.update(
             ParameterDict(mode=OnlyFrom(self._accepted_modes),
                           nlist=hoomd.md.nlist.NeighborList))
+        if self._tabulation_supported:
+            self._param_dict.update(
+                ParameterDict(tabulation_tolerance=float(0.0)))
         self.mode = mode
         self.nlist = nlist
 
@@ -123,6 +152,41 @@ class Pair(force.Force):
         # above and raise an error if they occur.
         return self._cpp_obj.computeEnergyBetweenSets(tags1, tags2)
 
+    @property
+    def tabulation_accuracy(self):
+        r"""dict: Accuracy of the tabulated force and energy.
+
+        The keys are the type pairs and the values are dicts with the keys:
+
+        * ``r_min`` (`float`): Shortest distance evaluated from the table
+          :math:`[\mathrm{length}]`. ``r_min`` is ``r_cut`` when nothing is
+          tabulated.
+        * ``error`` (`float`): Largest relative error of the tabulated force
+          and energy compared to the analytic form, measured at 3 points in
+          each interval of the table.
+
+        Available when `tabulation_tolerance` is available and the force is
+        attached.
+
+        Example::
+
+            lj.tabulation_tolerance = 1e-6
+            simulation.run(0)
+            print(lj.tabulation_accuracy[('A', 'A')]['r_min'])
+        """
+        if not self._tabulation_supported:
+            raise AttributeError(
+                f"{type(self).__name__} does not support tabulation.")
+        if not self._attached:
+            raise hoomd.error.DataAccessError("tabulation_accuracy")
+
+        types = self._simulation.state.particle_types
+        return {
+            (a, b): self._cpp_obj.getTabulationAccuracy((a, b))
+            for i, a in enumerate(types)
+            for b in types[i:]
+        }
+
     def _attach_hook(self):
         if self.nlist._attached and self._simulation != self.nlist._simulation:
             warnings.warn(
@@ -504,6 +568,7 @@ class Ewald(Pair):
     """
     _cpp_class_name = "PotentialPairEwald"
     _accepted_modes = ("none",)
+    _tabulation_supported = False
 
     def __init__(self, nlist, default_r_cut=None):
         super().__init__(nlist=nlist,
@@ -602,6 +667,7 @@ class Table(Pair):
     """
     _cpp_class_name = "PotentialPairTable"
     _accepted_modes = ("none",)
+    _tabulation_supported = False
 
     def __init__(self, nlist, default_r_cut=None):
         super().__init__(nlist,
@@ -754,6 +820,7 @@ class DPD(Pair):
     """
     _cpp_class_name = "PotentialPairDPDThermoDPD"
     _accepted_modes = ("none",)
+    _tabulation_supported = False
 
     def __init__(
         self,
@@ -909,6 +976,7 @@ class DPDLJ(Pair):
     """
     _cpp_class_name = "PotentialPairDPDThermoLJ"
     _accepted_modes = ("none", "shift")
+    _tabulation_supported = False
 
     def __init__(self, nlist, kT, default_r_cut=None, mode='none'):
 
@@ -1359,6 +1427,7 @@ class ReactionField(Pair):
         Type: `str`
     """
     _cpp_class_name = "PotentialPairReactionField"
+    _tabulation_supported = False
 
     def __init__(self, nlist, default_r_cut=None, default_r_on=0., mode='none'):
         super().__init__(nlist, default_r_cut, default_r_on, mode)
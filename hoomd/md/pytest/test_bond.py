@@ -197,3 +197,103 @@ def test_pickling(simulation_factory, snapshot_factory, bond_cls, bond_args,
     sim.operations.integrator = integrator
     sim.run(0)
     pickling_check(potential)
+
+
+@pytest.mark.cpu
+def test_cpu_threads(evaluate_cpu_threads, device):
+    """Test that threaded bonded forces match the serial computation."""
+    # Place 16 linear chains of 8 particles in the box.
+    n_chains = 16
+    chain_length = 8
+    snap = hoomd.Snapshot(device.communicator)
+    if snap.communicator.rank == 0:
+        rng = np.random.default_rng(seed=5)
+        L = 20
+        snap.configuration.box = [L, L, L, 0, 0, 0]
+        snap.particles.N = n_chains * chain_length
+        snap.particles.types = ['A']
+        position = []
+        for chain in range(n_chains):
+            start = np.array([chain % 4, chain // 4, 0]) * 4.0 - L / 2 + 1
+            for i in range(chain_length):
+                position.append(start + [0, 0, 1.1 * i]
+                                + rng.uniform(-0.2, 0.2, size=3))
+        snap.particles.position[:] = position
+
+        groups = {2: [], 3: [], 4: []}
+        pairs = []
+        for chain in range(n_chains):
+            first = chain * chain_length
+            for size, group_list in groups.items():
+                for i in range(chain_length - size + 1):
+                    group_list.append(list(range(first + i, first + i + size)))
+            for i in range(chain_length - 3):
+                pairs.append([first + i, first + i + 3])
+
+        snap.bonds.N = len(groups[2])
+        snap.bonds.types = ['A-A']
+        snap.bonds.group[:] = groups[2]
+        snap.angles.N = len(groups[3])
+        snap.angles.types = ['A-A-A']
+        snap.angles.group[:] = groups[3]
+        snap.dihedrals.N = len(groups[4])
+        snap.dihedrals.types = ['A-A-A-A']
+        snap.dihedrals.group[:] = groups[4]
+        snap.impropers.N = len(groups[4])
+        snap.impropers.types = ['A-A-A-A']
+        snap.impropers.group[:] = groups[4]
+        snap.pairs.N = len(pairs)
+        snap.pairs.types = ['A-A']
+        snap.pairs.group[:] = pairs
+
+    def simulate(sim):
+        harmonic = md.bond.Harmonic()
+        harmonic.params['A-A'] = dict(k=30.0, r0=1.0)
+        angle = md.angle.Harmonic()
+        angle.params['A-A-A'] = dict(k=10.0, t0=2.0)
+        dihedral = md.dihedral.Periodic()
+        dihedral.params['A-A-A-A'] = dict(k=3.0, d=-1, n=3, phi0=0)
+        improper = md.improper.Harmonic()
+        improper.params['A-A-A-A'] = dict(k=5.0, chi0=0.5)
+        special_pair = md.special_pair.LJ()
+        special_pair.params['A-A'] = dict(epsilon=1.0, sigma=1.0)
+        special_pair.r_cut['A-A'] = 5.0
+
+        width = 1001
+        bond_table = md.bond.Table(width=width)
+        r = np.linspace(0.2, 3.0, width)
+        bond_table.params['A-A'] = dict(r_min=0.2,
+                                        r_max=3.0,
+                                        U=0.5 * 30.0 * (r - 1.0)**2,
+                                        F=-30.0 * (r - 1.0))
+        angle_table = md.angle.Table(width=width)
+        theta = np.linspace(0, np.pi, width)
+        angle_table.params['A-A-A'] = dict(U=0.5 * 10.0 * (theta - 2.0)**2,
+                                           tau=-10.0 * (theta - 2.0))
+        dihedral_table = md.dihedral.Table(width=width)
+        phi = np.linspace(-np.pi, np.pi, width)
+        dihedral_table.params['A-A-A-A'] = dict(U=1.5 * (1 + np.cos(3 * phi)),
+                                                tau=4.5 * np.sin(3 * phi))
+
+        forces = [
+            harmonic, angle, dihedral, improper, special_pair, bond_table,
+            angle_table, dihedral_table
+        ]
+        sim.operations.computes.extend(forces)
+        sim.always_compute_pressure = True
+
+        sim.run(1)
+        return [(f.forces, f.virials, f.energies) for f in forces]
+
+    serial, threaded, repeat = evaluate_cpu_threads(snap, simulate)
+
+    if snap.communicator.rank == 0:
+        for force_serial, force_threaded, force_repeat in zip(
+                serial, threaded, repeat):
+            for array_s, array_t, array_r in zip(force_serial, force_threaded,
+                                                 force_repeat):
+                np.testing.assert_allclose(array_t,
+                                           array_s,
+                                           rtol=1e-6,
+                                           atol=1e-8)
+                np.testing.assert_array_equal(array_r, array_t)
@@ -1,6 +1,11 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+import gc
+import os
+import resource
+import signal
+
 import hoomd
 import numpy as np
 import pytest
@@ -98,6 +103,35 @@ def test_write(simulation_factory, hoomd_snapshot, tmp_path):
             assert_equivalent_snapshots(traj[0], hoomd_snapshot)
 
 
+def test_read(simulation_factory, hoomd_snapshot, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+    sim = simulation_factory(hoomd_snapshot)
+    hoomd.write.GSD.write(state=sim.state, mode='wb', filename=str(filename))
+
+    # with MPI, each rank reads a slice of the file
+    new_sim = simulation_factory()
+    new_sim.create_state_from_gsd(filename=str(filename))
+    snap = new_sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        for prop in ['position', 'velocity', 'typeid', 'charge', 'angmom']:
+            np.testing.assert_allclose(getattr(snap.particles, prop),
+                                       getattr(hoomd_snapshot.particles, prop))
+
+        for name in ['bonds', 'angles', 'dihedrals', 'impropers', 'pairs']:
+            section = getattr(snap, name)
+            reference = getattr(hoomd_snapshot, name)
+            assert section.N == reference.N
+            assert section.types == reference.types
+            np.testing.assert_array_equal(section.typeid, reference.typeid)
+            np.testing.assert_array_equal(section.group, reference.group)
+
+        assert snap.constraints.N == hoomd_snapshot.constraints.N
+        np.testing.assert_array_equal(snap.constraints.group,
+                                      hoomd_snapshot.constraints.group)
+        np.testing.assert_allclose(snap.constraints.value,
+                                   hoomd_snapshot.constraints.value)
+
+
 def test_write_gsd_trigger(create_md_sim, tmp_path):
 
     filename = tmp_path / "temporary_test_file.gsd"
@@ -541,3 +575,154 @@ def test_write_gsd_no_dynamic(simulation_factory, hoomd_snapshot, tmp_path):
             assert not f.chunk_exists(frame=1, name='configuration/box')
             assert not f.chunk_exists(frame=1, name='particles/N')
             assert not f.chunk_exists(frame=1, name='particles/position')
+
+
+def test_write_gsd_async(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'])
+    gsd_writer.async_write = True
+    assert gsd_writer.async_write
+    sim.operations.writers.append(gsd_writer)
+
+    snapshot_list = []
+    for _ in range(5):
+        sim.run(1)
+        snap = sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            snapshot_list.append(snap)
+
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert len(traj) == len(snapshot_list)
+            for gsd_snap, hoomd_snap in zip(traj, snapshot_list):
+                assert_equivalent_snapshots(gsd_snap, hoomd_snap)
+
+    # switch back to synchronous writes after the simulation attaches
+    gsd_writer.async_write = False
+    sim.run(1)
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert len(traj) == len(snapshot_list) + 1
+
+
+@pytest.mark.serial
+def test_write_gsd_async_error(create_md_sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+    message_filename = tmp_path / "messages.log"
+
+    sim = create_md_sim
+    sim.device.message_filename = str(message_filename)
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'])
+    gsd_writer.async_write = True
+    sim.operations.writers.append(gsd_writer)
+    sim.run(1)
+    gsd_writer.flush()
+
+    # Limit the file size so that writing the remaining frames fails. The
+    # frames are buffered, so the error surfaces when the writer is destroyed.
+    old_limit = resource.getrlimit(resource.RLIMIT_FSIZE)
+    old_handler = signal.signal(signal.SIGXFSZ, signal.SIG_IGN)
+    try:
+        resource.setrlimit(resource.RLIMIT_FSIZE,
+                           (os.path.getsize(filename), old_limit[1]))
+        sim.run(5)
+        sim.operations.writers.remove(gsd_writer)
+        del gsd_writer
+        gc.collect()
+    finally:
+        resource.setrlimit(resource.RLIMIT_FSIZE, old_limit)
+        signal.signal(signal.SIGXFSZ, old_handler)
+        sim.device.message_filename = None
+
+    assert "GSD:" in message_filename.read_text()
+
+
+@pytest.mark.parametrize("quantize_position_bits", [0, 20])
+def test_write_gsd_compression(create_md_sim, tmp_path,
+                               quantize_position_bits):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'],
+                                 compression=True,
+                                 quantize_position_bits=quantize_position_bits)
+    sim.operations.writers.append(gsd_writer)
+
+    snapshot_list = []
+    for _ in range(3):
+        sim.run(1)
+        snap = sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            snapshot_list.append(snap)
+
+    gsd_writer.flush()
+    assert gsd_writer.compression
+    assert gsd_writer.quantize_position_bits == quantize_position_bits
+    assert gsd_writer.compression_ratio > 1
+    assert gsd_writer.write_throughput > 0
+    with pytest.raises(hoomd.error.MutabilityError):
+        gsd_writer.compression = False
+
+    # readers of the hoomd schema refuse the file instead of missing chunks
+    if sim.device.communicator.rank == 0:
+        with pytest.raises(RuntimeError):
+            gsd.hoomd.open(name=filename, mode='r')
+
+    # HOOMD reads the compressed chunks transparently
+    box_length = sim.state.box.Lx
+    for i in range(3):
+        new_sim = hoomd.Simulation(device=sim.device)
+        new_sim.create_state_from_gsd(filename=filename, frame=i)
+        snap = new_sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            reference = snapshot_list[i]
+            if quantize_position_bits == 0:
+                np.testing.assert_array_equal(snap.particles.position,
+                                              reference.particles.position)
+            else:
+                np.testing.assert_allclose(snap.particles.position,
+                                           reference.particles.position,
+                                           rtol=0,
+                                           atol=box_length
+                                           / 2**quantize_position_bits)
+            np.testing.assert_array_equal(snap.particles.velocity,
+                                          reference.particles.velocity)
+            np.testing.assert_array_equal(snap.particles.typeid,
+                                          reference.particles.typeid)
+            np.testing.assert_array_equal(snap.particles.image,
+                                          reference.particles.image)
+
+
+# only the root rank opens the file and raises
+@pytest.mark.serial
+def test_write_gsd_compression_append(create_md_sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    hoomd.write.GSD.write(state=sim.state, mode='wb', filename=filename)
+
+    # the existing file cannot be marked as compressed
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='ab',
+                                 compression=True)
+    sim.operations.writers.append(gsd_writer)
+    with pytest.raises(RuntimeError):
+        sim.run(0)
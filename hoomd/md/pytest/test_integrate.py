@@ -152,6 +152,89 @@ def test_linear_momentum(simulation_factory, lattice_snapshot_factory):
         numpy.testing.assert_allclose(linear_momentum, reference)
 
 
+@pytest.mark.parametrize("pressure", [False, True])
+def test_fuse_net_force(simulation_factory, lattice_snapshot_factory,
+                        pressure):
+    """Test that fusing the net force sum matches the separate sum."""
+    results = []
+    for fuse_net_force in (False, True):
+        sim = simulation_factory(lattice_snapshot_factory(n=6, a=1.2, r=0.1))
+        sim.always_compute_pressure = pressure
+        nlist = md.nlist.Cell(buffer=0.4)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = dict(epsilon=1.0, sigma=1.0)
+        gauss = md.pair.Gaussian(nlist, default_r_cut=3.0)
+        gauss.params[("A", "A")] = dict(epsilon=0.5, sigma=1.0)
+        thermo = md.compute.ThermodynamicQuantities(hoomd.filter.All())
+        integrator = md.Integrator(
+            0.005,
+            methods=[md.methods.ConstantVolume(hoomd.filter.All())],
+            forces=[lj, gauss],
+            fuse_net_force=fuse_net_force)
+        assert integrator.fuse_net_force == fuse_net_force
+        sim.operations.integrator = integrator
+        sim.operations.computes.append(thermo)
+        sim.run(10)
+
+        result = dict(potential_energy=thermo.potential_energy,
+                      lj_energy=lj.energy,
+                      lj_forces=lj.forces,
+                      gauss_energies=gauss.energies)
+        if pressure:
+            result['pressure_tensor'] = thermo.pressure_tensor
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            result['position'] = snapshot.particles.position
+        results.append(result)
+
+    if sim.device.communicator.rank == 0:
+        for key in results[0]:
+            numpy.testing.assert_allclose(results[1][key],
+                                          results[0][key],
+                                          rtol=1e-5,
+                                          atol=1e-6)
+
+
+@pytest.mark.parametrize("pressure", [False, True])
+def test_overlap_communication(simulation_factory, lattice_snapshot_factory,
+                               pressure):
+    """Test that overlapping the ghost update matches the blocking update."""
+    results = []
+    for overlap_communication in (False, True):
+        sim = simulation_factory(lattice_snapshot_factory(n=8, a=1.2, r=0.1))
+        sim.always_compute_pressure = pressure
+        nlist = md.nlist.Cell(buffer=0.4)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = dict(epsilon=1.0, sigma=1.0)
+        thermo = md.compute.ThermodynamicQuantities(hoomd.filter.All())
+        integrator = md.Integrator(
+            0.005,
+            methods=[md.methods.ConstantVolume(hoomd.filter.All())],
+            forces=[lj],
+            overlap_communication=overlap_communication)
+        assert integrator.overlap_communication == overlap_communication
+        sim.operations.integrator = integrator
+        sim.operations.computes.append(thermo)
+        sim.run(20)
+
+        result = dict(potential_energy=thermo.potential_energy,
+                      lj_energies=lj.energies,
+                      lj_forces=lj.forces)
+        if pressure:
+            result['pressure_tensor'] = thermo.pressure_tensor
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            result['position'] = snapshot.particles.position
+        results.append(result)
+
+    if sim.device.communicator.rank == 0:
+        for key in results[0]:
+            numpy.testing.assert_allclose(results[1][key],
+                                          results[0][key],
+                                          rtol=1e-5,
+                                          atol=1e-6)
+
+
 def test_pickling(make_simulation, integrator_elements):
     sim = make_simulation()
     integrator = hoomd.md.Integrator(0.005, **integrator_elements)
@@ -0,0 +1,189 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import numpy as np
+import pytest
+
+from hoomd.conftest import operation_pickling_check
+import hoomd
+import hoomd.write
+
+
+def lj_integrator():
+    integrator = hoomd.md.Integrator(dt=0.005)
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4),
+                          default_r_cut=2.5)
+    lj.params.default = {'sigma': 1, 'epsilon': 1}
+    integrator.forces.append(lj)
+    langevin = hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1)
+    integrator.methods.append(langevin)
+
+    return integrator
+
+
+@pytest.fixture(scope='function')
+def create_md_sim(simulation_factory, device, two_particle_snapshot_factory):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.integrator = lj_integrator()
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    return sim, thermo
+
+
+def test_reject_categories():
+    logger = hoomd.logging.Logger(categories=['particle'])
+    with pytest.raises(ValueError):
+        hoomd.write.LogBuffer(1, logger)
+
+
+def test_read_only_attrs():
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    log_buffer = hoomd.write.LogBuffer(1, logger, capacity=8)
+    assert log_buffer.capacity == 8
+    with pytest.raises(ValueError):
+        log_buffer.capacity = 16
+
+
+def test_pickling(simulation_factory, two_particle_snapshot_factory):
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    sim = simulation_factory(two_particle_snapshot_factory())
+    log_buffer = hoomd.write.LogBuffer(1, logger)
+    operation_pickling_check(log_buffer, sim)
+
+
+def test_non_native_quantity(create_md_sim):
+    sim, thermo = create_md_sim
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    logger.add(sim, quantities=['tps'])
+    sim.operations.writers.append(hoomd.write.LogBuffer(1, logger))
+    with pytest.raises(ValueError):
+        sim.run(0)
+
+
+def test_ring_buffer(create_md_sim):
+    sim, thermo = create_md_sim
+    lj = sim.operations.integrator.forces[0]
+
+    logger = hoomd.logging.Logger(categories=['scalar', 'sequence'])
+    logger.add(sim, quantities=['timestep'])
+    logger.add(thermo,
+               quantities=['kinetic_energy', 'pressure_tensor',
+                           'num_particles'])
+    logger.add(lj, quantities=['energy'])
+
+    log_buffer = hoomd.write.LogBuffer(1, logger, capacity=4)
+    sim.operations.writers.append(log_buffer)
+
+    timesteps = []
+    kinetic_energy = []
+    pressure_tensor = []
+    energy = []
+    for _ in range(6):
+        sim.run(1)
+        timesteps.append(sim.timestep)
+        kinetic_energy.append(thermo.kinetic_energy)
+        pressure_tensor.append(thermo.pressure_tensor)
+        energy.append(lj.energy)
+
+    # the buffer keeps the last 4 samples in chronological order
+    np.testing.assert_array_equal(log_buffer.timesteps, timesteps[-4:])
+
+    data = log_buffer.data
+    np.testing.assert_array_equal(data['Simulation']['timestep'],
+                                  timesteps[-4:])
+    thermo_data = data['md']['compute']['ThermodynamicQuantities']
+    np.testing.assert_allclose(thermo_data['kinetic_energy'],
+                               kinetic_energy[-4:])
+    assert thermo_data['pressure_tensor'].shape == (4, 6)
+    np.testing.assert_allclose(thermo_data['pressure_tensor'],
+                               pressure_tensor[-4:])
+    np.testing.assert_array_equal(thermo_data['num_particles'], [2] * 4)
+    np.testing.assert_allclose(data['md']['pair']['LJ']['energy'], energy[-4:])
+
+
+def test_write(create_md_sim, tmp_path):
+    h5py = pytest.importorskip("h5py")
+    filename = tmp_path / "temporary_test_file.h5"
+    sim, thermo = create_md_sim
+
+    logger = hoomd.logging.Logger(categories=['scalar', 'sequence'])
+    logger.add(thermo, quantities=['kinetic_energy', 'pressure_tensor'])
+
+    # the buffer is smaller than the number of samples so that it flushes
+    # during the run
+    log_buffer = hoomd.write.LogBuffer(1,
+                                       logger,
+                                       capacity=3,
+                                       filename=filename)
+    sim.operations.writers.append(log_buffer)
+
+    kinetic_energy = []
+    for _ in range(7):
+        sim.run(1)
+        kinetic_energy.append(thermo.kinetic_energy)
+
+    log_buffer.flush()
+
+    if sim.device.communicator.rank == 0:
+        key = 'hoomd-data/md/compute/ThermodynamicQuantities'
+        with h5py.File(filename, mode='r') as fh:
+            assert fh['hoomd-data'].attrs['frames'] == 7
+            np.testing.assert_allclose(fh[key + '/kinetic_energy'],
+                                       kinetic_energy)
+            assert fh[key + '/pressure_tensor'].shape == (7, 6)
+
+
+def test_copies(create_md_sim):
+    sim, thermo = create_md_sim
+
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    logger.add(thermo, quantities=['kinetic_energy'])
+    log_buffer = hoomd.write.LogBuffer(1, logger, capacity=2)
+    sim.operations.writers.append(log_buffer)
+
+    sim.run(2)
+    timesteps = log_buffer.timesteps
+    kinetic_energy = log_buffer.data['md']['compute'][
+        'ThermodynamicQuantities']['kinetic_energy']
+    expected_timesteps = timesteps.copy()
+    expected_kinetic_energy = kinetic_energy.copy()
+
+    # later samples overwrite the ring buffer, but not the returned arrays
+    sim.run(2)
+    np.testing.assert_array_equal(timesteps, expected_timesteps)
+    np.testing.assert_array_equal(kinetic_energy, expected_kinetic_energy)
+    assert not np.array_equal(log_buffer.timesteps, expected_timesteps)
+
+
+def test_write_error(create_md_sim, tmp_path):
+    h5py = pytest.importorskip("h5py")
+    filename = tmp_path / "temporary_test_file.h5"
+    sim, thermo = create_md_sim
+
+    # a file without the hoomd-schema attribute fails validation on rank 0
+    if sim.device.communicator.rank == 0:
+        with h5py.File(filename, mode='w') as fh:
+            fh.create_group('hoomd-data')
+
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    logger.add(thermo, quantities=['kinetic_energy'])
+    log_buffer = hoomd.write.LogBuffer(1,
+                                       logger,
+                                       capacity=4,
+                                       filename=filename)
+    sim.operations.writers.append(log_buffer)
+    sim.run(2)
+
+    # every rank raises, so that the ranks do not deadlock
+    with pytest.raises(RuntimeError):
+        log_buffer.flush()
+
+    # the samples stay unflushed and are written once the error is resolved
+    if sim.device.communicator.rank == 0:
+        filename.unlink()
+    log_buffer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with h5py.File(filename, mode='r') as fh:
+            assert fh['hoomd-data'].attrs['frames'] == 2
@@ -297,6 +297,57 @@ class TestMethods:
         for v in npt.barostat_dof:
             assert v != 0.0
 
+    def test_checkpoint(self, device, simulation_factory,
+                        two_particle_snapshot_factory, tmp_path):
+        """Tests that checkpoints restore the integrator degrees of freedom."""
+
+        def make_integrator():
+            thermostat = hoomd.md.methods.thermostats.MTTK(1.5, 0.05)
+            npt = hoomd.md.methods.ConstantPressure(filter=hoomd.filter.All(),
+                                                    thermostat=thermostat,
+                                                    S=1.0,
+                                                    tauS=2.0,
+                                                    couple='xyz')
+            return hoomd.md.Integrator(0.005, methods=[npt])
+
+        sim = simulation_factory(two_particle_snapshot_factory())
+        sim.operations.integrator = make_integrator()
+        sim.run(0)
+        npt = sim.operations.integrator.methods[0]
+        npt.thermostat.thermalize_dof()
+        npt.thermalize_barostat_dof()
+        sim.run(5)
+
+        filename = tmp_path / 'checkpoint'
+        sim.write_checkpoint(filename)
+        translational_dof = npt.thermostat.translational_dof
+        barostat_dof = npt.barostat_dof
+
+        new_sim = hoomd.Simulation(device)
+        new_sim.create_state_from_checkpoint(filename)
+        new_sim.operations.integrator = make_integrator()
+        new_sim.run(0)
+        new_npt = new_sim.operations.integrator.methods[0]
+        np.testing.assert_allclose(new_npt.thermostat.translational_dof,
+                                   translational_dof)
+        np.testing.assert_allclose(new_npt.barostat_dof, barostat_dof)
+
+        sim.run(5)
+        new_sim.run(5)
+        snap = sim.state.get_snapshot()
+        new_snap = new_sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            np.testing.assert_allclose(new_snap.particles.position,
+                                       snap.particles.position)
+            np.testing.assert_allclose(new_snap.particles.velocity,
+                                       snap.particles.velocity)
+
+        # the operations must match the checkpoint
+        other_sim = hoomd.Simulation(device)
+        other_sim.create_state_from_checkpoint(filename)
+        with pytest.raises(RuntimeError):
+            other_sim.run(0)
+
     def test_constant_pressure_attributes_attached_2d(
             self, simulation_factory, two_particle_snapshot_factory):
         """Test attributes of ConstantPressure specific to 2D simulations."""
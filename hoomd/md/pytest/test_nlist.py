@@ -62,6 +62,7 @@ def test_common_params(nlist_params):
         "exclusions": ('bond',),
         "rebuild_check_delay": 1,
         "check_dist": True,
+        "sort": 'none',
     }
     _assert_nlist_params(nlist, default_params_dict)
     new_params_dict = {
@@ -76,6 +77,8 @@ def test_common_params(nlist_params):
             np.random.randint(8),
         "check_dist":
             False,
+        "sort":
+            random.choice(['none', 'index', 'type']),
     }
     for param in new_params_dict.keys():
         setattr(nlist, param, new_params_dict[param])
@@ -124,6 +127,79 @@ def test_simple_simulation(nlist_params, simulation_factory,
                                      activate=lambda: sim.run(1))
 
 
+@pytest.mark.cpu
+@pytest.mark.parametrize("sort", ['index', 'type'])
+def test_sort(nlist_params, simulation_factory, lattice_snapshot_factory,
+              sort):
+    """Test that sorted neighbor lists hold the same pairs in sorted order."""
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(n=6,
+                                    a=1.1,
+                                    r=0.1,
+                                    particle_types=['A', 'B'])
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[:] = np.random.default_rng(3).integers(
+            0, 2, snap.particles.N)
+    sim = simulation_factory(snap)
+
+    nlists = [
+        nlist_cls(**required_args, buffer=0.4),
+        nlist_cls(**required_args, buffer=0.4, sort=sort)
+    ]
+    forces = []
+    for nlist in nlists:
+        lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+        lj.params.default = dict(epsilon=1, sigma=1)
+        forces.append(lj)
+    sim.operations.computes.extend(forces)
+    sim.run(0)
+
+    assert nlists[1].sort == sort
+    with nlists[1].cpu_local_nlist_arrays as data:
+        with sim.state.cpu_local_snapshot as snap_data:
+            typeid = snap_data.particles.typeid_with_ghost
+            for head, nn in zip(data.head_list, data.n_neigh):
+                neighbors = np.array(data.nlist[head:head + nn])
+                if sort == 'type':
+                    key = typeid[neighbors].astype(np.int64) * len(
+                        typeid) + neighbors
+                else:
+                    key = neighbors
+                assert np.all(np.diff(key) > 0)
+
+    unsorted_forces = forces[0].forces
+    sorted_forces = forces[1].forces
+    if unsorted_forces is not None:
+        np.testing.assert_allclose(sorted_forces,
+                                   unsorted_forces,
+                                   rtol=1e-6,
+                                   atol=1e-8)
+
+
+@pytest.mark.gpu
+def test_sort_gpu(nlist_params, simulation_factory,
+                  two_particle_snapshot_factory):
+    """Test that sorting is rejected on the GPU."""
+    nlist_cls, required_args = nlist_params
+    sim = simulation_factory(two_particle_snapshot_factory())
+    nlist = nlist_cls(**required_args, buffer=0.4, sort='index')
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+    lj.params.default = dict(epsilon=1, sigma=1)
+    sim.operations.computes.append(lj)
+    with pytest.raises(RuntimeError):
+        sim.run(0)
+
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+    lj.params.default = dict(epsilon=1, sigma=1)
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.computes.append(lj)
+    sim.run(0)
+    with pytest.raises(RuntimeError):
+        nlist.sort = 'type'
+    assert nlist.sort == 'none'
+
+
 def test_auto_detach_simulation(simulation_factory,
                                 two_particle_snapshot_factory):
     nlist = Cell(buffer=0.4)
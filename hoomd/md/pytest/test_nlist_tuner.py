@@ -124,3 +124,75 @@ class TestMoveSize:
 
     def test_pickling(self, nlist_tuner, simulation):
         operation_pickling_check(nlist_tuner, simulation)
+
+
+class TestNeighborListAdaptive:
+
+    def test_valid_construction(self, nlist):
+        attrs = {
+            "trigger": 5,
+            "nlist": nlist,
+            "maximum_buffer": 1.0,
+            "minimum_buffer": 0.1,
+            "max_change": 0.1
+        }
+        tuner = md.tune.NeighborListAdaptive(**attrs)
+        for attr, value in attrs.items():
+            tuner_attr = getattr(tuner, attr)
+            if attr == 'trigger':
+                assert tuner_attr.period == value
+            else:
+                assert tuner_attr is value or tuner_attr == value
+
+    def test_act(self, nlist, simulation):
+        tuner = md.tune.NeighborListAdaptive(trigger=20,
+                                             nlist=nlist,
+                                             maximum_buffer=1.0,
+                                             minimum_buffer=0.2)
+        simulation.operations.tuners.append(tuner)
+        if isinstance(simulation.device, hoomd.device.GPU):
+            with pytest.raises(ValueError):
+                simulation.run(0)
+            return
+
+        simulation.run(200)
+        assert tuner.build_period > 0
+        assert 0 <= tuner.build_fraction <= 1
+        assert 0.2 <= nlist.buffer <= 1.0
+        assert nlist.rebuild_check_delay >= 1
+
+    def test_stencil(self, simulation_factory, lattice_snapshot_factory):
+        nlist = md.nlist.Stencil(buffer=0.4, cell_width=1.0)
+        snap = lattice_snapshot_factory(dimensions=2, r=1e-3, n=20)
+        sim = simulation_factory(snap)
+        if isinstance(sim.device, hoomd.device.GPU):
+            pytest.skip("NeighborListAdaptive is not supported on the GPU")
+        lj = md.pair.LJ(nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = {"sigma": 1.0, "epsilon": 1.0}
+        thermostat = hoomd.md.methods.thermostats.MTTK(kT=1.0, tau=1.0)
+        sim.operations.integrator = md.Integrator(
+            dt=0.005,
+            methods=[md.methods.ConstantVolume(hoomd.filter.All(), thermostat)],
+            forces=[lj])
+        # fix the buffer so that the tuner explores the cell widths only once
+        tuner = md.tune.NeighborListAdaptive(trigger=20,
+                                             nlist=nlist,
+                                             maximum_buffer=0.4,
+                                             minimum_buffer=0.4)
+        sim.operations.tuners.append(tuner)
+        sim.run(120)
+
+        # The tuner keeps the fastest of the widths 1, 1/2, and 1/3 of the
+        # list radius. The C++ unit tests check the choice with injected times.
+        assert nlist.buffer == pytest.approx(0.4)
+        r_list = 2.5 + 0.4
+        assert any(
+            nlist.cell_width == pytest.approx(r_list / i) for i in (1, 2, 3))
+
+    def test_pickling(self, nlist, simulation):
+        tuner = md.tune.NeighborListAdaptive(trigger=5,
+                                             nlist=nlist,
+                                             maximum_buffer=1.0)
+        if isinstance(simulation.device, hoomd.device.GPU):
+            pytest.skip("NeighborListAdaptive is not supported on the GPU")
+        operation_pickling_check(tuner, simulation)
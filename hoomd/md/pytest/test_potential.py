@@ -1377,3 +1377,219 @@ def test_shift(simulation_factory, two_particle_snapshot_factory,
     # is much closer to 0 than V.
     tolerance = max(math.fabs(V / 1e4), 1e-8)
     assert V_shifted == pytest.approx(expected=0, abs=tolerance)
+
+
+@pytest.mark.cpu
+@pytest.mark.parametrize("mode", ["half", "full"])
+def test_cpu_threads(evaluate_cpu_threads, lattice_snapshot_factory, mode):
+    """Test that threaded pair forces match the serial computation."""
+
+    def simulate(sim):
+        lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(sigma=1.0, epsilon=1.0)
+        sim.operations.computes.append(lj)
+        sim.always_compute_pressure = True
+        sim.run(0)
+
+        # Pair potentials use a half neighbor list on the CPU.
+        lj.nlist._cpp_obj.setStorageMode(
+            getattr(md._md.NeighborList.storageMode, mode))
+        sim.run(1)
+        return lj.forces, lj.virials
+
+    snapshot = lattice_snapshot_factory(n=6, a=1.1, r=0.1)
+    serial, threaded, repeat = evaluate_cpu_threads(snapshot, simulate)
+
+    if snapshot.communicator.rank == 0:
+        for i in range(2):
+            np.testing.assert_allclose(threaded[i],
+                                       serial[i],
+                                       rtol=1e-6,
+                                       atol=1e-8)
+            np.testing.assert_array_equal(repeat[i], threaded[i])
+
+
+@pytest.mark.parametrize("mode", ["none", "shift", "xplor"])
+def test_tabulation(simulation_factory, lattice_snapshot_factory, mode):
+    """Test that tabulated pair forces match the analytic form."""
+    snap = lattice_snapshot_factory(n=6, a=1.1, r=0.1)
+    sim = simulation_factory(snap)
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("Tabulation applies only to the CPU")
+
+    mie = md.pair.Mie(nlist=md.nlist.Cell(buffer=0.4),
+                      default_r_cut=2.5,
+                      default_r_on=2.0,
+                      mode=mode)
+    mie.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0, n=12.5, m=6.5)
+    sim.operations.computes.append(mie)
+    sim.always_compute_pressure = True
+
+    sim.run(1)
+    forces_analytic = mie.forces
+    energies_analytic = mie.energies
+    virials_analytic = mie.virials
+    assert mie.tabulation_accuracy[('A', 'A')]['r_min'] == pytest.approx(2.5)
+
+    mie.tabulation_tolerance = 1e-6
+    sim.run(1)
+    accuracy = mie.tabulation_accuracy[('A', 'A')]
+    assert accuracy['r_min'] < 1.0
+    assert accuracy['error'] <= 1e-6
+
+    forces_tabulated = mie.forces
+    energies_tabulated = mie.energies
+    virials_tabulated = mie.virials
+    if forces_analytic is not None:
+        np.testing.assert_allclose(forces_tabulated,
+                                   forces_analytic,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+        np.testing.assert_allclose(energies_tabulated,
+                                   energies_analytic,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+        np.testing.assert_allclose(virials_tabulated,
+                                   virials_analytic,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+def _brute_force_pair(snapshot, r_cut, r_on, mode, force_divr_energy):
+    """Compute reference pair forces and energies with numpy."""
+    pos = snapshot.particles.position
+    L = np.array([snapshot.configuration.box[0:3]])
+    dr = pos[:, np.newaxis, :] - pos[np.newaxis, :, :]
+    dr -= L * np.round(dr / L)
+    rsq = np.sum(dr * dr, axis=2)
+    np.fill_diagonal(rsq, 2 * r_cut * r_cut)
+    inside = rsq < r_cut * r_cut
+    r = np.sqrt(np.where(inside, rsq, 1.0))
+
+    force_divr, energy = force_divr_energy(r)
+    if mode == 'shift':
+        energy = energy - force_divr_energy(np.array(r_cut))[1]
+    elif mode == 'xplor':
+        denom = (r_cut**2 - r_on**2)**3
+        s = (r_cut**2 - rsq)**2 * (r_cut**2 + 2 * rsq - 3 * r_on**2) / denom
+        ds_dr_divr = 12 * (r_cut**2 - rsq) * (r_on**2 - rsq) / denom
+        smooth = rsq > r_on * r_on
+        force_divr = np.where(smooth, s * force_divr - ds_dr_divr * energy,
+                              force_divr)
+        energy = np.where(smooth, s * energy, energy)
+
+    force_divr = np.where(inside, force_divr, 0)
+    energy = np.where(inside, energy, 0)
+    forces = np.sum(force_divr[:, :, np.newaxis] * dr, axis=1)
+    energies = 0.5 * np.sum(energy, axis=1)
+    return forces, energies
+
+
+def _lj_reference(r):
+    r6inv = r**-6
+    return 24 * r6inv * (2 * r6inv - 1) / r**2, 4 * r6inv * (r6inv - 1)
+
+
+def _gauss_reference(r):
+    energy = np.exp(-0.5 * r**2 / 0.8**2)
+    return energy / 0.8**2, energy
+
+
+def _yukawa_reference(r):
+    energy = 1.5 * np.exp(-0.7 * r) / r
+    return energy * (0.7 * r + 1) / r**2, energy
+
+
+def _expanded_lj_reference(r):
+    force_divr, energy = _lj_reference(r - 0.2)
+    return force_divr * (r - 0.2) / r, energy
+
+
+@pytest.mark.parametrize("mode", ['none', 'shift', 'xplor'])
+@pytest.mark.parametrize(
+    "pair_potential, params, reference",
+    [(md.pair.LJ, dict(epsilon=1.0, sigma=1.0), _lj_reference),
+     (md.pair.Gaussian, dict(epsilon=1.0, sigma=0.8), _gauss_reference),
+     (md.pair.Yukawa, dict(epsilon=1.5, kappa=0.7), _yukawa_reference),
+     (md.pair.ExpandedLJ, dict(epsilon=1.0, sigma=1.0,
+                               delta=0.2), _expanded_lj_reference)],
+    ids=["LJ", "Gaussian", "Yukawa", "ExpandedLJ"])
+def test_dense_pair_forces(simulation_factory, lattice_snapshot_factory,
+                           pair_potential, params, reference, mode):
+    """Test pair forces in a dense system against a brute force reference.
+
+    Each particle has many neighbors, so this exercises the batched CPU pair
+    evaluation, including partially filled batches.
+    """
+    r_cut = 2.5
+    r_on = 2.0
+    snap = lattice_snapshot_factory(n=5, a=1.2, r=0.1)
+    sim = simulation_factory(snap)
+
+    potential = pair_potential(nlist=md.nlist.Cell(buffer=0.4),
+                               default_r_cut=r_cut,
+                               default_r_on=r_on,
+                               mode=mode)
+    potential.params[('A', 'A')] = params
+    sim.operations.computes.append(potential)
+    sim.run(0)
+
+    forces = potential.forces
+    energies = potential.energies
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        reference_forces, reference_energies = _brute_force_pair(
+            snapshot, r_cut, r_on, mode, reference)
+        np.testing.assert_allclose(forces,
+                                   reference_forces,
+                                   rtol=1e-4,
+                                   atol=1e-5)
+        np.testing.assert_allclose(energies,
+                                   reference_energies,
+                                   rtol=1e-4,
+                                   atol=1e-5)
+
+
+def test_dense_table_forces(simulation_factory, lattice_snapshot_factory):
+    """Test batched Table forces in a dense system against the scalar method.
+
+    The reference linearly interpolates the table the same way as the scalar
+    evaluator: the table ends at zero at r_cut and is zero below r_min.
+    """
+    r_cut = 2.5
+    r_min = 1.05
+    snap = lattice_snapshot_factory(n=5, a=1.2, r=0.1)
+    sim = simulation_factory(snap)
+
+    r_table = np.linspace(r_min, r_cut, 200, endpoint=False)
+    F_table, U_table = _lj_reference(r_table)
+    F_table = F_table * r_table
+
+    table = md.pair.Table(nlist=md.nlist.Cell(buffer=0.4),
+                          default_r_cut=r_cut)
+    table.params[('A', 'A')] = dict(r_min=r_min, U=U_table, F=F_table)
+    sim.operations.computes.append(table)
+    sim.run(0)
+
+    def reference(r):
+        r_points = np.append(r_table, r_cut)
+        energy = np.interp(r, r_points, np.append(U_table, 0))
+        force = np.interp(r, r_points, np.append(F_table, 0))
+        energy = np.where(r < r_min, 0, energy)
+        force = np.where(r < r_min, 0, force)
+        return force / r, energy
+
+    forces = table.forces
+    energies = table.energies
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        reference_forces, reference_energies = _brute_force_pair(
+            snapshot, r_cut, 0, 'none', reference)
+        np.testing.assert_allclose(forces,
+                                   reference_forces,
+                                   rtol=1e-4,
+                                   atol=1e-5)
+        np.testing.assert_allclose(energies,
+                                   reference_energies,
+                                   rtol=1e-4,
+                                   atol=1e-5)
@@ -1146,6 +1146,74 @@ void neighborlist_comparison_test(std::shared_ptr<ExecutionConfiguration> exec_c
         }
     }
 
+#ifdef ENABLE_TBB
+//! Test that a threaded build gives the same neighbors, in the same order, as a serial build
+template<class NL>
+void neighborlist_threaded_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // construct the particle system
+    RandomInitializer init(1000, Scalar(0.2), Scalar(0.9), "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap = init.getSnapshot();
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    std::shared_ptr<NeighborList> nlist(new NL(sysdef, Scalar(0.4)));
+    auto r_cut
+        = std::make_shared<GlobalArray<Scalar>>(nlist->getTypePairIndexer().getNumElements(),
+                                                exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+        h_r_cut.data[0] = 3.0;
+        }
+    nlist->addRCutMatrix(r_cut);
+
+    // build the reference list with one thread
+    exec_conf->setNumThreads(1);
+    nlist->compute(0);
+
+    std::vector<std::vector<unsigned int>> reference(pdata->getN());
+        {
+        ArrayHandle<unsigned int> h_n_neigh(nlist->getNNeighArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_nlist(nlist->getNListArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<size_t> h_head_list(nlist->getHeadList(),
+                                        access_location::host,
+                                        access_mode::read);
+        for (unsigned int i = 0; i < pdata->getN(); i++)
+            {
+            reference[i].assign(h_nlist.data + h_head_list.data[i],
+                                h_nlist.data + h_head_list.data[i] + h_n_neigh.data[i]);
+            }
+        }
+
+    // rebuild with several threads and compare
+    exec_conf->setNumThreads(4);
+    nlist->forceUpdate();
+    nlist->compute(1);
+
+    ArrayHandle<unsigned int> h_n_neigh(nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        {
+        UP_ASSERT_EQUAL((size_t)h_n_neigh.data[i], reference[i].size());
+        for (unsigned int j = 0; j < h_n_neigh.data[i]; ++j)
+            {
+            UP_ASSERT_EQUAL(h_nlist.data[h_head_list.data[i] + j], reference[i][j]);
+            }
+        }
+    }
+#endif
+
 //! Test that a NeighborList can successfully exclude a ridiculously large number of particles
 template<class NL>
 void neighborlist_large_ex_tests(std::shared_ptr<ExecutionConfiguration> exec_conf)
@@ -1564,6 +1632,14 @@ UP_TEST(NeighborListBinned_2d)
     neighborlist_2d_tests<NeighborListBinned>(std::shared_ptr<ExecutionConfiguration>(
         new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+#ifdef ENABLE_TBB
+//! threaded build test case for binned class
+UP_TEST(NeighborListBinned_threaded)
+    {
+    neighborlist_threaded_test<NeighborListBinned>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+#endif
 
 ////////////////////
 // STENCIL CPU
@@ -1624,6 +1700,14 @@ UP_TEST(NeighborListStencil_comparison)
         std::shared_ptr<ExecutionConfiguration>(
             new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+#ifdef ENABLE_TBB
+//! threaded build test case for stencil class
+UP_TEST(NeighborListStencil_threaded)
+    {
+    neighborlist_threaded_test<NeighborListStencil>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+#endif
 
 ///////////////
 // TREE CPU
@@ -1683,6 +1767,14 @@ UP_TEST(NeighborListTree_comparison)
         std::shared_ptr<ExecutionConfiguration>(
             new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+#ifdef ENABLE_TBB
+//! threaded build test case for tree class
+UP_TEST(NeighborListTree_threaded)
+    {
+    neighborlist_threaded_test<NeighborListTree>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+#endif
 
 #ifdef ENABLE_HIP
 ///////////////
@@ -0,0 +1,127 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+
+#include "hoomd/Trigger.h"
+#include "hoomd/md/NeighborListAdaptive.h"
+#include "hoomd/md/NeighborListStencil.h"
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::md;
+
+#include "hoomd/test/upp11_config.h"
+HOOMD_UP_MAIN();
+
+//! NeighborListAdaptive with injected build and force times
+class NeighborListAdaptiveFakeTimes : public NeighborListAdaptive
+    {
+    public:
+    using NeighborListAdaptive::NeighborListAdaptive;
+
+    int64_t build_time = 0; //!< Total build time reported to the tuner
+    int64_t force_time = 0; //!< Total force compute time reported to the tuner
+
+    protected:
+    virtual int64_t getBuildTime()
+        {
+        return build_time;
+        }
+
+    virtual int64_t getForceComputeTime()
+        {
+        return force_time;
+        }
+    };
+
+//! Run the tuner with a build time per build that depends on the cell width
+/*! \param exec_conf Execution configuration
+    \param build_cost Time per build as a function of the cell width divided by the list radius
+    \returns The cell width chosen by the tuner divided by the list radius
+*/
+Scalar run_cell_width_exploration(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                  std::function<int64_t(Scalar)> build_cost)
+    {
+    // particles on a simple cubic lattice
+    const unsigned int n = 6;
+    std::shared_ptr<SystemDefinition> sysdef(
+        new SystemDefinition(n * n * n, BoxDim(Scalar(n * 1.5)), 1, 0, 0, 0, 0, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+        {
+        ArrayHandle<Scalar4> h_pos(pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        for (unsigned int i = 0; i < pdata->getN(); i++)
+            {
+            h_pos.data[i].x = Scalar(1.5) * Scalar(i % n) - Scalar(n * 0.75);
+            h_pos.data[i].y = Scalar(1.5) * Scalar((i / n) % n) - Scalar(n * 0.75);
+            h_pos.data[i].z = Scalar(1.5) * Scalar(i / (n * n)) - Scalar(n * 0.75);
+            h_pos.data[i].w = __int_as_scalar(0);
+            }
+        pdata->notifyParticleSort();
+        }
+
+    auto nlist = std::make_shared<NeighborListStencil>(sysdef, Scalar(0.4));
+    auto r_cut
+        = std::make_shared<GlobalArray<Scalar>>(nlist->getTypePairIndexer().getNumElements(),
+                                                exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+        h_r_cut.data[0] = Scalar(2.5);
+        }
+    nlist->addRCutMatrix(r_cut);
+    nlist->setDistCheck(false);
+    nlist->setRebuildCheckDelay(1);
+
+    const uint64_t period = 10;
+    auto tuner = std::make_shared<NeighborListAdaptiveFakeTimes>(sysdef,
+                                                                 std::make_shared<PeriodicTrigger>(
+                                                                     period),
+                                                                 nlist,
+                                                                 Scalar(0.0),
+                                                                 Scalar(1.0));
+
+    // the first window starts measuring, the second sets the first width, and the next three
+    // measure the three widths
+    const Scalar r_list = nlist->getMaxRList();
+    uint64_t last_builds = 0;
+    for (uint64_t timestep = 0; timestep <= 4 * period; timestep++)
+        {
+        if (timestep % period == 0)
+            {
+            uint64_t builds = nlist->getNumUpdates() - last_builds;
+            last_builds = nlist->getNumUpdates();
+            tuner->build_time += int64_t(builds) * build_cost(nlist->getCellWidth() / r_list);
+            tuner->force_time += tuner->build_time + int64_t(period) * 1000;
+            tuner->update(timestep);
+            }
+        nlist->compute(timestep);
+        }
+
+    return nlist->getCellWidth() / r_list;
+    }
+
+//! Check that the tuner keeps the cell width with the shortest build time
+UP_TEST(NeighborListAdaptive_cell_width)
+    {
+    auto exec_conf = std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+
+    auto fastest_half = [](Scalar width)
+    { return std::abs(width - Scalar(0.5)) < Scalar(0.01) ? int64_t(100) : int64_t(1000); };
+    MY_CHECK_CLOSE(run_cell_width_exploration(exec_conf, fastest_half), 0.5, 1e-3);
+
+    auto fastest_third = [](Scalar width)
+    { return width < Scalar(0.4) ? int64_t(100) : int64_t(1000); };
+    MY_CHECK_CLOSE(run_cell_width_exploration(exec_conf, fastest_third), 1.0 / 3.0, 1e-3);
+
+    auto fastest_full = [](Scalar width)
+    { return width > Scalar(0.9) ? int64_t(100) : int64_t(1000); };
+    MY_CHECK_CLOSE(run_cell_width_exploration(exec_conf, fastest_full), 1.0, 1e-3);
+    }
@@ -0,0 +1,132 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Provide an adaptive controller for `hoomd.md.nlist.NeighborList`."""
+
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyTypes
+from hoomd.logging import log
+from hoomd.md import _md
+from hoomd.md.nlist import NeighborList
+from hoomd.operation import Tuner
+
+
+class NeighborListAdaptive(Tuner):
+    r"""Continuously adjust the neighbor list during the run.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps on which to
+            adjust the neighbor list.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to adjust.
+        maximum_buffer (float): The largest buffer value to allow
+            :math:`[\mathrm{length}]`.
+        minimum_buffer (float): The smallest buffer value to allow
+            :math:`[\mathrm{length}]`.
+        max_change (float): Largest relative change of the buffer on one
+            update.
+
+    `NeighborListAdaptive` measures the time spent building the neighbor list,
+    the time spent in the force computes, the number of builds, and the number
+    of dangerous builds over the steps between two trigger steps. On each
+    trigger step, it uses these measurements to adjust `nlist` for the next
+    interval:
+
+    * `NeighborList.buffer <hoomd.md.nlist.NeighborList.buffer>`: Let
+      :math:`t_b` be the time per build, :math:`t_f` the time per step spent
+      in force computes excluding builds, :math:`p` the average number of steps
+      between builds, and :math:`b_0` the current buffer. `NeighborListAdaptive`
+      estimates the cost per step of the buffer :math:`b` as
+
+      .. math::
+
+          C(b) = \left( \frac{r_\mathrm{cut} + b}{r_\mathrm{cut} + b_0}
+                 \right)^3 \left( \frac{t_b}{p} \frac{b_0}{b} + t_f \right)
+
+      and moves the buffer toward the minimum of :math:`C`, changing it by no
+      more than a fraction `max_change` at a time.
+    * `NeighborList.rebuild_check_delay
+      <hoomd.md.nlist.NeighborList.rebuild_check_delay>` (when
+      `NeighborList.check_dist <hoomd.md.nlist.NeighborList.check_dist>` is
+      `True`): A dangerous build halves the delay. Otherwise, the delay grows by
+      one while it is less than a quarter of the shortest observed period
+      between builds.
+    * `Stencil.cell_width <hoomd.md.nlist.Stencil.cell_width>`
+      (`hoomd.md.nlist.Stencil` only):
+      `NeighborListAdaptive` measures the build time with cell widths of 1,
+      1/2, and 1/3 of the largest neighbor list radius on consecutive intervals
+      and keeps the fastest. It holds the buffer fixed while exploring, and
+      explores again after the buffer changes by more than 10%.
+
+    Unlike `NeighborListBuffer`, which searches for the buffer once,
+    `NeighborListAdaptive` keeps adjusting throughout the run. Use it when the
+    density or temperature change during the run, such as in compression or
+    annealing. Choose a trigger period long enough to include several neighbor
+    list builds, such as 1000 steps.
+
+    With MPI, `NeighborListAdaptive` uses the times of the slowest rank.
+
+    Note:
+        `NeighborListAdaptive` is not supported on the GPU.
+
+    Examples::
+
+        nlist_adaptive = hoomd.md.tune.NeighborListAdaptive(
+            trigger=hoomd.trigger.Periodic(1000),
+            nlist=nlist,
+            maximum_buffer=1.0)
+        simulation.operations.tuners.append(nlist_adaptive)
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps on which to
+            adjust the neighbor list.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to adjust.
+        maximum_buffer (float): The largest buffer value to allow
+            :math:`[\mathrm{length}]`.
+        minimum_buffer (float): The smallest buffer value to allow
+            :math:`[\mathrm{length}]`.
+        max_change (float): Largest relative change of the buffer on one
+            update.
+    """
+
+    def __init__(self,
+                 trigger,
+                 nlist,
+                 maximum_buffer,
+                 minimum_buffer=0.0,
+                 max_change=0.2):
+        super().__init__(trigger)
+        params = ParameterDict(nlist=OnlyTypes(NeighborList),
+                               maximum_buffer=float,
+                               minimum_buffer=float,
+                               max_change=float)
+        params.update(
+            dict(nlist=nlist,
+                 maximum_buffer=maximum_buffer,
+                 minimum_buffer=minimum_buffer,
+                 max_change=max_change))
+        self._param_dict.update(params)
+
+    def _attach_hook(self):
+        self.nlist._attach(self._simulation)
+        self._cpp_obj = _md.NeighborListAdaptive(
+            self._simulation.state._cpp_sys_def, self.trigger,
+            self.nlist._cpp_obj, self.minimum_buffer, self.maximum_buffer)
+
+    def _detach_hook(self):
+        self.nlist._detach()
+
+    @log(requires_run=True)
+    def build_period(self):
+        """float: Average number of steps between builds in the last interval.
+
+        The value is the length of the interval when there were no builds.
+        """
+        return self._cpp_obj.build_period
+
+    @log(requires_run=True)
+    def build_fraction(self):
+        """float: Fraction of the force compute time spent in builds.
+
+        Measured over the last interval.
+        """
+        return self._cpp_obj.build_fraction
@@ -7,6 +7,7 @@
 #include "BoxResizeUpdater.h"
 #include "CellList.h"
 #include "CellListStencil.h"
+#include "Checkpoint.h"
 #include "ClockSource.h"
 #include "Compute.h"
 #include "DCDDumpWriter.h"
@@ -20,11 +21,13 @@
 #include "Initializers.h"
 #include "Integrator.h"
 #include "LoadBalancer.h"
+#include "LogBuffer.h"
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
 #include "Messenger.h"
 #include "ParticleData.h"
 #include "ParticleFilterUpdater.h"
+#include "Profiler.h"
 #include "PythonAnalyzer.h"
 #include "PythonLocalDataAccess.h"
 #include "PythonTuner.h"
@@ -229,6 +232,7 @@ PYBIND11_MODULE(_hoomd, m)
     // utils
     export_hoomd_math_functions(m);
     export_ClockSource(m);
+    export_Profiler(m);
 
     // data structures
     export_HOOMDHostBuffer(m);
@@ -287,6 +291,7 @@ PYBIND11_MODULE(_hoomd, m)
 
     // initializers
     export_GSDReader(m);
+    export_Checkpoint(m);
 
     // computes
     export_Autotuned(m);
@@ -311,6 +316,7 @@ PYBIND11_MODULE(_hoomd, m)
     export_DCDDumpWriter(m);
     export_GSDDumpWriter(m);
     export_GSDDequeWriter(m);
+    export_LogBuffer(m);
 
     // updaters
     export_Updater(m);
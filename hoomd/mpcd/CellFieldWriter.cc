@@ -0,0 +1,280 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/CellFieldWriter.cc
+ * \brief Definition of mpcd::CellFieldWriter
+ */
+
+#include "CellFieldWriter.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger that selects the timesteps to sample
+ * \param fname File name
+ * \param mode File open mode ("wb", "xb", or "ab")
+ * \param thermo Cell thermo compute to sample
+ * \param num_samples Number of samples averaged in each frame
+ */
+mpcd::CellFieldWriter::CellFieldWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                       std::shared_ptr<Trigger> trigger,
+                                       const std::string& fname,
+                                       const std::string& mode,
+                                       std::shared_ptr<mpcd::CellThermoCompute> thermo,
+                                       unsigned int num_samples)
+    : mpcd::GSDWriter(sysdef, trigger, fname, mode), m_thermo(thermo),
+      m_cl(thermo->getCellList()), m_num_samples(1), m_num_accumulated(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD CellFieldWriter" << std::endl;
+    setNumSamples(num_samples);
+
+    m_thermo->getFlagsSignal()
+        .connect<mpcd::CellFieldWriter, &mpcd::CellFieldWriter::getRequestedThermoFlags>(this);
+    }
+
+mpcd::CellFieldWriter::~CellFieldWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD CellFieldWriter" << std::endl;
+    m_thermo->getFlagsSignal()
+        .disconnect<mpcd::CellFieldWriter, &mpcd::CellFieldWriter::getRequestedThermoFlags>(this);
+    }
+
+/*!
+ * \param num_samples Number of samples averaged in each frame
+ */
+void mpcd::CellFieldWriter::setNumSamples(unsigned int num_samples)
+    {
+    if (num_samples == 0)
+        {
+        throw std::invalid_argument("The number of samples per frame must be positive.");
+        }
+    m_num_samples = num_samples;
+    }
+
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::CellFieldWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    m_thermo->compute(timestep);
+    sample();
+
+    if (m_num_accumulated >= m_num_samples)
+        {
+        writeFrame(timestep);
+        resetSums();
+        }
+    }
+
+void mpcd::CellFieldWriter::sample()
+    {
+    const unsigned int ncells = m_cl->getNCells();
+    if (ncells != m_sum_momentum.size())
+        {
+        if (m_num_accumulated > 0)
+            {
+            m_exec_conf->msg->warning()
+                << "MPCD cell dimensions changed, discarding " << m_num_accumulated
+                << " samples of the cell field averages." << std::endl;
+            }
+        m_sum_momentum.resize(ncells);
+        m_sum_temperature.resize(ncells);
+        resetSums();
+        }
+
+    ArrayHandle<double4> h_cell_vel(m_thermo->getCellVelocities(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<double3> h_cell_energy(m_thermo->getCellEnergies(),
+                                       access_location::host,
+                                       access_mode::read);
+
+    for (unsigned int idx = 0; idx < ncells; ++idx)
+        {
+        const double4 vel = h_cell_vel.data[idx];
+        double4& momentum = m_sum_momentum[idx];
+        momentum.x += vel.w * vel.x;
+        momentum.y += vel.w * vel.y;
+        momentum.z += vel.w * vel.z;
+        momentum.w += vel.w;
+
+        // temperature is only defined for 2 or more particles
+        const double3 energy = h_cell_energy.data[idx];
+        if (__double_as_int(energy.z) > 1)
+            {
+            m_sum_temperature[idx].x += energy.y;
+            m_sum_temperature[idx].y += 1.0;
+            }
+        }
+
+    ++m_num_accumulated;
+    }
+
+void mpcd::CellFieldWriter::resetSums()
+    {
+    std::fill(m_sum_momentum.begin(), m_sum_momentum.end(), make_double4(0, 0, 0, 0));
+    std::fill(m_sum_temperature.begin(), m_sum_temperature.end(), make_double2(0, 0));
+    m_num_accumulated = 0;
+    }
+
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::CellFieldWriter::writeFrame(uint64_t timestep)
+    {
+    // compute the averages of the local cells
+    const Index3D& ci = m_cl->getCellIndexer();
+    const Index3D& global_ci = m_cl->getGlobalCellIndexer();
+    const uint3 dim = m_cl->getDim();
+    const unsigned int ncells = ci.getNumElements();
+    const double cell_size = m_cl->getCellSize();
+    const double cell_volume
+        = cell_size * cell_size * ((m_sysdef->getNDimensions() == 3) ? cell_size : 1.0);
+    const double mass_norm = 1.0 / (double(m_num_accumulated) * cell_volume);
+
+    m_local_cells.resize(ncells);
+    m_local_values.resize(5 * ncells);
+    for (unsigned int k = 0; k < dim.z; ++k)
+        {
+        for (unsigned int j = 0; j < dim.y; ++j)
+            {
+            for (unsigned int i = 0; i < dim.x; ++i)
+                {
+                const unsigned int idx = ci(i, j, k);
+                const int3 global_cell = m_cl->getGlobalCell(make_int3(i, j, k));
+                m_local_cells[idx] = global_ci(global_cell.x, global_cell.y, global_cell.z);
+
+                const double4 momentum = m_sum_momentum[idx];
+                const double2 temperature = m_sum_temperature[idx];
+                float* values = &m_local_values[5 * idx];
+                values[0] = float(momentum.w * mass_norm);
+                if (momentum.w > 0)
+                    {
+                    values[1] = float(momentum.x / momentum.w);
+                    values[2] = float(momentum.y / momentum.w);
+                    values[3] = float(momentum.z / momentum.w);
+                    }
+                else
+                    {
+                    values[1] = values[2] = values[3] = 0.0f;
+                    }
+                values[4] = (temperature.y > 0) ? float(temperature.x / temperature.y) : 0.0f;
+                }
+            }
+        }
+
+    // gather the averages on the root rank
+    const unsigned int* cells = m_local_cells.data();
+    const float* values = m_local_values.data();
+    unsigned int nrecv = ncells;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+        const unsigned int root = 0;
+        const unsigned int n_ranks = m_exec_conf->getNRanks();
+
+        int nsend = (int)ncells;
+        std::vector<int> counts(n_ranks, 0);
+        std::vector<int> displs(n_ranks, 0);
+        MPI_Gather(&nsend, 1, MPI_INT, counts.data(), 1, MPI_INT, root, mpi_comm);
+        nrecv = 0;
+        for (unsigned int rank = 0; rank < n_ranks; ++rank)
+            {
+            displs[rank] = (int)nrecv;
+            nrecv += counts[rank];
+            }
+        if (m_exec_conf->isRoot())
+            {
+            m_recv_cells.resize(nrecv);
+            m_recv_values.resize(5 * nrecv);
+            }
+
+        MPI_Datatype mpi_values;
+        MPI_Type_contiguous(5, MPI_FLOAT, &mpi_values);
+        MPI_Type_commit(&mpi_values);
+        MPI_Gatherv(m_local_cells.data(),
+                    nsend,
+                    MPI_UNSIGNED,
+                    m_recv_cells.data(),
+                    counts.data(),
+                    displs.data(),
+                    MPI_UNSIGNED,
+                    root,
+                    mpi_comm);
+        MPI_Gatherv(m_local_values.data(),
+                    nsend,
+                    mpi_values,
+                    m_recv_values.data(),
+                    counts.data(),
+                    displs.data(),
+                    mpi_values,
+                    root,
+                    mpi_comm);
+        MPI_Type_free(&mpi_values);
+
+        cells = m_recv_cells.data();
+        values = m_recv_values.data();
+        }
+#endif // ENABLE_MPI
+
+    if (!m_exec_conf->isRoot())
+        return;
+
+    // place the averages in the global fields, cells shared by ranks have the same values
+    const unsigned int nglobal = global_ci.getNumElements();
+    m_density.resize(nglobal);
+    m_velocity.resize(3 * nglobal);
+    m_temperature.resize(nglobal);
+    for (unsigned int n = 0; n < nrecv; ++n)
+        {
+        const unsigned int cell = cells[n];
+        const float* cell_values = &values[5 * n];
+        m_density[cell] = cell_values[0];
+        m_velocity[3 * cell] = cell_values[1];
+        m_velocity[3 * cell + 1] = cell_values[2];
+        m_velocity[3 * cell + 2] = cell_values[3];
+        m_temperature[cell] = cell_values[4];
+        }
+
+    writeFrameHeader(timestep);
+
+    const uint3 global_dim = m_cl->getGlobalDim();
+    const uint32_t dimensions[3] = {global_dim.x, global_dim.y, global_dim.z};
+    writeChunk("mpcd/cell/dimensions", GSD_TYPE_UINT32, 3, 1, dimensions);
+    const float cell_size_f = float(cell_size);
+    writeChunk("mpcd/cell/size", GSD_TYPE_FLOAT, 1, 1, &cell_size_f);
+    const uint32_t num_samples = m_num_accumulated;
+    writeChunk("mpcd/cell/num_samples", GSD_TYPE_UINT32, 1, 1, &num_samples);
+    writeChunk("mpcd/cell/density", GSD_TYPE_FLOAT, nglobal, 1, m_density.data());
+    writeChunk("mpcd/cell/velocity", GSD_TYPE_FLOAT, nglobal, 3, m_velocity.data());
+    writeChunk("mpcd/cell/temperature", GSD_TYPE_FLOAT, nglobal, 1, m_temperature.data());
+
+    endFrame();
+    }
+
+void mpcd::detail::export_CellFieldWriter(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::CellFieldWriter,
+                     mpcd::GSDWriter,
+                     std::shared_ptr<mpcd::CellFieldWriter>>(m, "CellFieldWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            const std::string&,
+                            const std::string&,
+                            std::shared_ptr<mpcd::CellThermoCompute>,
+                            unsigned int>())
+        .def_property("num_samples",
+                      &mpcd::CellFieldWriter::getNumSamples,
+                      &mpcd::CellFieldWriter::setNumSamples)
+        .def_property_readonly("num_accumulated", &mpcd::CellFieldWriter::getNumAccumulated);
+    }
+
+    } // end namespace hoomd
@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/CellFieldWriter.h
+ * \brief Declaration of mpcd::CellFieldWriter
+ */
+
+#ifndef MPCD_CELL_FIELD_WRITER_H_
+#define MPCD_CELL_FIELD_WRITER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "CellThermoCompute.h"
+#include "GSDWriter.h"
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Writes time-averaged MPCD cell fields to a GSD file
+/*!
+ * Each call to analyze() adds the current cell properties from a CellThermoCompute to running
+ * sums. After num_samples samples, the writer writes a frame with the averages and resets the sums:
+ *
+ * - mpcd/cell/dimensions: Number of cells in each direction of the global grid
+ * - mpcd/cell/size: Edge length of a cell
+ * - mpcd/cell/num_samples: Number of samples in the averages
+ * - mpcd/cell/density: Average mass per unit volume of each cell
+ * - mpcd/cell/velocity: Mass-weighted average velocity of each cell
+ * - mpcd/cell/temperature: Average temperature of each cell, over the samples with at least two
+ *   particles in the cell
+ *
+ * The cells are stored in the order of the global cell indexer (x varies fastest). Cell (0,0,0)
+ * has its lower corner at the lower corner of the box. The averages include the embedded particles
+ * and ignore the random grid shifts.
+ *
+ * The running sums are stored per local cell, so the memory per rank does not depend on the
+ * global number of cells. In MPI simulations, the ranks send the averages to the root rank only
+ * when writing a frame. Cells shared by neighboring ranks have the same values on both ranks
+ * because CellThermoCompute reduces them.
+ */
+class PYBIND11_EXPORT CellFieldWriter : public mpcd::GSDWriter
+    {
+    public:
+    //! Constructor
+    CellFieldWriter(std::shared_ptr<SystemDefinition> sysdef,
+                    std::shared_ptr<Trigger> trigger,
+                    const std::string& fname,
+                    const std::string& mode,
+                    std::shared_ptr<mpcd::CellThermoCompute> thermo,
+                    unsigned int num_samples);
+
+    //! Destructor
+    virtual ~CellFieldWriter();
+
+    //! Sample the cell properties and write a frame every num_samples samples
+    virtual void analyze(uint64_t timestep);
+
+    //! Set the number of samples averaged in each frame
+    void setNumSamples(unsigned int num_samples);
+
+    //! Get the number of samples averaged in each frame
+    unsigned int getNumSamples() const
+        {
+        return m_num_samples;
+        }
+
+    //! Get the number of samples in the current running sums
+    unsigned int getNumAccumulated() const
+        {
+        return m_num_accumulated;
+        }
+
+    //! Get the requested thermo flags
+    mpcd::detail::ThermoFlags getRequestedThermoFlags() const
+        {
+        mpcd::detail::ThermoFlags flags;
+        flags[mpcd::detail::thermo_options::energy] = 1;
+        return flags;
+        }
+
+    protected:
+    std::shared_ptr<mpcd::CellThermoCompute> m_thermo; //!< Cell thermo compute
+    std::shared_ptr<mpcd::CellList> m_cl;              //!< Cell list of the thermo compute
+    unsigned int m_num_samples;                        //!< Number of samples per frame
+    unsigned int m_num_accumulated;                    //!< Number of samples in the sums
+
+    std::vector<double4> m_sum_momentum;    //!< Sum of the momentum (xyz) and mass (w) per cell
+    std::vector<double2> m_sum_temperature; //!< Sum of the temperature (x) and samples (y)
+
+    std::vector<unsigned int> m_local_cells; //!< Global index of each local cell
+    std::vector<float> m_local_values;       //!< Averages of each local cell
+    std::vector<unsigned int> m_recv_cells;  //!< Global cell indices received on the root
+    std::vector<float> m_recv_values;        //!< Averages received on the root
+    std::vector<float> m_density;            //!< Global density field (root only)
+    std::vector<float> m_velocity;           //!< Global velocity field (root only)
+    std::vector<float> m_temperature;        //!< Global temperature field (root only)
+
+    //! Add the current cell properties to the sums
+    void sample();
+
+    //! Write a frame with the averages
+    void writeFrame(uint64_t timestep);
+
+    //! Reset the sums
+    void resetSums();
+    };
+
+namespace detail
+    {
+//! Export mpcd::CellFieldWriter to python
+void export_CellFieldWriter(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_CELL_FIELD_WRITER_H_
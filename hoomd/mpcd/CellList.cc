@@ -3,6 +3,13 @@
 
 #include "CellList.h"
 
+#include <algorithm>
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif // ENABLE_TBB
+
 #ifdef ENABLE_MPI
 #include "Communicator.h"
 #include "hoomd/Communicator.h"
@@ -518,7 +525,12 @@ bool mpcd::CellList::isCommunicating(mpcd::detail::face dir)
 #endif // ENABLE_MPI
 
 /*!
- * \param timestep Current simulation timestep
+ * Particles are stored in each cell in order of increasing index, with the MPCD particles first
+ * and then the embedded particles. When TBB is enabled and more than one CPU thread is in use, the
+ * particles are split into one contiguous chunk per thread. Each chunk counts its particles per
+ * cell, an exclusive scan over the chunks gives each chunk its first slot in every cell, and then
+ * the chunks fill their slots concurrently. The resulting cell list is identical to the serial one
+ * for any number of threads.
  */
 void mpcd::CellList::buildCellList()
     {
@@ -575,97 +587,231 @@ void mpcd::CellList::buildCellList()
 
     const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
 
-    for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
-        {
-        Scalar4 postype_i;
-        if (cur_p < N_mpcd)
-            {
-            postype_i = h_pos.data[cur_p];
-            }
-        else
+    // bin particle cur_p and stash its cell into the velocity array or the embedded cell ids
+    auto bin_particle = [&](unsigned int cur_p, uint3& bin_conditions)
+    {
+        const Scalar4 postype_i = (cur_p < N_mpcd)
+                                      ? h_pos.data[cur_p]
+                                      : h_pos_embed->data[h_embed_member_idx->data[cur_p - N_mpcd]];
+        const unsigned int bin_idx = computeParticleBin(cur_p,
+                                                        postype_i,
+                                                        n_global_cells,
+                                                        global_lo,
+                                                        periodic,
+                                                        bin_conditions);
+        if (bin_idx != mpcd::detail::NO_CELL)
             {
-            postype_i = h_pos_embed->data[h_embed_member_idx->data[cur_p - N_mpcd]];
+            if (cur_p < N_mpcd)
+                {
+                h_vel.data[cur_p].w = __int_as_scalar(bin_idx);
+                }
+            else
+                {
+                h_embed_cell_ids->data[cur_p - N_mpcd] = bin_idx;
+                }
             }
-        Scalar3 pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+        return bin_idx;
+    };
 
-        if (std::isnan(pos_i.x) || std::isnan(pos_i.y) || std::isnan(pos_i.z))
-            {
-            conditions.y = cur_p + 1;
-            continue;
-            }
+#ifdef ENABLE_TBB
+    const unsigned int n_threads = m_exec_conf->getNumThreads();
+    if (n_threads > 1)
+        {
+        const unsigned int n_cells = m_cell_indexer.getNumElements();
+        m_particle_bin.resize(N_tot);
+        m_chunk_cell_offset.resize(size_t(n_threads) * n_cells);
+        std::vector<uint3> chunk_conditions(n_threads, make_uint3(0, 0, 0));
 
-        // bin particle assuming orthorhombic box (already validated)
-        const Scalar3 delta = (pos_i - m_grid_shift) - global_lo;
-        int3 global_bin = make_int3((int)std::floor(delta.x / m_cell_size),
-                                    (int)std::floor(delta.y / m_cell_size),
-                                    (int)std::floor(delta.z / m_cell_size));
+        auto chunk_begin = [&](unsigned int chunk)
+        { return (unsigned int)(uint64_t(N_tot) * chunk / n_threads); };
 
-        // wrap cell back through the boundaries (grid shifting may send +/- 1 outside of range)
-        // this is done using periodic from the "local" box, since this will be periodic
-        // only when there is one rank along the dimension
-        if (periodic.x)
+        m_exec_conf->getTaskArena()->execute(
+            [&]
             {
-            if (global_bin.x == (int)n_global_cells.x)
-                global_bin.x = 0;
-            else if (global_bin.x == -1)
-                global_bin.x = n_global_cells.x - 1;
-            }
-        if (periodic.y)
+                // count the particles of each chunk in every cell
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_threads, 1),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        for (unsigned int chunk = r.begin(); chunk != r.end(); ++chunk)
+                            {
+                            unsigned int* count
+                                = m_chunk_cell_offset.data() + size_t(chunk) * n_cells;
+                            std::fill(count, count + n_cells, 0);
+
+                            for (unsigned int cur_p = chunk_begin(chunk);
+                                 cur_p < chunk_begin(chunk + 1);
+                                 ++cur_p)
+                                {
+                                const unsigned int bin_idx
+                                    = bin_particle(cur_p, chunk_conditions[chunk]);
+                                m_particle_bin[cur_p] = bin_idx;
+                                if (bin_idx != mpcd::detail::NO_CELL)
+                                    ++count[bin_idx];
+                                }
+                            }
+                    },
+                    tbb::static_partitioner());
+
+                // exclusive scan over the chunks gives the first slot of each chunk in each cell
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_cells),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      for (unsigned int bin = r.begin(); bin != r.end(); ++bin)
+                                          {
+                                          unsigned int offset = 0;
+                                          for (unsigned int chunk = 0; chunk < n_threads; ++chunk)
+                                              {
+                                              unsigned int& chunk_offset
+                                                  = m_chunk_cell_offset[size_t(chunk) * n_cells
+                                                                        + bin];
+                                              unsigned int count = chunk_offset;
+                                              chunk_offset = offset;
+                                              offset += count;
+                                              }
+                                          h_cell_np.data[bin] = offset;
+                                          }
+                                  });
+
+                // fill the cell list
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_threads, 1),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        for (unsigned int chunk = r.begin(); chunk != r.end(); ++chunk)
+                            {
+                            unsigned int* chunk_offset
+                                = m_chunk_cell_offset.data() + size_t(chunk) * n_cells;
+                            for (unsigned int cur_p = chunk_begin(chunk);
+                                 cur_p < chunk_begin(chunk + 1);
+                                 ++cur_p)
+                                {
+                                const unsigned int bin_idx = m_particle_bin[cur_p];
+                                if (bin_idx == mpcd::detail::NO_CELL)
+                                    continue;
+
+                                const unsigned int offset = chunk_offset[bin_idx]++;
+                                if (offset < m_cell_np_max)
+                                    {
+                                    h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
+                                    }
+                                else
+                                    {
+                                    chunk_conditions[chunk].x
+                                        = std::max(chunk_conditions[chunk].x, offset + 1);
+                                    }
+                                }
+                            }
+                    },
+                    tbb::static_partitioner());
+            });
+
+        // the chunks are in particle order, so the maximum matches the last failing particle
+        for (const uint3& c : chunk_conditions)
             {
-            if (global_bin.y == (int)n_global_cells.y)
-                global_bin.y = 0;
-            else if (global_bin.y == -1)
-                global_bin.y = n_global_cells.y - 1;
+            conditions.x = std::max(conditions.x, c.x);
+            conditions.y = std::max(conditions.y, c.y);
+            conditions.z = std::max(conditions.z, c.z);
             }
-        if (periodic.z)
+        }
+    else
+#endif // ENABLE_TBB
+        {
+        for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
             {
-            if (global_bin.z == (int)n_global_cells.z)
-                global_bin.z = 0;
-            else if (global_bin.z == -1)
-                global_bin.z = n_global_cells.z - 1;
-            }
+            const unsigned int bin_idx = bin_particle(cur_p, conditions);
+            if (bin_idx == mpcd::detail::NO_CELL)
+                continue;
 
-        // compute the local cell
-        int3 bin = make_int3(global_bin.x - m_origin_idx.x,
-                             global_bin.y - m_origin_idx.y,
-                             global_bin.z - m_origin_idx.z);
+            unsigned int offset = h_cell_np.data[bin_idx];
+            if (offset < m_cell_np_max)
+                {
+                h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
+                }
+            else
+                {
+                // overflow
+                conditions.x = std::max(conditions.x, offset + 1);
+                }
 
-        // validate and make sure no particles blew out of the box
-        if ((bin.x < 0 || bin.x >= (int)m_cell_dim.x) || (bin.y < 0 || bin.y >= (int)m_cell_dim.y)
-            || (bin.z < 0 || bin.z >= (int)m_cell_dim.z))
-            {
-            conditions.z = cur_p + 1;
-            continue;
+            // increment the counter always
+            ++h_cell_np.data[bin_idx];
             }
+        }
 
-        unsigned int bin_idx = m_cell_indexer(bin.x, bin.y, bin.z);
-        unsigned int offset = h_cell_np.data[bin_idx];
-        if (offset < m_cell_np_max)
-            {
-            h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
-            }
-        else
-            {
-            // overflow
-            conditions.x = std::max(conditions.x, offset + 1);
-            }
+    // write out the conditions
+    m_conditions.resetFlags(conditions);
+    }
 
-        // stash the current particle bin into the velocity array
-        if (cur_p < N_mpcd)
-            {
-            h_vel.data[cur_p].w = __int_as_scalar(bin_idx);
-            }
-        else
-            {
-            h_embed_cell_ids->data[cur_p - N_mpcd] = bin_idx;
-            }
+/*!
+ * \param cur_p Index of the particle (embedded particles follow the MPCD particles)
+ * \param postype Position of the particle
+ * \param n_global_cells Number of cells in the global box, including any padding
+ * \param global_lo Lower corner of the global box
+ * \param periodic Periodicity of the local box
+ * \param conditions Condition flags set when the particle cannot be binned
+ * \returns Local cell of the particle, or mpcd::detail::NO_CELL if it could not be binned
+ */
+unsigned int mpcd::CellList::computeParticleBin(unsigned int cur_p,
+                                                const Scalar4& postype,
+                                                const uint3& n_global_cells,
+                                                const Scalar3& global_lo,
+                                                const uchar3& periodic,
+                                                uint3& conditions) const
+    {
+    Scalar3 pos_i = make_scalar3(postype.x, postype.y, postype.z);
 
-        // increment the counter always
-        ++h_cell_np.data[bin_idx];
+    if (std::isnan(pos_i.x) || std::isnan(pos_i.y) || std::isnan(pos_i.z))
+        {
+        conditions.y = cur_p + 1;
+        return mpcd::detail::NO_CELL;
         }
 
-    // write out the conditions
-    m_conditions.resetFlags(conditions);
+    // bin particle assuming orthorhombic box (already validated)
+    const Scalar3 delta = (pos_i - m_grid_shift) - global_lo;
+    int3 global_bin = make_int3((int)std::floor(delta.x / m_cell_size),
+                                (int)std::floor(delta.y / m_cell_size),
+                                (int)std::floor(delta.z / m_cell_size));
+
+    // wrap cell back through the boundaries (grid shifting may send +/- 1 outside of range)
+    // this is done using periodic from the "local" box, since this will be periodic
+    // only when there is one rank along the dimension
+    if (periodic.x)
+        {
+        if (global_bin.x == (int)n_global_cells.x)
+            global_bin.x = 0;
+        else if (global_bin.x == -1)
+            global_bin.x = n_global_cells.x - 1;
+        }
+    if (periodic.y)
+        {
+        if (global_bin.y == (int)n_global_cells.y)
+            global_bin.y = 0;
+        else if (global_bin.y == -1)
+            global_bin.y = n_global_cells.y - 1;
+        }
+    if (periodic.z)
+        {
+        if (global_bin.z == (int)n_global_cells.z)
+            global_bin.z = 0;
+        else if (global_bin.z == -1)
+            global_bin.z = n_global_cells.z - 1;
+        }
+
+    // compute the local cell
+    int3 bin = make_int3(global_bin.x - m_origin_idx.x,
+                         global_bin.y - m_origin_idx.y,
+                         global_bin.z - m_origin_idx.z);
+
+    // validate and make sure no particles blew out of the box
+    if ((bin.x < 0 || bin.x >= (int)m_cell_dim.x) || (bin.y < 0 || bin.y >= (int)m_cell_dim.y)
+        || (bin.z < 0 || bin.z >= (int)m_cell_dim.z))
+        {
+        conditions.z = cur_p + 1;
+        return mpcd::detail::NO_CELL;
+        }
+
+    return m_cell_indexer(bin.x, bin.y, bin.z);
     }
 
 /*!
@@ -24,6 +24,7 @@
 #include <pybind11/pybind11.h>
 
 #include <array>
+#include <vector>
 
 namespace hoomd
     {
@@ -263,6 +264,11 @@ class PYBIND11_EXPORT CellList : public Compute
 
     int3 m_origin_idx; //!< Origin as a global index
 
+#ifdef ENABLE_TBB
+    std::vector<unsigned int> m_particle_bin;      //!< Cell of each particle (threaded build)
+    std::vector<unsigned int> m_chunk_cell_offset; //!< Per chunk cell counts (threaded build)
+#endif // ENABLE_TBB
+
 #ifdef ENABLE_MPI
     unsigned int m_num_extra;               //!< Number of extra cells to communicate over
     std::array<unsigned int, 6> m_num_comm; //!< Number of cells to communicate on each face
@@ -281,6 +287,14 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Builds the cell list and handles cell list memory
     virtual void buildCellList();
 
+    //! Compute the local cell of a particle
+    unsigned int computeParticleBin(unsigned int cur_p,
+                                    const Scalar4& postype,
+                                    const uint3& n_global_cells,
+                                    const Scalar3& global_lo,
+                                    const uchar3& periodic,
+                                    uint3& conditions) const;
+
     //! Callback to sort cell list when particle data is sorted
     virtual void sort(uint64_t timestep,
                       const GPUArray<unsigned int>& order,
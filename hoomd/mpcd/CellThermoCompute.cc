@@ -8,6 +8,12 @@
 
 #include "CellThermoCompute.h"
 #include "ReductionOperators.h"
+#include "hoomd/ThreadedAccumulation.h"
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif // ENABLE_TBB
 
 namespace hoomd
     {
@@ -169,7 +175,7 @@ struct CellPropertySum
                         double& ke,
                         unsigned int& np,
                         const unsigned int cell,
-                        const bool energy)
+                        const bool energy) const
         {
         momentum = make_double4(0.0, 0.0, 0.0, 0.0);
         ke = 0.0;
@@ -216,6 +222,15 @@ struct CellPropertySum
     const unsigned int* embed_idx; //!< Embedded particle indexes
     const unsigned int N_mpcd;     //!< Number of MPCD particles
     };
+
+//! Partial sum of the net properties over a range of cells
+struct NetPropertySum
+    {
+    double3 momentum = make_double3(0, 0, 0); //!< Net momentum
+    double energy = 0.0;                      //!< Net kinetic energy
+    double temp = 0.0;                        //!< Sum of the cell temperatures
+    unsigned int n_temp_cells = 0;            //!< Number of cells with a temperature
+    };
     } // end namespace detail
     } // end namespace mpcd
 
@@ -407,47 +422,67 @@ void mpcd::CellThermoCompute::calcInnerCellProperties()
         hi = m_cl->getDim();
         }
 
-    // iterate over all of the inner cells and compute average velocity, energy, temperature
+    // compute average velocity, energy, temperature of one inner cell
     const bool need_energy = m_flags[mpcd::detail::thermo_options::energy];
-    for (unsigned int k = lo.z; k < hi.z; ++k)
-        {
-        for (unsigned int j = lo.y; j < hi.y; ++j)
+    auto compute_cell = [&](unsigned int cur_cell)
+    {
+        // compute the cell properties
+        double4 momentum;
+        double ke(0.0);
+        unsigned int np(0);
+        summer.compute(momentum, ke, np, cur_cell, need_energy);
+
+        const double mass = momentum.w;
+        double3 vel_cm = make_double3(0.0, 0.0, 0.0);
+        if (mass > 0.)
             {
-            for (unsigned int i = lo.x; i < hi.x; ++i)
-                {
-                const unsigned int cur_cell = ci(i, j, k);
+            vel_cm.x = momentum.x / mass;
+            vel_cm.y = momentum.y / mass;
+            vel_cm.z = momentum.z / mass;
+            }
 
-                // compute the cell properties
-                double4 momentum;
-                double ke(0.0);
-                unsigned int np(0);
-                summer.compute(momentum, ke, np, cur_cell, need_energy);
+        h_cell_vel.data[cur_cell] = make_double4(vel_cm.x, vel_cm.y, vel_cm.z, mass);
+        if (need_energy)
+            {
+            double temp(0.0);
+            if (np > 1)
+                {
+                const double ke_cm
+                    = 0.5 * mass
+                      * (vel_cm.x * vel_cm.x + vel_cm.y * vel_cm.y + vel_cm.z * vel_cm.z);
+                temp = 2. * (ke - ke_cm) / (m_sysdef->getNDimensions() * (np - 1));
+                }
+            h_cell_energy.data[cur_cell] = make_double3(ke, temp, __int_as_double(np));
+            }
+    };
 
-                const double mass = momentum.w;
-                double3 vel_cm = make_double3(0.0, 0.0, 0.0);
-                if (mass > 0.)
-                    {
-                    vel_cm.x = momentum.x / mass;
-                    vel_cm.y = momentum.y / mass;
-                    vel_cm.z = momentum.z / mass;
-                    }
+    // each cell is independent, so the inner cells can be split between threads freely
+    const Index3D inner_ci(hi.x - lo.x, hi.y - lo.y, hi.z - lo.z);
+    auto compute_cells = [&](unsigned int first, unsigned int last)
+    {
+        for (unsigned int idx = first; idx < last; ++idx)
+            {
+            const uint3 cell = inner_ci.getTriple(idx);
+            compute_cell(ci(lo.x + cell.x, lo.y + cell.y, lo.z + cell.z));
+            }
+    };
 
-                h_cell_vel.data[cur_cell] = make_double4(vel_cm.x, vel_cm.y, vel_cm.z, mass);
-                if (need_energy)
-                    {
-                    double temp(0.0);
-                    if (np > 1)
-                        {
-                        const double ke_cm
-                            = 0.5 * mass
-                              * (vel_cm.x * vel_cm.x + vel_cm.y * vel_cm.y + vel_cm.z * vel_cm.z);
-                        temp = 2. * (ke - ke_cm) / (m_sysdef->getNDimensions() * (np - 1));
-                        }
-                    h_cell_energy.data[cur_cell] = make_double3(ke, temp, __int_as_double(np));
-                    }
-                } // i
-            }     // j
-        }         // k
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, inner_ci.getNumElements()),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { compute_cells(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif // ENABLE_TBB
+        {
+        compute_cells(0, inner_ci.getNumElements());
+        }
     }
 
 void mpcd::CellThermoCompute::computeNetProperties()
@@ -473,49 +508,83 @@ void mpcd::CellThermoCompute::computeNetProperties()
 
         const bool need_energy = m_flags[mpcd::detail::thermo_options::energy];
 
-        double3 net_momentum = make_double3(0, 0, 0);
-        double energy(0.0), temp(0.0);
-        for (unsigned int k = 0; k < upper.z; ++k)
-            {
-            for (unsigned int j = 0; j < upper.y; ++j)
+        // sum the properties of a contiguous range of cells into one partial sum
+        const Index3D sum_ci(upper.x, upper.y, upper.z);
+        auto sum_cells
+            = [&](unsigned int first, unsigned int last, mpcd::detail::NetPropertySum& sum)
+        {
+            for (unsigned int cell = first; cell < last; ++cell)
                 {
-                for (unsigned int i = 0; i < upper.x; ++i)
-                    {
-                    const unsigned int idx = ci(i, j, k);
+                const uint3 cell_ijk = sum_ci.getTriple(cell);
+                const unsigned int idx = ci(cell_ijk.x, cell_ijk.y, cell_ijk.z);
 
-                    const double4 cell_vel_mass = h_cell_vel.data[idx];
-                    const double3 cell_vel
-                        = make_double3(cell_vel_mass.x, cell_vel_mass.y, cell_vel_mass.z);
-                    const double cell_mass = cell_vel_mass.w;
+                const double4 cell_vel_mass = h_cell_vel.data[idx];
+                const double3 cell_vel
+                    = make_double3(cell_vel_mass.x, cell_vel_mass.y, cell_vel_mass.z);
+                const double cell_mass = cell_vel_mass.w;
 
-                    net_momentum.x += cell_mass * cell_vel.x;
-                    net_momentum.y += cell_mass * cell_vel.y;
-                    net_momentum.z += cell_mass * cell_vel.z;
+                sum.momentum.x += cell_mass * cell_vel.x;
+                sum.momentum.y += cell_mass * cell_vel.y;
+                sum.momentum.z += cell_mass * cell_vel.z;
 
-                    if (need_energy)
+                if (need_energy)
+                    {
+                    const double3 cell_energy = h_cell_energy.data[idx];
+                    sum.energy += cell_energy.x;
+
+                    if (__double_as_int(cell_energy.z) > 1)
                         {
-                        const double3 cell_energy = h_cell_energy.data[idx];
-                        energy += cell_energy.x;
-
-                        if (__double_as_int(cell_energy.z) > 1)
-                            {
-                            temp += cell_energy.y;
-                            ++n_temp_cells;
-                            }
+                        sum.temp += cell_energy.y;
+                        ++sum.n_temp_cells;
                         }
                     }
                 }
+        };
+
+        mpcd::detail::NetPropertySum net;
+        const unsigned int n_sum_cells = sum_ci.getNumElements();
+        const unsigned int n_threads = m_exec_conf->getNumThreads();
+        if (n_threads > 1)
+            {
+            // Double precision sums are not associative, so each thread sums a fixed range of
+            // cells and the partial sums are combined in order. Otherwise, the net momentum and
+            // energy would change in the last bits from step to step.
+            std::vector<mpcd::detail::NetPropertySum> chunk_sums(n_threads);
+            hoomd::detail::forEachChunk(
+                *m_exec_conf,
+                n_threads,
+                [&](unsigned int chunk)
+                {
+                    sum_cells(hoomd::detail::chunkBegin(n_sum_cells, chunk, n_threads),
+                              hoomd::detail::chunkBegin(n_sum_cells, chunk + 1, n_threads),
+                              chunk_sums[chunk]);
+                });
+
+            for (const mpcd::detail::NetPropertySum& chunk_sum : chunk_sums)
+                {
+                net.momentum.x += chunk_sum.momentum.x;
+                net.momentum.y += chunk_sum.momentum.y;
+                net.momentum.z += chunk_sum.momentum.z;
+                net.energy += chunk_sum.energy;
+                net.temp += chunk_sum.temp;
+                net.n_temp_cells += chunk_sum.n_temp_cells;
+                }
+            }
+        else
+            {
+            sum_cells(0, n_sum_cells, net);
             }
+        n_temp_cells = net.n_temp_cells;
 
         ArrayHandle<double> h_net_properties(m_net_properties,
                                              access_location::host,
                                              access_mode::overwrite);
-        h_net_properties.data[mpcd::detail::thermo_index::momentum_x] = net_momentum.x;
-        h_net_properties.data[mpcd::detail::thermo_index::momentum_y] = net_momentum.y;
-        h_net_properties.data[mpcd::detail::thermo_index::momentum_z] = net_momentum.z;
+        h_net_properties.data[mpcd::detail::thermo_index::momentum_x] = net.momentum.x;
+        h_net_properties.data[mpcd::detail::thermo_index::momentum_y] = net.momentum.y;
+        h_net_properties.data[mpcd::detail::thermo_index::momentum_z] = net.momentum.z;
 
-        h_net_properties.data[mpcd::detail::thermo_index::energy] = energy;
-        h_net_properties.data[mpcd::detail::thermo_index::temperature] = temp;
+        h_net_properties.data[mpcd::detail::thermo_index::energy] = net.energy;
+        h_net_properties.data[mpcd::detail::thermo_index::temperature] = net.temp;
         }
 
 #ifdef ENABLE_MPI
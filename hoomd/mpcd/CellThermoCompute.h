@@ -41,6 +41,12 @@ class PYBIND11_EXPORT CellThermoCompute : public Compute
     //! Compute the cell thermodynamic properties
     void compute(uint64_t timestep);
 
+    //! Get the attached cell list
+    std::shared_ptr<mpcd::CellList> getCellList() const
+        {
+        return m_cl;
+        }
+
     //! Get the cell indexer for the attached cell list
     const Index3D& getCellIndexer() const
         {
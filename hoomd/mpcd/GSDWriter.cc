@@ -0,0 +1,191 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/GSDWriter.cc
+ * \brief Definition of mpcd::GSDWriter
+ */
+
+#include "GSDWriter.h"
+
+#include "hoomd/Filesystem.h"
+#include "hoomd/GSD.h"
+#include "hoomd/HOOMDVersion.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger that selects the timesteps to write
+ * \param fname File name
+ * \param mode File open mode ("wb", "xb", or "ab")
+ */
+mpcd::GSDWriter::GSDWriter(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger,
+                           const std::string& fname,
+                           const std::string& mode)
+    : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_nframes(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD GSDWriter: " << fname << std::endl;
+    if (!m_sysdef->getMPCDParticleData())
+        {
+        throw std::runtime_error("MPCD particle data has not been initialized.");
+        }
+    open();
+    }
+
+mpcd::GSDWriter::~GSDWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD GSDWriter" << std::endl;
+    if (m_exec_conf->isRoot())
+        {
+        gsd_close(&m_handle);
+        }
+    }
+
+void mpcd::GSDWriter::flush()
+    {
+    if (m_exec_conf->isRoot())
+        {
+        int retval = gsd_flush(&m_handle);
+        hoomd::detail::GSDUtils::checkError(retval, m_fname);
+        }
+    }
+
+void mpcd::GSDWriter::open()
+    {
+    if (!m_exec_conf->isRoot())
+        return;
+
+    if (m_mode == "wb" || m_mode == "xb" || (m_mode == "ab" && !filesystem::exists(m_fname)))
+        {
+        std::ostringstream o;
+        o << "HOOMD-blue " << HOOMD_VERSION;
+
+        m_exec_conf->msg->notice(3) << "MPCD GSD: create or overwrite gsd file " << m_fname
+                                    << std::endl;
+        int retval = gsd_create_and_open(&m_handle,
+                                         m_fname.c_str(),
+                                         o.str().c_str(),
+                                         "hoomd",
+                                         gsd_make_version(1, 4),
+                                         GSD_OPEN_APPEND,
+                                         m_mode == "xb");
+        hoomd::detail::GSDUtils::checkError(retval, m_fname);
+        }
+    else if (m_mode == "ab")
+        {
+        m_exec_conf->msg->notice(3) << "MPCD GSD: open gsd file " << m_fname << std::endl;
+        int retval = gsd_open(&m_handle, m_fname.c_str(), GSD_OPEN_APPEND);
+        hoomd::detail::GSDUtils::checkError(retval, m_fname);
+
+        if (std::string(m_handle.header.schema) != std::string("hoomd")
+            || m_handle.header.schema_version >= gsd_make_version(2, 0))
+            {
+            gsd_close(&m_handle);
+            throw std::runtime_error("Invalid schema in GSD file " + m_fname);
+            }
+        }
+    else
+        {
+        throw std::invalid_argument("Invalid GSD file mode: " + m_mode);
+        }
+
+    m_nframes = gsd_get_nframes(&m_handle);
+    }
+
+/*!
+ * \param timestep Current timestep
+ *
+ * Write configuration/step and configuration/box in every frame, and configuration/dimensions
+ * in frame 0. Only call on the root rank.
+ */
+void mpcd::GSDWriter::writeFrameHeader(uint64_t timestep)
+    {
+    writeChunk("configuration/step", GSD_TYPE_UINT64, 1, 1, &timestep);
+
+    if (m_nframes == 0)
+        {
+        uint8_t dimensions = (uint8_t)m_sysdef->getNDimensions();
+        writeChunk("configuration/dimensions", GSD_TYPE_UINT8, 1, 1, &dimensions);
+        }
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    float box_a[6];
+    box_a[0] = (float)box.getL().x;
+    box_a[1] = (float)box.getL().y;
+    box_a[2] = (float)box.getL().z;
+    box_a[3] = (float)box.getTiltFactorXY();
+    box_a[4] = (float)box.getTiltFactorXZ();
+    box_a[5] = (float)box.getTiltFactorYZ();
+    writeChunk("configuration/box", GSD_TYPE_FLOAT, 6, 1, box_a);
+    }
+
+/*!
+ * \param name Name of the chunk
+ * \param type Type of the data
+ * \param N Number of rows
+ * \param M Number of columns
+ * \param data Data to write (N*M values of \a type)
+ *
+ * Only call on the root rank.
+ */
+void mpcd::GSDWriter::writeChunk(const char* name,
+                                 gsd_type type,
+                                 uint64_t N,
+                                 uint32_t M,
+                                 const void* data)
+    {
+    m_exec_conf->msg->notice(10) << "MPCD GSD: writing " << name << std::endl;
+    int retval = gsd_write_chunk(&m_handle, name, type, N, M, 0, data);
+    hoomd::detail::GSDUtils::checkError(retval, m_fname);
+    }
+
+/*!
+ * \param name Name of the chunk
+ * \param type_mapping Type names to write
+ *
+ * Only call on the root rank.
+ */
+void mpcd::GSDWriter::writeTypeMapping(const char* name,
+                                       const std::vector<std::string>& type_mapping)
+    {
+    size_t max_len = 0;
+    for (const auto& type : type_mapping)
+        {
+        max_len = std::max(max_len, type.size());
+        }
+    max_len += 1; // for null
+
+    std::vector<char> types(max_len * type_mapping.size(), 0);
+    for (size_t i = 0; i < type_mapping.size(); i++)
+        {
+        strncpy(&types[max_len * i], type_mapping[i].c_str(), max_len);
+        }
+    writeChunk(name, GSD_TYPE_UINT8, type_mapping.size(), (uint32_t)max_len, types.data());
+    }
+
+/*!
+ * Only call on the root rank.
+ */
+void mpcd::GSDWriter::endFrame()
+    {
+    int retval = gsd_end_frame(&m_handle);
+    hoomd::detail::GSDUtils::checkError(retval, m_fname);
+    m_nframes++;
+    }
+
+void mpcd::detail::export_GSDWriter(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::GSDWriter, Analyzer, std::shared_ptr<mpcd::GSDWriter>>(m, "GSDWriter")
+        .def("flush", &mpcd::GSDWriter::flush)
+        .def_property_readonly("filename", &mpcd::GSDWriter::getFilename)
+        .def_property_readonly("mode", &mpcd::GSDWriter::getMode);
+    }
+
+    } // end namespace hoomd
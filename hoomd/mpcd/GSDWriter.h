@@ -0,0 +1,93 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/GSDWriter.h
+ * \brief Declaration of mpcd::GSDWriter
+ */
+
+#ifndef MPCD_GSD_WRITER_H_
+#define MPCD_GSD_WRITER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "hoomd/Analyzer.h"
+#include "hoomd/extern/gsd.h"
+#include <pybind11/pybind11.h>
+
+#include <string>
+#include <vector>
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Base class for writers of MPCD data to GSD files
+/*!
+ * The GSDWriter opens the file on the root rank and provides helpers to write the frame header
+ * (configuration/step, configuration/dimensions, and configuration/box) and data chunks. Derived
+ * classes gather their data to the root rank and write it in analyze().
+ *
+ * Files use the hoomd schema, so they can be opened by any GSD reader. The MPCD data is stored in
+ * chunks whose names begin with mpcd/.
+ */
+class PYBIND11_EXPORT GSDWriter : public Analyzer
+    {
+    public:
+    //! Constructor
+    GSDWriter(std::shared_ptr<SystemDefinition> sysdef,
+              std::shared_ptr<Trigger> trigger,
+              const std::string& fname,
+              const std::string& mode);
+
+    //! Destructor
+    virtual ~GSDWriter();
+
+    //! Flush the write buffer to the file
+    void flush();
+
+    //! Get the file name
+    const std::string& getFilename() const
+        {
+        return m_fname;
+        }
+
+    //! Get the file open mode
+    const std::string& getMode() const
+        {
+        return m_mode;
+        }
+
+    protected:
+    std::string m_fname; //!< File name
+    std::string m_mode;  //!< File open mode
+    gsd_handle m_handle; //!< Handle to the file (only valid on the root rank)
+    uint64_t m_nframes;  //!< Number of frames in the file
+
+    //! Write the frame header
+    void writeFrameHeader(uint64_t timestep);
+
+    //! Write a data chunk
+    void writeChunk(const char* name, gsd_type type, uint64_t N, uint32_t M, const void* data);
+
+    //! Write a type mapping
+    void writeTypeMapping(const char* name, const std::vector<std::string>& type_mapping);
+
+    //! End the frame
+    void endFrame();
+
+    private:
+    //! Open the file on the root rank
+    void open();
+    };
+
+namespace detail
+    {
+//! Export mpcd::GSDWriter to python
+void export_GSDWriter(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_GSD_WRITER_H_
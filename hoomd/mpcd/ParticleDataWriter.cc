@@ -0,0 +1,195 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ParticleDataWriter.cc
+ * \brief Definition of mpcd::ParticleDataWriter
+ */
+
+#include "ParticleDataWriter.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace hoomd
+    {
+/*!
+ * \param sysdef System definition
+ * \param trigger Trigger that selects the timesteps to write
+ * \param fname File name
+ * \param mode File open mode ("wb", "xb", or "ab")
+ */
+mpcd::ParticleDataWriter::ParticleDataWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                             std::shared_ptr<Trigger> trigger,
+                                             const std::string& fname,
+                                             const std::string& mode)
+    : mpcd::GSDWriter(sysdef, trigger, fname, mode),
+      m_mpcd_pdata(sysdef->getMPCDParticleData()), m_write_velocity(true), m_mass(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing MPCD ParticleDataWriter" << std::endl;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order = GatherTagOrder(m_exec_conf->getMPICommunicator());
+        }
+#endif // ENABLE_MPI
+    }
+
+mpcd::ParticleDataWriter::~ParticleDataWriter()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying MPCD ParticleDataWriter" << std::endl;
+    }
+
+/*!
+ * \param global Buffer for the gathered array
+ * \param local Local array in ascending tag order
+ * \returns The global array in tag order (valid only on the root rank)
+ *
+ * Without domain decomposition, the local array is the global array and is returned directly.
+ */
+template<class T>
+const T* mpcd::ParticleDataWriter::gather(std::vector<T>& global, const std::vector<T>& local)
+    {
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order.gatherArray(global, local);
+        return global.data();
+        }
+#endif // ENABLE_MPI
+    return local.data();
+    }
+
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::ParticleDataWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    sortLocalTags();
+    const unsigned int N_local = (unsigned int)m_index.size();
+
+    if (m_exec_conf->isRoot())
+        {
+        writeFrameHeader(timestep);
+
+        const uint32_t N = m_mpcd_pdata->getNGlobal();
+        writeChunk("mpcd/N", GSD_TYPE_UINT32, 1, 1, &N);
+
+        const std::vector<std::string>& type_mapping = m_mpcd_pdata->getTypeNames();
+        if (m_nframes == 0 || type_mapping != m_type_mapping)
+            {
+            writeTypeMapping("mpcd/types", type_mapping);
+            m_type_mapping = type_mapping;
+            }
+
+        const Scalar mass = m_mpcd_pdata->getMass();
+        if (m_nframes == 0 || mass != m_mass)
+            {
+            const float mass_f = (float)mass;
+            writeChunk("mpcd/mass", GSD_TYPE_FLOAT, 1, 1, &mass_f);
+            m_mass = mass;
+            }
+        }
+
+    // positions and types
+        {
+        ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        m_local_vec.resize(N_local);
+        m_local_typeid.resize(N_local);
+        for (unsigned int i = 0; i < N_local; ++i)
+            {
+            const Scalar4 postype = h_pos.data[m_index[i]];
+            m_local_vec[i] = vec3<float>(float(postype.x), float(postype.y), float(postype.z));
+            m_local_typeid[i] = __scalar_as_int(postype.w);
+            }
+        }
+
+    const uint32_t* typeid_data = gather(m_global_typeid, m_local_typeid);
+    if (m_exec_conf->isRoot())
+        {
+        writeChunk("mpcd/typeid", GSD_TYPE_UINT32, m_mpcd_pdata->getNGlobal(), 1, typeid_data);
+        }
+
+    const vec3<float>* pos_data = gather(m_global_vec, m_local_vec);
+    if (m_exec_conf->isRoot())
+        {
+        writeChunk("mpcd/position", GSD_TYPE_FLOAT, m_mpcd_pdata->getNGlobal(), 3, pos_data);
+        }
+
+    // velocities (reusing the buffers, so that the root holds only one array at a time)
+    if (m_write_velocity)
+        {
+            {
+            ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                                       access_location::host,
+                                       access_mode::read);
+            for (unsigned int i = 0; i < N_local; ++i)
+                {
+                const Scalar4 vel = h_vel.data[m_index[i]];
+                m_local_vec[i] = vec3<float>(float(vel.x), float(vel.y), float(vel.z));
+                }
+            }
+
+        const vec3<float>* vel_data = gather(m_global_vec, m_local_vec);
+        if (m_exec_conf->isRoot())
+            {
+            writeChunk("mpcd/velocity", GSD_TYPE_FLOAT, m_mpcd_pdata->getNGlobal(), 3, vel_data);
+            }
+        }
+
+    if (m_exec_conf->isRoot())
+        {
+        endFrame();
+        }
+    }
+
+/*!
+ * Fill m_index with the local particle indices in ascending tag order. Virtual particles are
+ * excluded.
+ */
+void mpcd::ParticleDataWriter::sortLocalTags()
+    {
+    const unsigned int N = m_mpcd_pdata->getN();
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    m_index.resize(N);
+    std::iota(m_index.begin(), m_index.end(), 0);
+    std::sort(m_index.begin(),
+              m_index.end(),
+              [&h_tag](unsigned int a, unsigned int b) { return h_tag.data[a] < h_tag.data[b]; });
+
+    m_local_tag.resize(N);
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        m_local_tag[i] = h_tag.data[m_index[i]];
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order.setLocalTagsSorted(m_local_tag);
+        }
+#endif // ENABLE_MPI
+    }
+
+void mpcd::detail::export_ParticleDataWriter(pybind11::module& m)
+    {
+    pybind11::class_<mpcd::ParticleDataWriter,
+                     mpcd::GSDWriter,
+                     std::shared_ptr<mpcd::ParticleDataWriter>>(m, "ParticleDataWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            const std::string&,
+                            const std::string&>())
+        .def_property("write_velocity",
+                      &mpcd::ParticleDataWriter::getWriteVelocity,
+                      &mpcd::ParticleDataWriter::setWriteVelocity);
+    }
+
+    } // end namespace hoomd
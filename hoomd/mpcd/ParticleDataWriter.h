@@ -0,0 +1,105 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/ParticleDataWriter.h
+ * \brief Declaration of mpcd::ParticleDataWriter
+ */
+
+#ifndef MPCD_PARTICLE_DATA_WRITER_H_
+#define MPCD_PARTICLE_DATA_WRITER_H_
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "GSDWriter.h"
+#include "ParticleData.h"
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/VectorMath.h"
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif // ENABLE_MPI
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+//! Writes MPCD particles to a GSD file
+/*!
+ * Each frame stores the (real) MPCD particles in ascending tag order:
+ *
+ * - mpcd/N: Number of particles
+ * - mpcd/types: Type names (in frame 0 and when they change)
+ * - mpcd/mass: Particle mass (in frame 0 and when it changes)
+ * - mpcd/typeid: Type of each particle
+ * - mpcd/position: Position of each particle
+ * - mpcd/velocity: Velocity of each particle (when enabled)
+ *
+ * Virtual particles are not written.
+ *
+ * The writer does not build a snapshot. In MPI simulations, it gathers one array at a time to the
+ * root rank with GatherTagOrder, which sorts the values by tag on all ranks. The root rank only
+ * holds the array that it is writing.
+ */
+class PYBIND11_EXPORT ParticleDataWriter : public mpcd::GSDWriter
+    {
+    public:
+    //! Constructor
+    ParticleDataWriter(std::shared_ptr<SystemDefinition> sysdef,
+                       std::shared_ptr<Trigger> trigger,
+                       const std::string& fname,
+                       const std::string& mode);
+
+    //! Destructor
+    virtual ~ParticleDataWriter();
+
+    //! Write a frame
+    virtual void analyze(uint64_t timestep);
+
+    //! Set whether to write the particle velocities
+    void setWriteVelocity(bool write_velocity)
+        {
+        m_write_velocity = write_velocity;
+        }
+
+    //! Get whether to write the particle velocities
+    bool getWriteVelocity() const
+        {
+        return m_write_velocity;
+        }
+
+    protected:
+    std::shared_ptr<mpcd::ParticleData> m_mpcd_pdata; //!< MPCD particle data
+    bool m_write_velocity;                            //!< True when velocities are written
+
+    std::vector<std::string> m_type_mapping; //!< Type names in the last frame written
+    Scalar m_mass;                           //!< Mass in the last frame written
+
+    std::vector<unsigned int> m_index;     //!< Local particle indices in tag order
+    std::vector<unsigned int> m_local_tag; //!< Local tags in ascending order
+    std::vector<vec3<float>> m_local_vec;  //!< Local vector values in tag order
+    std::vector<uint32_t> m_local_typeid;  //!< Local type ids in tag order
+    std::vector<vec3<float>> m_global_vec; //!< Gathered vector values (root only)
+    std::vector<uint32_t> m_global_typeid; //!< Gathered type ids (root only)
+
+#ifdef ENABLE_MPI
+    GatherTagOrder m_gather_tag_order; //!< Gathers the local arrays in tag order
+#endif                                 // ENABLE_MPI
+
+    //! Sort the local particles by tag
+    void sortLocalTags();
+
+    //! Gather a local array in tag order to the root rank
+    template<class T> const T* gather(std::vector<T>& global, const std::vector<T>& local);
+    };
+
+namespace detail
+    {
+//! Export mpcd::ParticleDataWriter to python
+void export_ParticleDataWriter(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#endif // MPCD_PARTICLE_DATA_WRITER_H_
@@ -18,6 +18,11 @@
 // integration
 #include "Integrator.h"
 
+// writers
+#include "CellFieldWriter.h"
+#include "GSDWriter.h"
+#include "ParticleDataWriter.h"
+
 // Collision methods
 #include "ATCollisionMethod.h"
 #include "CollisionMethod.h"
@@ -120,6 +125,10 @@ PYBIND11_MODULE(_mpcd, m)
 
     mpcd::detail::export_Integrator(m);
 
+    mpcd::detail::export_GSDWriter(m);
+    mpcd::detail::export_ParticleDataWriter(m);
+    mpcd::detail::export_CellFieldWriter(m);
+
     mpcd::detail::export_CollisionMethod(m);
     mpcd::detail::export_ATCollisionMethod(m);
     mpcd::detail::export_SRDCollisionMethod(m);
@@ -11,6 +11,8 @@
 #include "hoomd/filter/ParticleFilterType.h"
 #include "hoomd/test/upp11_config.h"
 
+#include <random>
+
 HOOMD_UP_MAIN()
 
 using namespace hoomd;
@@ -651,6 +653,78 @@ template<class CL> void celllist_embed_test(std::shared_ptr<ExecutionConfigurati
         }
     }
 
+#ifdef ENABLE_TBB
+//! Test that a threaded build gives the same cell list, in the same order, as a serial build
+template<class CL> void celllist_threaded_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(6.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(2000);
+    snap->mpcd_data.type_mapping.push_back("A");
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> uniform(-3.0, 3.0);
+    for (unsigned int i = 0; i < snap->mpcd_data.size; ++i)
+        {
+        snap->mpcd_data.position[i] = vec3<Scalar>(uniform(gen), uniform(gen), uniform(gen));
+        }
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<mpcd::ParticleData> pdata = sysdef->getMPCDParticleData();
+
+    std::shared_ptr<mpcd::CellList> cl(new CL(sysdef));
+    cl->setGridShift(make_scalar3(0.25, -0.375, 0.125));
+
+    // build the reference list with one thread
+    exec_conf->setNumThreads(1);
+    cl->compute(0);
+
+    std::vector<unsigned int> ref_np, ref_list, ref_cell;
+        {
+        ArrayHandle<unsigned int> h_cell_np(cl->getCellSizeArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_cell_list(cl->getCellList(),
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<Scalar4> h_vel(pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        const Index2D& cli = cl->getCellListIndexer();
+        ref_np.assign(h_cell_np.data, h_cell_np.data + cl->getNCells());
+        ref_list.assign(h_cell_list.data, h_cell_list.data + cli.getNumElements());
+        for (unsigned int i = 0; i < pdata->getN(); ++i)
+            {
+            ref_cell.push_back(__scalar_as_int(h_vel.data[i].w));
+            }
+        }
+
+    // rebuild with several threads and compare
+    exec_conf->setNumThreads(4);
+    cl->forceCompute(1);
+
+    ArrayHandle<unsigned int> h_cell_np(cl->getCellSizeArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_cell_list(cl->getCellList(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<Scalar4> h_vel(pdata->getVelocities(), access_location::host, access_mode::read);
+    const Index2D& cli = cl->getCellListIndexer();
+    for (unsigned int cell = 0; cell < cl->getNCells(); ++cell)
+        {
+        UP_ASSERT_EQUAL(h_cell_np.data[cell], ref_np[cell]);
+        for (unsigned int offset = 0; offset < h_cell_np.data[cell]; ++offset)
+            {
+            UP_ASSERT_EQUAL(h_cell_list.data[cli(offset, cell)], ref_list[cli(offset, cell)]);
+            }
+        }
+    for (unsigned int i = 0; i < pdata->getN(); ++i)
+        {
+        UP_ASSERT_EQUAL((unsigned int)__scalar_as_int(h_vel.data[i].w), ref_cell[i]);
+        }
+    }
+#endif // ENABLE_TBB
+
 //! dimension test case for MPCD CellList class
 UP_TEST(mpcd_cell_list_dimensions)
     {
@@ -679,6 +753,15 @@ UP_TEST(mpcd_cell_list_embed_test)
         new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+#ifdef ENABLE_TBB
+//! threaded build test case for MPCD CellList class
+UP_TEST(mpcd_cell_list_threaded_test)
+    {
+    celllist_threaded_test<mpcd::CellList>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+#endif // ENABLE_TBB
+
 #ifdef ENABLE_HIP
 //! dimension test case for MPCD CellListGPU class
 UP_TEST(mpcd_cell_list_gpu_dimensions)
@@ -0,0 +1,196 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/CellFieldWriter.h"
+#include "hoomd/mpcd/CellList.h"
+#include "hoomd/mpcd/CellThermoCompute.h"
+#include "hoomd/mpcd/ParticleDataWriter.h"
+
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/extern/gsd.h"
+#include "hoomd/test/upp11_config.h"
+
+#include <algorithm>
+#include <cstdio>
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Make a system with one MPCD particle in 4 of the 8 cells and two in cell (0,0,0)
+std::shared_ptr<SystemDefinition> make_system(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(2.0);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(5);
+    snap->mpcd_data.type_mapping.push_back("A");
+    snap->mpcd_data.type_mapping.push_back("B");
+    snap->mpcd_data.position[0] = vec3<Scalar>(-0.5, -0.5, -0.5);
+    snap->mpcd_data.position[1] = vec3<Scalar>(-0.5, -0.5, -0.5);
+    snap->mpcd_data.position[2] = vec3<Scalar>(0.5, 0.5, 0.5);
+    snap->mpcd_data.position[3] = vec3<Scalar>(0.5, -0.5, 0.5);
+    snap->mpcd_data.position[4] = vec3<Scalar>(-0.5, 0.5, 0.5);
+
+    snap->mpcd_data.velocity[0] = vec3<Scalar>(2.0, 0.0, 0.0);
+    snap->mpcd_data.velocity[1] = vec3<Scalar>(1.0, 0.0, 0.0);
+    snap->mpcd_data.velocity[2] = vec3<Scalar>(0.0, -3.0, 0.0);
+    snap->mpcd_data.velocity[3] = vec3<Scalar>(0.0, 0.0, -5.0);
+    snap->mpcd_data.velocity[4] = vec3<Scalar>(1.0, -1.0, 4.0);
+
+    snap->mpcd_data.type[0] = 0;
+    snap->mpcd_data.type[1] = 1;
+    snap->mpcd_data.type[2] = 1;
+    snap->mpcd_data.type[3] = 0;
+    snap->mpcd_data.type[4] = 1;
+
+    return std::make_shared<SystemDefinition>(snap, exec_conf);
+    }
+
+//! Read a chunk from the last frame of a GSD file
+template<class T> std::vector<T> read_chunk(gsd_handle& handle, const char* name)
+    {
+    const gsd_index_entry* entry = gsd_find_chunk(&handle, gsd_get_nframes(&handle) - 1, name);
+    UP_ASSERT(entry != NULL);
+    std::vector<T> data(entry->N * entry->M);
+    UP_ASSERT_EQUAL(gsd_read_chunk(&handle, data.data(), entry), GSD_SUCCESS);
+    return data;
+    }
+
+//! Test that the MPCD particles are written in tag order
+UP_TEST(mpcd_particle_data_writer)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    auto sysdef = make_system(exec_conf);
+
+    // reverse the particle order in memory, so that the tags are not sorted
+    auto mpcd_pdata = sysdef->getMPCDParticleData();
+        {
+        ArrayHandle<Scalar4> h_pos(mpcd_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<Scalar4> h_vel(mpcd_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<unsigned int> h_tag(mpcd_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::readwrite);
+        std::reverse(h_pos.data, h_pos.data + mpcd_pdata->getN());
+        std::reverse(h_vel.data, h_vel.data + mpcd_pdata->getN());
+        std::reverse(h_tag.data, h_tag.data + mpcd_pdata->getN());
+        }
+
+    const std::string fname = "test_mpcd_particle_data_writer.gsd";
+        {
+        auto trigger = std::make_shared<PeriodicTrigger>(1);
+        auto writer = std::make_shared<mpcd::ParticleDataWriter>(sysdef, trigger, fname, "wb");
+        writer->analyze(10);
+        writer->setWriteVelocity(false);
+        writer->analyze(20);
+        }
+
+    gsd_handle handle;
+    UP_ASSERT_EQUAL(gsd_open(&handle, fname.c_str(), GSD_OPEN_READONLY), GSD_SUCCESS);
+    UP_ASSERT_EQUAL(gsd_get_nframes(&handle), 2);
+
+    auto step = read_chunk<uint64_t>(handle, "configuration/step");
+    UP_ASSERT_EQUAL(step[0], 20);
+    auto N = read_chunk<uint32_t>(handle, "mpcd/N");
+    UP_ASSERT_EQUAL(N[0], 5);
+
+    auto pos = read_chunk<float>(handle, "mpcd/position");
+    UP_ASSERT_EQUAL(pos.size(), 15);
+    CHECK_CLOSE(pos[0], -0.5, tol_small);
+    CHECK_CLOSE(pos[3 * 3 + 0], 0.5, tol_small);
+    CHECK_CLOSE(pos[3 * 3 + 1], -0.5, tol_small);
+    CHECK_CLOSE(pos[3 * 4 + 0], -0.5, tol_small);
+    CHECK_CLOSE(pos[3 * 4 + 1], 0.5, tol_small);
+
+    auto typeid_ = read_chunk<uint32_t>(handle, "mpcd/typeid");
+    UP_ASSERT_EQUAL(typeid_.size(), 5);
+    UP_ASSERT_EQUAL(typeid_[0], 0);
+    UP_ASSERT_EQUAL(typeid_[1], 1);
+    UP_ASSERT_EQUAL(typeid_[2], 1);
+    UP_ASSERT_EQUAL(typeid_[3], 0);
+    UP_ASSERT_EQUAL(typeid_[4], 1);
+
+    // the velocities are only in frame 0, the types are only written when they change
+    UP_ASSERT(gsd_find_chunk(&handle, 1, "mpcd/velocity") == NULL);
+    UP_ASSERT(gsd_find_chunk(&handle, 1, "mpcd/types") == NULL);
+    const gsd_index_entry* entry = gsd_find_chunk(&handle, 0, "mpcd/velocity");
+    UP_ASSERT(entry != NULL);
+    std::vector<float> vel(entry->N * entry->M);
+    UP_ASSERT_EQUAL(gsd_read_chunk(&handle, vel.data(), entry), GSD_SUCCESS);
+    CHECK_CLOSE(vel[0], 2.0, tol_small);
+    CHECK_CLOSE(vel[3 * 2 + 1], -3.0, tol_small);
+    CHECK_CLOSE(vel[3 * 4 + 2], 4.0, tol_small);
+
+    gsd_close(&handle);
+    std::remove(fname.c_str());
+    }
+
+//! Test that the cell fields are averaged over the samples
+UP_TEST(mpcd_cell_field_writer)
+    {
+    auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    auto sysdef = make_system(exec_conf);
+    auto cl = std::make_shared<mpcd::CellList>(sysdef);
+    auto thermo = std::make_shared<mpcd::CellThermoCompute>(sysdef, cl);
+
+    const std::string fname = "test_mpcd_cell_field_writer.gsd";
+        {
+        auto trigger = std::make_shared<PeriodicTrigger>(1);
+        auto writer
+            = std::make_shared<mpcd::CellFieldWriter>(sysdef, trigger, fname, "wb", thermo, 2);
+        writer->analyze(0);
+        UP_ASSERT_EQUAL(writer->getNumAccumulated(), 1);
+
+        // double the velocities of the particles before the second sample
+        auto mpcd_pdata = sysdef->getMPCDParticleData();
+            {
+            ArrayHandle<Scalar4> h_vel(mpcd_pdata->getVelocities(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+            for (unsigned int i = 0; i < mpcd_pdata->getN(); ++i)
+                {
+                h_vel.data[i].x *= 2;
+                h_vel.data[i].y *= 2;
+                h_vel.data[i].z *= 2;
+                }
+            }
+        writer->analyze(1);
+        UP_ASSERT_EQUAL(writer->getNumAccumulated(), 0);
+        }
+
+    gsd_handle handle;
+    UP_ASSERT_EQUAL(gsd_open(&handle, fname.c_str(), GSD_OPEN_READONLY), GSD_SUCCESS);
+    UP_ASSERT_EQUAL(gsd_get_nframes(&handle), 1);
+
+    auto dim = read_chunk<uint32_t>(handle, "mpcd/cell/dimensions");
+    UP_ASSERT_EQUAL(dim[0], 2);
+    UP_ASSERT_EQUAL(dim[1], 2);
+    UP_ASSERT_EQUAL(dim[2], 2);
+    auto num_samples = read_chunk<uint32_t>(handle, "mpcd/cell/num_samples");
+    UP_ASSERT_EQUAL(num_samples[0], 2);
+
+    const Index3D ci(2, 2, 2);
+    auto density = read_chunk<float>(handle, "mpcd/cell/density");
+    UP_ASSERT_EQUAL(density.size(), 8);
+    CHECK_CLOSE(density[ci(0, 0, 0)], 2.0, tol_small);
+    CHECK_CLOSE(density[ci(1, 1, 1)], 1.0, tol_small);
+    CHECK_SMALL(density[ci(1, 0, 0)], tol_small);
+
+    // the average velocity is 1.5 times the first sample
+    auto velocity = read_chunk<float>(handle, "mpcd/cell/velocity");
+    CHECK_CLOSE(velocity[3 * ci(0, 0, 0)], 1.5 * 1.5, tol_small);
+    CHECK_CLOSE(velocity[3 * ci(1, 0, 1) + 2], 1.5 * -5.0, tol_small);
+    CHECK_SMALL(velocity[3 * ci(1, 0, 0)], tol_small);
+
+    // the temperature is only defined in the cell with two particles, and is 2.5 times the first
+    auto temperature = read_chunk<float>(handle, "mpcd/cell/temperature");
+    CHECK_CLOSE(temperature[ci(0, 0, 0)], 2.5 * 2.0 * 0.5 * 0.5 / 3.0, tol_small);
+    CHECK_SMALL(temperature[ci(1, 1, 1)], tol_small);
+
+    gsd_close(&handle);
+    std::remove(fname.c_str());
+    }
@@ -227,6 +227,10 @@ class _HOOMDBaseObject(_HOOMDGetSetAttrBase,
     # _use_count must be included or attaching and detaching won't work as
     # expected as _use_count may not equal 0.
     _remove_for_pickling = ('_simulation_', '_cpp_obj', "_use_count")
+    # Attributes that hold internal state (such as integrator degrees of
+    # freedom) that `Simulation.write_checkpoint` saves and
+    # `Simulation.create_state_from_checkpoint` restores.
+    _checkpoint_attributes = ()
 
     def _detach(self, force=False):
         """Decrement attach count and destroy C++ object if count == 0.
@@ -316,6 +320,8 @@ class _HOOMDBaseObject(_HOOMDGetSetAttrBase,
         except hoomd.error.SimulationDefinitionError as err:
             self._use_count -= 1
             raise err
+        if hasattr(self._cpp_obj, "setProfileName"):
+            self._cpp_obj.setProfileName(type(self).__name__)
         try:
             self._apply_param_dict()
             self._apply_typeparam_dict(self._cpp_obj, self._simulation)
@@ -3,7 +3,8 @@
 
 import hoomd
 import pytest
-from hoomd.conftest import operation_pickling_check
+from hoomd.conftest import operation_pickling_check, logging_check
+from hoomd.logging import LoggerCategories
 
 
 def test_balance_properties():
@@ -37,8 +38,12 @@ def test_balance_properties():
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.weight == 'particles'
+    balance.weight = 'time'
+    assert balance.weight == 'time'
 
-def test_attach_detach(simulation_factory, lattice_snapshot_factory):
+
+def test_attach_detach(device, simulation_factory, lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
     sim = simulation_factory(snapshot)
     trigger = hoomd.trigger.Periodic(3)
@@ -75,6 +80,11 @@ def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.weight == 'particles'
+    if isinstance(device, hoomd.device.CPU):
+        balance.weight = 'time'
+        assert balance.weight == 'time'
+
     sim.operations.tuners.remove(balance)
 
 
@@ -114,3 +124,40 @@ def test_balance_action(device, simulation_factory, lattice_snapshot_factory):
 
     # the load balance should move the split place down toward the particles
     assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
+
+
+def test_balance_time(device, simulation_factory, lattice_snapshot_factory):
+    """Test that balancing by time runs and reports the time imbalance."""
+    if device.communicator.num_ranks != 2:
+        pytest.skip("Test supports only 2 ranks")
+    if isinstance(device, hoomd.device.GPU):
+        pytest.skip("weight='time' is not supported on the GPU")
+
+    snapshot = lattice_snapshot_factory(n=8)
+    sim = simulation_factory(snapshot, domain_decomposition=(1, 1, 2))
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    integrator = hoomd.md.Integrator(dt=0.001, forces=[lj])
+    integrator.methods.append(
+        hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All()))
+    sim.operations.integrator = integrator
+
+    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(5),
+                                      weight='time')
+    sim.operations.tuners.append(balance)
+    sim.run(10)
+
+    assert balance.time_imbalance >= 1.0
+    fraction = sim.state.domain_decomposition_split_fractions[2][0]
+    assert 0 < fraction < 1
+
+
+def test_logging():
+    logging_check(hoomd.tune.LoadBalancer, ('tune',), {
+        'time_imbalance': {
+            'category': LoggerCategories.scalar,
+            'default': True
+        }
+    })
@@ -161,6 +161,40 @@ def test_walltime(simulation_factory, two_particle_snapshot_factory):
     assert all(a >= b for a, b in zip(walltime[1:], walltime[:-1]))
 
 
+def test_profile_operations(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory())
+    assert not sim.profile_operations
+    assert sim.operation_times == {}
+    assert sim.operation_times_table == ""
+
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.methods.append(
+        hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All()))
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4))
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    lj.r_cut[('A', 'A')] = 2.5
+    integrator.forces.append(lj)
+    sim.operations.integrator = integrator
+    sim.operations += SleepUpdater.wrapped()
+
+    sim.profile_operations = True
+    assert sim.profile_operations
+    sim.run(10)
+
+    times = sim.operation_times
+    for key in ('Integrator', 'CustomUpdater', 'Integrator/ConstantVolume',
+                'Integrator/computeNetForce',
+                'Integrator/computeNetForce/LJ',
+                'Integrator/computeNetForce/LJ/Cell'):
+        assert key in times
+        assert times[key] >= 0
+    assert times['Integrator'] >= times['Integrator/computeNetForce']
+    assert 'computeNetForce' in sim.operation_times_table
+
+    sim.profile_operations = False
+    assert sim.operation_times == {}
+
+
 def test_timestep(simulation_factory, lattice_snapshot_factory):
     sim = simulation_factory()
     assert sim.timestep is None
@@ -307,6 +341,50 @@ def test_state_from_gsd_frame(simulation_factory, lattice_snapshot_factory,
         assert_equivalent_snapshots(snap, sim.state.get_snapshot())
 
 
+def test_checkpoint(device, simulation_factory, lattice_snapshot_factory,
+                    tmp_path):
+    snap = lattice_snapshot_factory(n=6, particle_types=['A', 'B'])
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+        snap.bonds.N = 2
+        snap.bonds.types = ['b']
+        snap.bonds.group[:] = [[0, 1], [2, 3]]
+    sim = simulation_factory(snap)
+    sim.seed = 7
+    sim.operations.updaters.append(SleepUpdater.wrapped())
+    sim.run(3)
+
+    filename = tmp_path / 'checkpoint'
+    sim.write_checkpoint(filename)
+
+    new_sim = hoomd.Simulation(device)
+    new_sim.create_state_from_checkpoint(filename)
+    assert new_sim.timestep == 3
+    assert new_sim.seed == 7
+    assert new_sim.state.box == sim.state.box
+    assert (new_sim.state.domain_decomposition
+            == sim.state.domain_decomposition)
+    assert_equivalent_snapshots(sim.state.get_snapshot(),
+                                new_sim.state.get_snapshot())
+
+    new_sim.run(1)
+    assert new_sim.timestep == 4
+
+
+def test_checkpoint_missing_operations(device, simulation_factory,
+                                       two_particle_snapshot_factory,
+                                       tmp_path):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    filename = tmp_path / 'checkpoint'
+    sim.write_checkpoint(filename)
+    if sim.device.communicator.rank == 0:
+        (tmp_path / 'checkpoint.operations').unlink()
+
+    new_sim = hoomd.Simulation(device)
+    with pytest.raises(RuntimeError):
+        new_sim.create_state_from_checkpoint(filename)
+
+
 def test_writer_order(simulation_factory, two_particle_snapshot_factory):
     """Ensure that writers run at the end of the loop step."""
 
@@ -505,6 +583,14 @@ def test_logging():
                 'category': LoggerCategories.scalar,
                 'default': True
             },
+            'operation_times': {
+                'category': LoggerCategories.object,
+                'default': False
+            },
+            'operation_times_table': {
+                'category': LoggerCategories.string,
+                'default': False
+            },
             'seed': {
                 'category': LoggerCategories.scalar,
                 'default': True
@@ -17,13 +17,16 @@
 
     logger = hoomd.logging.Logger()
 """
+import base64
 import inspect
+import pickle
 
 import hoomd._hoomd as _hoomd
 from hoomd.logging import log, Loggable
 from hoomd.state import State
 from hoomd.snapshot import Snapshot
 from hoomd.operations import Operations
+from hoomd.data.typeparam import TypeParameter
 import hoomd
 
 TIMESTEP_MAX = 2**64 - 1
@@ -62,6 +65,8 @@ class Simulation(metaclass=Loggable):
         self._operations._simulation = self
         self._timestep = None
         self._seed = None
+        # Operation state read by create_state_from_checkpoint, applied in run
+        self._checkpoint_operations = None
         if seed is not None:
             self.seed = seed
 
@@ -208,6 +213,9 @@ class Simulation(metaclass=Loggable):
         When `timestep` is `None` before calling, `create_state_from_gsd`
         sets `timestep` to the value in the selected GSD frame in the file.
 
+        With MPI, every rank reads a slice of the particles and bonded groups
+        in the file and sends them directly to the ranks that own them.
+
         Note:
             Set any or all of the ``domain_decomposition`` tuple elements to
             `None` and `create_state_from_gsd` will select a value that
@@ -226,14 +234,16 @@ class Simulation(metaclass=Loggable):
         if self._state is not None:
             raise RuntimeError("Cannot initialize more than once\n")
         filename = _hoomd.mpi_bcast_str(filename, self.device._cpp_exec_conf)
+        # With MPI, each rank reads a slice of the file
+        distributed = self.device.communicator.num_ranks > 1
         # Grab snapshot and timestep
         reader = _hoomd.GSDReader(self.device._cpp_exec_conf, filename,
-                                  abs(frame), frame < 0)
+                                  abs(frame), frame < 0, distributed)
         snapshot = Snapshot._from_cpp_snapshot(reader.getSnapshot(),
                                                self.device.communicator)
 
         step = reader.getTimeStep() if self.timestep is None else self.timestep
-        self._state = State(self, snapshot, domain_decomposition)
+        self._state = State(self, snapshot, domain_decomposition, distributed)
 
         reader.clearSnapshot()
 
@@ -311,6 +321,115 @@ class Simulation(metaclass=Loggable):
 
         self._init_system(step)
 
+    def create_state_from_checkpoint(self, filename):
+        """Create the simulation state from a checkpoint.
+
+        Args:
+            filename (str): Base name of the checkpoint files written by
+                `write_checkpoint`.
+
+        `create_state_from_checkpoint` restores the particles, bonded groups,
+        box, domain decomposition, and `seed` exactly as they were when
+        `write_checkpoint` was called. Each MPI rank reads the file of its own
+        domain. The checkpoint must be read with the same number of MPI ranks
+        that wrote it.
+
+        When `timestep` is `None` before calling,
+        `create_state_from_checkpoint` sets `timestep` to the value in the
+        checkpoint.
+
+        Add the same operations to the simulation in the same order before
+        calling `run`. The first call to `run` restores the internal state of
+        the operations (such as the degrees of freedom of
+        `hoomd.md.methods.thermostats.MTTK`) from the checkpoint. Operations
+        are matched by their position in the operation lists, and `run` raises
+        a `RuntimeError` when the operations that have internal state do not
+        match the checkpoint.
+
+        Note:
+            Checkpoints do not save mesh data (`hoomd.mesh.Mesh`) or MPCD
+            particles. Add them to the simulation again after restoring the
+            checkpoint.
+
+        .. rubric:: Example:
+
+        .. invisible-code-block: python
+
+            simulation.write_checkpoint(filename=path / 'checkpoint')
+            simulation = hoomd.Simulation(device=hoomd.device.CPU())
+
+        .. code-block:: python
+
+            simulation.create_state_from_checkpoint(
+                filename=path / 'checkpoint')
+        """
+        if self._state is not None:
+            raise RuntimeError("Cannot initialize more than once\n")
+        filename = _hoomd.mpi_bcast_str(str(filename),
+                                        self.device._cpp_exec_conf)
+
+        # Rank 0 reads the operation state and broadcasts it to all ranks.
+        operations = ""
+        if self.device.communicator.rank == 0:
+            try:
+                with open(filename + '.operations', 'rb') as f:
+                    operations = base64.b64encode(f.read()).decode('ascii')
+            except FileNotFoundError:
+                pass
+        operations = _hoomd.mpi_bcast_str(operations,
+                                          self.device._cpp_exec_conf)
+        if not operations:
+            raise RuntimeError(f"Cannot read the operation state of the "
+                               f"checkpoint from {filename}.operations.")
+
+        reader = _hoomd.CheckpointReader(self.device._cpp_exec_conf, filename)
+
+        step = reader.getTimeStep() if self.timestep is None else self.timestep
+        if self._seed is None:
+            self._seed = reader.getSeed()
+        self._state = State._from_cpp_sys_def(self,
+                                              reader.getSystemDefinition())
+
+        self._init_system(step)
+        self._checkpoint_operations = pickle.loads(
+            base64.b64decode(operations))
+
+    def write_checkpoint(self, filename):
+        """Write a checkpoint of the simulation.
+
+        Args:
+            filename (str): Base name of the checkpoint files.
+
+        `write_checkpoint` saves the simulation in a binary format that
+        `create_state_from_checkpoint` restores exactly. Each MPI rank writes
+        the particles and bonded groups in its domain to the file
+        ``<filename>.<domain>`` without communicating with other ranks. Rank 0
+        also writes the internal state of the operations to
+        ``<filename>.operations``.
+
+        Note:
+            Checkpoints are not portable. Read them with the same version of
+            HOOMD-blue, build configuration, and number of MPI ranks that wrote
+            them. Use `hoomd.write.GSD` to store trajectories.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.write_checkpoint(filename=path / 'checkpoint')
+        """
+        if self._state is None:
+            raise RuntimeError("Cannot write a checkpoint before the state "
+                               "is set.")
+        filename = _hoomd.mpi_bcast_str(str(filename),
+                                        self.device._cpp_exec_conf)
+        _hoomd.write_checkpoint(self._state._cpp_sys_def, self.timestep,
+                                filename)
+
+        if self.device.communicator.rank == 0:
+            with open(filename + '.operations', 'wb') as f:
+                pickle.dump(_save_operation_state(self.operations), f)
+
     @property
     def state(self):
         """hoomd.State: The current simulation state."""
@@ -482,6 +601,82 @@ class Simulation(metaclass=Loggable):
             if value:
                 self._state._cpp_sys_def.getParticleData().setPressureFlag()
 
+    @property
+    def profile_operations(self):
+        """bool: Time each operation in `run` (defaults to ``False``).
+
+        When `True`, `run` measures the wall clock time spent in every tuner,
+        updater, writer, and the integrator. It also measures the sub-stages of
+        the integrator (each force, the neighbor list, each integration method,
+        and the net force summation) and the MPI communication phases. Read the
+        results with `operation_times` and `operation_times_table`.
+
+        Times accumulate over each call to `run` and reset at the beginning of
+        the next call to `run`. Enabling `profile_operations` discards previous
+        measurements.
+
+        Note:
+            On the GPU, profiling synchronizes the device at the beginning and
+            end of every measured region so that kernels are attributed to the
+            operation that launched them. This reduces performance.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.profile_operations = True
+        """
+        return self.device._cpp_exec_conf.getProfiler() is not None
+
+    @profile_operations.setter
+    def profile_operations(self, value):
+        self.device._cpp_exec_conf.setProfiling(bool(value))
+
+    @log(category='object', default=False)
+    def operation_times(self):
+        """dict[str, float]: Seconds spent in each operation in the last `run`.
+
+        The keys name each measured region by the class names of the operations
+        that contain it, separated by ``/`` (for example,
+        ``'Integrator/ConstantVolume'`` or ``'Integrator/computeNetForce/LJ'``).
+        Times are inclusive: the time of a region includes the time of the
+        regions nested within it.
+
+        `operation_times` is empty when `profile_operations` is `False`. Each
+        MPI rank reports its own times.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['operation_times'])
+        """
+        profiler = self.device._cpp_exec_conf.getProfiler()
+        if profiler is None:
+            return {}
+        return dict(profiler.getTimes())
+
+    @log(category='string', default=False)
+    def operation_times_table(self):
+        """str: Table of the time spent in each operation in the last `run`.
+
+        The table lists each measured region indented under its parent with the
+        number of calls, the total time, the time not spent in nested regions,
+        and the percentage of the total measured time.
+
+        `operation_times_table` is empty when `profile_operations` is `False`.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            print(simulation.operation_times_table)
+        """
+        profiler = self.device._cpp_exec_conf.getProfiler()
+        if profiler is None:
+            return ""
+        return profiler.getTable()
+
     def run(self, steps, write_at_start=False):
         """Advance the simulation a number of steps.
 
@@ -551,6 +746,10 @@ class Simulation(metaclass=Loggable):
         if self._state._in_context_manager:
             raise RuntimeError(
                 "Cannot call run inside of a local snapshot context manager.")
+        if self._checkpoint_operations is not None:
+            _restore_operation_state(self.operations,
+                                     self._checkpoint_operations)
+            self._checkpoint_operations = None
         if not self.operations._scheduled:
             self.operations._schedule()
 
@@ -571,3 +770,60 @@ class Simulation(metaclass=Loggable):
 def _match_class_path(obj, *matches):
     return any(cls.__module__ + '.' + cls.__name__ in matches
                for cls in inspect.getmro(type(obj)))
+
+
+def _checkpoint_operations(operations):
+    """Iterate over the operations with a key that identifies each one."""
+    integrator = operations.integrator
+    if integrator is not None:
+        yield 'integrator', integrator
+        for i, method in enumerate(getattr(integrator, 'methods', ())):
+            yield f'integrator.methods.{i}', method
+            thermostat = getattr(method, 'thermostat', None)
+            if thermostat is not None:
+                yield f'integrator.methods.{i}.thermostat', thermostat
+    for name in ('tuners', 'updaters', 'writers', 'computes'):
+        for i, operation in enumerate(getattr(operations, name)):
+            yield f'{name}.{i}', operation
+
+
+def _class_path(obj):
+    return type(obj).__module__ + '.' + type(obj).__name__
+
+
+def _save_operation_state(operations):
+    """Collect the checkpoint attributes of all operations."""
+    saved = {}
+    for key, operation in _checkpoint_operations(operations):
+        attributes = {}
+        for attr in operation._checkpoint_attributes:
+            value = getattr(operation, attr)
+            if isinstance(value, TypeParameter):
+                value = value.to_base()
+            attributes[attr] = value
+        if attributes:
+            saved[key] = (_class_path(operation), attributes)
+    return saved
+
+
+def _restore_operation_state(operations, saved):
+    """Set the checkpoint attributes saved by `_save_operation_state`."""
+    current = {
+        key: operation
+        for key, operation in _checkpoint_operations(operations)
+        if operation._checkpoint_attributes
+    }
+    expected = {key: class_path for key, (class_path, _) in saved.items()}
+    found = {key: _class_path(operation) for key, operation in current.items()}
+    if found != expected:
+        raise RuntimeError(f"The operations {found} do not match the "
+                           f"operations in the checkpoint {expected}.")
+
+    for key, (class_path, attributes) in saved.items():
+        operation = current[key]
+        for attr, value in attributes.items():
+            current_value = getattr(operation, attr)
+            if isinstance(current_value, TypeParameter):
+                current_value.update(value)
+            else:
+                setattr(operation, attr, value)
@@ -248,14 +248,23 @@ class State:
     .. _Kamberaj 2005: http://dx.doi.org/10.1063/1.1906216
     """
 
-    def __init__(self, simulation, snapshot, domain_decomposition):
+    def __init__(self,
+                 simulation,
+                 snapshot,
+                 domain_decomposition,
+                 distributed=False):
         self._simulation = simulation
         snapshot._broadcast_box()
         decomposition = _create_domain_decomposition(
             simulation.device, snapshot._cpp_obj._global_box,
             domain_decomposition)
 
-        if decomposition is not None:
+        if decomposition is not None and distributed:
+            # each rank holds a slice of the snapshot
+            self._cpp_sys_def = _hoomd.SystemDefinition(
+                snapshot._cpp_obj, simulation.device._cpp_exec_conf,
+                decomposition, True)
+        elif decomposition is not None:
             self._cpp_sys_def = _hoomd.SystemDefinition(
                 snapshot._cpp_obj, simulation.device._cpp_exec_conf,
                 decomposition)
@@ -273,6 +282,16 @@ class State:
         # implemented __hash__ and __eq__ from causing cache errors.
         self._groups = defaultdict(dict)
 
+    @classmethod
+    def _from_cpp_sys_def(cls, simulation, cpp_sys_def):
+        """Create the state from an existing C++ system definition."""
+        state = cls.__new__(cls)
+        state._simulation = simulation
+        state._cpp_sys_def = cpp_sys_def
+        state._in_context_manager = False
+        state._groups = defaultdict(dict)
+        return state
+
     def get_snapshot(self):
         """Make a copy of the simulation current state.
 
@@ -0,0 +1,99 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifdef ENABLE_MPI
+
+// this has to be included after naming the test module
+#include "upp11_config.h"
+HOOMD_UP_MAIN();
+
+#include "hoomd/HOOMDMPI.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace hoomd;
+
+//! Check that values from all ranks are gathered in ascending tag order
+UP_TEST(GatherTagOrder_test)
+    {
+    int rank, n_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+
+    // reuse one instance to test the cached buffers
+    GatherTagOrder gather_tag_order(MPI_COMM_WORLD, 0);
+
+    for (unsigned int n_tags : {0u, 1u, 7u, 100u, 1000u})
+        {
+        // distribute the tags over the ranks, leaving holes in the tag sequence
+        vector<unsigned int> local_tags;
+        vector<Scalar3> local_values;
+        vector<unsigned int> expected_tags;
+        for (unsigned int tag = 0; tag < n_tags; tag++)
+            {
+            if (tag % 5 == 2)
+                {
+                continue;
+                }
+
+            expected_tags.push_back(tag);
+            if (int((tag * 7) % n_ranks) == rank)
+                {
+                local_tags.push_back(tag);
+                local_values.push_back(make_scalar3(Scalar(tag), Scalar(2 * tag), -Scalar(tag)));
+                }
+            }
+
+        gather_tag_order.setLocalTagsSorted(local_tags);
+
+        vector<unsigned int> global_tags;
+        vector<Scalar3> global_values;
+        gather_tag_order.gatherArray(global_tags, local_tags);
+        gather_tag_order.gatherArray(global_values, local_values);
+
+        if (rank == 0)
+            {
+            UP_ASSERT_EQUAL(global_tags.size(), expected_tags.size());
+            UP_ASSERT_EQUAL(global_values.size(), expected_tags.size());
+            for (size_t i = 0; i < expected_tags.size(); i++)
+                {
+                UP_ASSERT_EQUAL(global_tags[i], expected_tags[i]);
+                UP_ASSERT_EQUAL(global_values[i].x, Scalar(expected_tags[i]));
+                UP_ASSERT_EQUAL(global_values[i].y, Scalar(2 * expected_tags[i]));
+                UP_ASSERT_EQUAL(global_values[i].z, -Scalar(expected_tags[i]));
+                }
+            }
+        else
+            {
+            UP_ASSERT(global_tags.empty());
+            UP_ASSERT(global_values.empty());
+            }
+
+        // the pieces concatenate to the global array
+        vector<unsigned int> piece_tags;
+        size_t max_piece_size = 0;
+        gather_tag_order.gatherArrayInPieces(local_tags,
+                                             [&](const unsigned int* piece, int n)
+                                             {
+                                                 piece_tags.insert(piece_tags.end(),
+                                                                   piece,
+                                                                   piece + n);
+                                                 max_piece_size
+                                                     = std::max(max_piece_size, size_t(n));
+                                             });
+
+        if (rank == 0)
+            {
+            UP_ASSERT(piece_tags == expected_tags);
+            UP_ASSERT(max_piece_size <= n_tags / n_ranks + 1);
+            }
+        else
+            {
+            UP_ASSERT(piece_tags.empty());
+            }
+        }
+    }
+
+#endif // ENABLE_MPI
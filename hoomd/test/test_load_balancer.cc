@@ -366,6 +366,74 @@ void test_load_balancer_ghost(std::shared_ptr<ExecutionConfiguration> exec_conf,
     UP_ASSERT_EQUAL(pdata->getOwnerRank(7), di(1, 0, 1));
     }
 
+//! Test balancing by the measured force compute time
+void test_load_balancer_time(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // this test needs to be run on eight processors
+    int size;
+    MPI_Comm_size(exec_conf->getHOOMDWorldMPICommunicator(), &size);
+    UP_ASSERT_EQUAL(size, 8);
+
+    // create a system with two particles in each of eight slabs along z
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(16,
+                                                                  BoxDim(2.0),
+                                                                  1,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  exec_conf));
+
+    std::shared_ptr<ParticleData> pdata(sysdef->getParticleData());
+    for (unsigned int i = 0; i < 16; ++i)
+        {
+        Scalar z = Scalar(-1.0) + Scalar(2.0) * (Scalar(i / 2) + Scalar(0.5)) / Scalar(8.0);
+        pdata->setPosition(i, make_scalar3(Scalar(0.5) * Scalar(i % 2), 0, z), false);
+        }
+
+    SnapshotParticleData<Scalar> snap(16);
+    pdata->takeSnapshot(snap);
+
+    // initialize a 1x1x8 domain decomposition
+    std::vector<Scalar> fxs, fys, fzs(7);
+    for (unsigned int k = 0; k < 7; ++k)
+        fzs[k] = Scalar(0.125);
+    std::shared_ptr<DomainDecomposition> decomposition(
+        new DomainDecomposition(exec_conf, pdata->getBox().getL(), fxs, fys, fzs));
+    std::shared_ptr<Communicator> comm(new Communicator(sysdef, decomposition));
+    pdata->setDomainDecomposition(decomposition);
+    sysdef->setCommunicator(comm);
+
+    pdata->initializeFromSnapshot(snap);
+    comm->migrateParticles();
+    UP_ASSERT_EQUAL(pdata->getN(), 2);
+
+    auto trigger = std::make_shared<PeriodicTrigger>(1);
+    std::shared_ptr<LoadBalancer> lb(new LoadBalancer(sysdef, trigger));
+    UP_ASSERT_EQUAL(lb->getWeightPython(), "particles");
+
+    // the particles in the lower half of the box cost three times as much
+    uint3 grid_pos = decomposition->getGridPos();
+    int64_t cost = (grid_pos.z < 4) ? 3000000 : 1000000;
+
+    // the particle numbers are balanced, so the default weight does not adjust the domains
+    sysdef->addForceComputeTime(cost);
+    lb->update(0);
+    MY_CHECK_CLOSE(lb->getTimeImbalance(), 1.5, tol);
+    vector<Scalar> frac_z = decomposition->getCumulativeFractions(2);
+    MY_CHECK_CLOSE(frac_z[4], 0.5, tol);
+    UP_ASSERT_EQUAL(pdata->getN(), 2);
+
+    // weighting by time moves the center cut down toward the expensive particles
+    lb->setWeightPython("time");
+    UP_ASSERT_EQUAL(lb->getWeightPython(), "time");
+    sysdef->addForceComputeTime(cost);
+    lb->update(1);
+    MY_CHECK_CLOSE(lb->getTimeImbalance(), 1.5, tol);
+    frac_z = decomposition->getCumulativeFractions(2);
+    UP_ASSERT(frac_z[4] < 0.5);
+    }
+
 //! Tests basic particle redistribution
 UP_TEST(LoadBalancer_test_basic)
     {
@@ -405,6 +473,14 @@ UP_TEST(LoadBalancer_test_ghost)
     test_load_balancer_ghost<LoadBalancer>(exec_conf, BoxDim(1.0, -.6, .7, .5));
     }
 
+//! Tests balancing by the measured force compute time
+UP_TEST(LoadBalancer_test_time)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    test_load_balancer_time(exec_conf);
+    }
+
 #ifdef ENABLE_HIP
 //! Tests basic particle redistribution on the GPU
 UP_TEST(LoadBalancerGPU_test_basic)
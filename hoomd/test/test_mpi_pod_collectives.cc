@@ -0,0 +1,185 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifdef ENABLE_MPI
+
+// this has to be included after naming the test module
+#include "upp11_config.h"
+HOOMD_UP_MAIN();
+
+#include "hoomd/HOOMDMPI.h"
+
+#include <vector>
+
+using namespace std;
+using namespace hoomd;
+
+//! Make a distinct value for each rank and index
+static Scalar3 make_value(int rank, unsigned int i)
+    {
+    return make_scalar3(Scalar(rank), Scalar(i), Scalar(rank * 1000 + i));
+    }
+
+//! Make the values that a rank sends, with a different (and possibly zero) size on each rank
+static vector<Scalar3> make_values(int rank)
+    {
+    vector<Scalar3> values;
+    unsigned int n = (rank % 3) * (rank + 2);
+    for (unsigned int i = 0; i < n; i++)
+        {
+        values.push_back(make_value(rank, i));
+        }
+    return values;
+    }
+
+//! Check that two vectors hold the same values
+static bool equal(const vector<Scalar3>& a, const vector<Scalar3>& b)
+    {
+    if (a.size() != b.size())
+        {
+        return false;
+        }
+    for (size_t i = 0; i < a.size(); i++)
+        {
+        if (a[i].x != b[i].x || a[i].y != b[i].y || a[i].z != b[i].z)
+            {
+            return false;
+            }
+        }
+    return true;
+    }
+
+//! Check bcast of single values and vectors, including empty vectors
+UP_TEST(bcast_pod_test)
+    {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    Scalar3 value = rank == 0 ? make_value(7, 3) : make_scalar3(0, 0, 0);
+    bcast(value, 0, MPI_COMM_WORLD);
+    UP_ASSERT(equal({value}, {make_value(7, 3)}));
+
+    for (unsigned int n : {0u, 1u, 100u})
+        {
+        vector<Scalar3> expected;
+        for (unsigned int i = 0; i < n; i++)
+            {
+            expected.push_back(make_value(0, i));
+            }
+
+        // non-root ranks start with a vector of the wrong size
+        vector<Scalar3> values = rank == 0 ? expected : make_values(rank + 1);
+        bcast(values, 0, MPI_COMM_WORLD);
+        UP_ASSERT(equal(values, expected));
+        }
+    }
+
+//! Check scatter_v of single values and vectors of different sizes
+UP_TEST(scatter_v_pod_test)
+    {
+    int rank, n_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+
+    vector<Scalar3> in_value;
+    vector<vector<Scalar3>> in_values;
+    if (rank == 0)
+        {
+        for (int i = 0; i < n_ranks; i++)
+            {
+            in_value.push_back(make_value(i, 0));
+            in_values.push_back(make_values(i));
+            }
+        }
+
+    Scalar3 out_value;
+    scatter_v(in_value, out_value, 0, MPI_COMM_WORLD);
+    UP_ASSERT(equal({out_value}, {make_value(rank, 0)}));
+
+    vector<Scalar3> out_values = make_values(rank + 1);
+    scatter_v(in_values, out_values, 0, MPI_COMM_WORLD);
+    UP_ASSERT(equal(out_values, make_values(rank)));
+    }
+
+//! Check gather_v and all_gather_v of single values and vectors of different sizes
+UP_TEST(gather_v_pod_test)
+    {
+    int rank, n_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+
+    vector<Scalar3> out_value;
+    gather_v(make_value(rank, 0), out_value, 0, MPI_COMM_WORLD);
+    if (rank == 0)
+        {
+        UP_ASSERT_EQUAL(out_value.size(), (size_t)n_ranks);
+        for (int i = 0; i < n_ranks; i++)
+            {
+            UP_ASSERT(equal({out_value[i]}, {make_value(i, 0)}));
+            }
+        }
+
+    vector<vector<Scalar3>> out_values;
+    gather_v(make_values(rank), out_values, 0, MPI_COMM_WORLD);
+    if (rank == 0)
+        {
+        UP_ASSERT_EQUAL(out_values.size(), (size_t)n_ranks);
+        for (int i = 0; i < n_ranks; i++)
+            {
+            UP_ASSERT(equal(out_values[i], make_values(i)));
+            }
+        }
+
+    out_value.clear();
+    all_gather_v(make_value(rank, 0), out_value, MPI_COMM_WORLD);
+    UP_ASSERT_EQUAL(out_value.size(), (size_t)n_ranks);
+    for (int i = 0; i < n_ranks; i++)
+        {
+        UP_ASSERT(equal({out_value[i]}, {make_value(i, 0)}));
+        }
+
+    out_values.clear();
+    all_gather_v(make_values(rank), out_values, MPI_COMM_WORLD);
+    UP_ASSERT_EQUAL(out_values.size(), (size_t)n_ranks);
+    for (int i = 0; i < n_ranks; i++)
+        {
+        UP_ASSERT(equal(out_values[i], make_values(i)));
+        }
+    }
+
+//! Check that every rank sends an empty vector without errors
+UP_TEST(empty_pod_test)
+    {
+    int rank, n_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+
+    vector<vector<Scalar3>> in_values;
+    if (rank == 0)
+        {
+        in_values.resize(n_ranks);
+        }
+    vector<Scalar3> out_values = make_values(rank + 1);
+    scatter_v(in_values, out_values, 0, MPI_COMM_WORLD);
+    UP_ASSERT(out_values.empty());
+
+    vector<vector<Scalar3>> gathered;
+    gather_v(vector<Scalar3>(), gathered, 0, MPI_COMM_WORLD);
+    if (rank == 0)
+        {
+        UP_ASSERT_EQUAL(gathered.size(), (size_t)n_ranks);
+        for (const auto& values : gathered)
+            {
+            UP_ASSERT(values.empty());
+            }
+        }
+
+    all_gather_v(vector<Scalar3>(), gathered, MPI_COMM_WORLD);
+    UP_ASSERT_EQUAL(gathered.size(), (size_t)n_ranks);
+    for (const auto& values : gathered)
+        {
+        UP_ASSERT(values.empty());
+        }
+    }
+
+#endif // ENABLE_MPI
@@ -4,6 +4,8 @@
 """Define LoadBalancer."""
 
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyFrom
+from hoomd.logging import log
 from hoomd.operation import Tuner
 from hoomd import _hoomd
 import hoomd
@@ -21,6 +23,8 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        weight (str): Quantity that defines the load of a rank: ``'particles'``
+            or ``'time'``.
 
     `LoadBalancer` adjusts the boundaries of the MPI domains to distribute
     the particle load close to evenly between them. The load imbalance is
@@ -49,6 +53,19 @@ class LoadBalancer(Tuner):
     significantly more pair force neighbors than others, this estimate of the
     load imbalance may not produce the optimal results.
 
+    Set ``weight='time'`` to balance the measured cost instead of the number of
+    particles. In this mode, :math:`N_i` is replaced by the wall clock time
+    that rank :math:`i` spent computing forces (including neighbor lists) since
+    the previous balancing step, and :math:`N / P` by the average of that time
+    over all ranks. Each rank assigns its time uniformly to its particles, so
+    moving a domain boundary moves the cost of the particles that change
+    domains. Use this mode when the cost per particle varies in space, such as
+    in systems with coexisting dense and dilute phases. `LoadBalancer` uses the
+    number of particles on steps where no time has been measured yet.
+
+    Note:
+        ``weight='time'`` is not supported on the GPU.
+
     A load balancing adjustment is only performed when the maximum load
     imbalance exceeds a *tolerance*. The ideal load balance is 1.0, so setting
     *tolerance* less than 1.0 will force an adjustment every update. The load
@@ -83,6 +100,8 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        weight (str): Quantity that defines the load of a rank: ``'particles'``
+            or ``'time'``.
     """
 
     def __init__(self,
@@ -91,19 +110,23 @@ class LoadBalancer(Tuner):
                  y=True,
                  z=True,
                  tolerance=1.02,
-                 max_iterations=1):
+                 max_iterations=1,
+                 weight='particles'):
         super().__init__(trigger)
 
         defaults = dict(x=x,
                         y=y,
                         z=z,
                         tolerance=tolerance,
-                        max_iterations=max_iterations)
+                        max_iterations=max_iterations,
+                        weight=weight)
         load_balancer_params = ParameterDict(x=bool,
                                              y=bool,
                                              z=bool,
                                              max_iterations=int,
-                                             tolerance=float)
+                                             tolerance=float,
+                                             weight=OnlyFrom(
+                                                 ['particles', 'time']))
         self._param_dict.update(load_balancer_params)
         self._param_dict.update(defaults)
 
@@ -115,3 +138,12 @@ class LoadBalancer(Tuner):
 
         self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
                                 self.trigger)
+
+    @log(requires_run=True)
+    def time_imbalance(self):
+        """float: Maximum force compute time of any rank divided by the average.
+
+        Measured over the interval between the last two balancing steps. The
+        value is 1.0 when there is no domain decomposition.
+        """
+        return self._cpp_obj.time_imbalance
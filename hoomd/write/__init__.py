@@ -12,6 +12,8 @@ results to output files or streams:
 * Combine `GSD` with a `hoomd.logging.Logger` to save system properties or
   per-particle calculated results.
 * Use `HDF5Log` to store logged data in HDF5 resizable datasets.
+* Use `LogBuffer` to sample logged data in C++ at high frequency and store it
+  in memory or write it to HDF5 files in batches.
 * Use `Table` to display the status of the simulation periodically to standard
   out.
 * Implement custom output formats with `CustomWriter`.
@@ -34,3 +36,4 @@ from hoomd.write.gsd_burst import Burst
 from hoomd.write.dcd import DCD
 from hoomd.write.table import Table
 from hoomd.write.hdf5 import HDF5Log
+from hoomd.write.log_buffer import LogBuffer
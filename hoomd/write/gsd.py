@@ -16,7 +16,7 @@ from hoomd.util import _dict_flatten
 from hoomd.data.typeconverter import OnlyFrom, RequiredArg
 from hoomd.filter import ParticleFilter, All
 from hoomd.data.parameterdicts import ParameterDict
-from hoomd.logging import Logger, LoggerCategories
+from hoomd.logging import Logger, LoggerCategories, log
 from hoomd.operation import Writer
 import numpy as np
 import json
@@ -71,6 +71,10 @@ class GSD(Writer):
             all frames. Defaults to ``['property']``.
         logger (hoomd.logging.Logger): Provide log quantities to write. Defaults
             to `None`.
+        compression (bool): When `True`, compress the numeric data chunks.
+            Defaults to `False`.
+        quantize_position_bits (int): Number of bits per quantized position
+            coordinate. Defaults to 0, which stores exact positions.
 
     `GSD` writes the simulation trajectory to the specified file in the GSD
     format. `GSD` can store all particle, bond, angle, dihedral, improper,
@@ -150,6 +154,26 @@ class GSD(Writer):
         that your scripts exit cleanly and call `flush()` as needed to write
         buffered frames to the file.
 
+    .. rubric:: Compression
+
+    Set `compression` to `True` to compress the numeric data chunks in each
+    frame. `GSD` groups the bytes of each value by significance and compresses
+    them with a fast LZ77 codec. Set `quantize_position_bits` to also store
+    particle positions as fixed point integers. Quantization is lossy: with the
+    step :math:`s` equal to the coordinate range in the frame divided by
+    :math:`2^\mathrm{bits} - 1`, the absolute error in a coordinate :math:`x`
+    is at most :math:`s/2` plus the single precision rounding of the decoded
+    value, half of the ``float32`` spacing at :math:`x`. `GSD` reports the
+    achieved `compression_ratio` and `write_throughput`.
+
+    `GSD` stores the encoded form of the chunk ``name`` as a ``uint8`` array
+    named ``compressed/name``. `hoomd.Simulation.create_state_from_gsd` decodes
+    these chunks transparently, but other readers, including
+    ``gsd.hoomd.open``, cannot. To make these readers fail instead of silently
+    using default values, a file created with compression has the schema name
+    ``hoomd-compressed`` in place of ``hoomd``. `GSD` cannot append compressed
+    frames to an existing file written without compression.
+
     See Also:
         See the `GSD documentation <https://gsd.readthedocs.io/>`__, `GSD HOOMD
         Schema <https://gsd.readthedocs.io/en/stable/schema-hoomd.html>`__, and
@@ -251,6 +275,40 @@ class GSD(Writer):
             .. code-block:: python
 
                 gsd.maximum_write_buffer_size = 128 * 1024**2
+
+        async_write (bool): When `True`, copy each frame to memory and write
+            it to the file in a background thread while the simulation
+            continues. At most two frames wait to be written: `GSD` blocks the
+            simulation until the background thread catches up. `flush` waits
+            for all pending frames. Errors that occur while writing are raised
+            on a later timestep when `GSD` triggers or when you call `flush`.
+            Defaults to `False`.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.async_write = True
+
+        compression (bool): When `True`, compress the numeric data chunks
+            larger than 256 bytes (see **Compression** above) (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                compression = gsd.compression
+
+        quantize_position_bits (int): When non-zero, store each coordinate of
+            ``particles/position`` as an integer with this many bits (at most
+            32) relative to the range of that coordinate in the frame (see
+            **Compression** above). 0 stores exact positions (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                quantize_position_bits = gsd.quantize_position_bits
     """
 
     def __init__(self,
@@ -260,7 +318,9 @@ class GSD(Writer):
                  mode='ab',
                  truncate=False,
                  dynamic=None,
-                 logger=None):
+                 logger=None,
+                 compression=False,
+                 quantize_position_bits=0):
 
         super().__init__(trigger)
 
@@ -295,6 +355,9 @@ class GSD(Writer):
                           dynamic=[dynamic_validation],
                           write_diameter=False,
                           maximum_write_buffer_size=64 * 1024 * 1024,
+                          async_write=False,
+                          compression=bool(compression),
+                          quantize_position_bits=int(quantize_position_bits),
                           _defaults=dict(filter=filter, dynamic=dynamic)))
 
         self._logger = None if logger is None else _GSDLogWriter(logger)
@@ -303,7 +366,7 @@ class GSD(Writer):
         self._cpp_obj = _hoomd.GSDDumpWriter(
             self._simulation.state._cpp_sys_def, self.trigger, self.filename,
             self._simulation.state._get_group(self.filter), self.mode,
-            self.truncate)
+            self.truncate, self.compression, self.quantize_position_bits)
 
         self._cpp_obj.log_writer = self.logger
 
@@ -331,7 +394,7 @@ class GSD(Writer):
 
         writer = _hoomd.GSDDumpWriter(state._cpp_sys_def, Periodic(1),
                                       str(filename), state._get_group(filter),
-                                      mode, False)
+                                      mode, False, False, 0)
 
         if logger is not None:
             writer.log_writer = _GSDLogWriter(logger)
@@ -358,6 +421,27 @@ class GSD(Writer):
         self._logger = logger
         return self.logger
 
+    @log(requires_run=True)
+    def compression_ratio(self):
+        """float: Total size of the data chunks written divided by the \
+        number of bytes used to store them.
+
+        Equal to 1 when `compression` is `False` and
+        `quantize_position_bits` is 0.
+        """
+        return self._cpp_obj.compression_ratio
+
+    @log(requires_run=True)
+    def write_throughput(self):
+        """float: Total size of the data chunks written divided by the \
+        time spent compressing and writing them :math:`[\\mathrm{bytes}
+        / \\mathrm{s}]`.
+
+        The time includes encoding the chunks and copying them to the write
+        buffer, plus the file writes when the buffer fills.
+        """
+        return self._cpp_obj.write_throughput
+
     def flush(self):
         """Flush the write buffer to the file.
 
@@ -98,6 +98,8 @@ class Burst(GSD):
                          dynamic=dynamic,
                          logger=logger)
         self._param_dict.pop("truncate")
+        self._param_dict.pop("compression")
+        self._param_dict.pop("quantize_position_bits")
         self._param_dict.update(
             ParameterDict(max_burst_size=int, write_at_start=bool))
         self._param_dict.update({
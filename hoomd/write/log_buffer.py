@@ -0,0 +1,341 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Implement LogBuffer.
+
+.. invisible-code-block: python
+
+    simulation = hoomd.util.make_example_simulation()
+    logger = hoomd.logging.Logger(hoomd.write.LogBuffer.accepted_categories)
+"""
+
+from pathlib import PurePath
+import weakref
+
+import numpy as np
+
+import hoomd
+from hoomd import _hoomd
+import hoomd.data.typeconverter as typeconverter
+import hoomd.logging as logging
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.operation import Writer
+
+try:
+    import h5py
+except ImportError:
+    h5py = None
+
+
+def _flush_callback(log_buffer):
+    """Make a flush callback that does not keep the writer alive."""
+    ref = weakref.ref(log_buffer)
+
+    def callback():
+        log_buffer = ref()
+        if log_buffer is not None:
+            log_buffer._write_file()
+
+    return callback
+
+
+class LogBuffer(Writer):
+    """Sample loggable quantities in C++ into in-memory ring buffers.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to sample
+            the logged quantities.
+        logger (hoomd.logging.Logger): The quantities to sample.
+        capacity (int): Number of samples to keep in memory. Defaults to 1024.
+        filename (str): HDF5 file to append the samples to. Defaults to
+            `None`, which keeps the samples in memory only.
+
+    `LogBuffer` samples the logged quantities without calling into Python. The
+    operations that provide a quantity register a C++ getter for it and
+    `LogBuffer` evaluates the getters directly into typed ring buffers that
+    hold the last *capacity* samples. The per-step cost of logging is
+    independent of the Python interpreter, which makes `LogBuffer` suitable
+    for logging many quantities frequently on small, fast systems.
+
+    Access copies of the most recent samples with `timesteps` and `data`. When
+    *filename* is set, `LogBuffer` appends the samples to the HDF5 file in
+    batches of *capacity* samples, before it would overwrite samples that
+    have not been written. The file uses the same layout as
+    `hoomd.write.HDF5Log`. Call `flush` to write the remaining samples.
+
+    Only quantities that have a native getter can be sampled. These include
+    `hoomd.md.force.Force.energy`, the scalar and sequence quantities of
+    `hoomd.md.compute.ThermodynamicQuantities`, and
+    `hoomd.hpmc.integrate.HPMCIntegrator.translate_moves`,
+    `hoomd.hpmc.integrate.HPMCIntegrator.rotate_moves`, and
+    `hoomd.hpmc.integrate.HPMCIntegrator.mps`. The logger may also include
+    `hoomd.Simulation.timestep`. `LogBuffer` raises a `ValueError` when it
+    attaches if the logger contains any other quantity.
+
+    Note:
+        Add the operations that provide the logged quantities to the
+        simulation before `LogBuffer` attaches.
+
+    Note:
+        Writing to *filename* requires ``h5py``.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        log_buffer = hoomd.write.LogBuffer(
+            trigger=hoomd.trigger.Periodic(100),
+            logger=logger,
+            capacity=10_000)
+        simulation.operations.writers.append(log_buffer)
+
+    Attributes:
+        accepted_categories (hoomd.logging.LoggerCategories): The enum value
+            for all accepted categories for `LogBuffer` instances which is
+            "scalar" and "sequence".
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                accepted_categories = hoomd.write.LogBuffer.accepted_categories
+
+        logger (hoomd.logging.Logger): The quantities to sample (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                logger = log_buffer.logger
+
+        capacity (int): Number of samples to keep in memory (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                capacity = log_buffer.capacity
+
+        filename (str): HDF5 file to append the samples to (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                filename = log_buffer.filename
+    """
+
+    accepted_categories = logging.LoggerCategories.any(
+        (logging.LoggerCategories.scalar, logging.LoggerCategories.sequence))
+
+    _read_only = ("logger", "capacity", "filename")
+
+    _SCALAR_CHUNK = 512
+    _MULTIFRAME_ARRAY_CHUNK_MAXIMUM = 4096
+
+    def __init__(self, trigger, logger, capacity=1024, filename=None):
+        super().__init__(trigger)
+
+        if (rejects := ~self.accepted_categories
+                & logger.categories) != logging.LoggerCategories["NONE"]:
+            reject_str = logging.LoggerCategories._get_string_list(rejects)
+            raise ValueError(f"Cannot have {reject_str} in logger categories.")
+        if filename is not None and h5py is None:
+            raise ImportError(f"{type(self)} requires the h5py package to "
+                              "write files.")
+
+        param_dict = ParameterDict(logger=logging.Logger,
+                                   capacity=int,
+                                   filename=typeconverter.OnlyTypes(
+                                       (str, PurePath), allow_none=True))
+        param_dict.update(
+            dict(logger=logger, capacity=capacity, filename=filename))
+        self._param_dict.update(param_dict)
+
+    def _setattr_param(self, attr, value):
+        if attr in self._read_only:
+            raise ValueError(f"Attribute {attr} is read-only.")
+        super()._setattr_param(attr, value)
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.LogBuffer(self._simulation.state._cpp_sys_def,
+                                         self.trigger, self.capacity)
+
+        # (namespace, category, index of the C++ column or None for the
+        # timestep)
+        self._columns = []
+        index = 0
+        for key, entry in self.logger.items():
+            obj = entry.obj
+            if isinstance(obj, hoomd.Simulation) and entry.attr == "timestep":
+                self._columns.append((key, entry.category, None))
+                continue
+
+            cpp_obj = getattr(obj, "_cpp_obj", None)
+            if (cpp_obj is None or not hasattr(cpp_obj, "getLoggableNames")
+                    or entry.attr not in cpp_obj.getLoggableNames()):
+                raise ValueError(
+                    f"{'/'.join(key)} cannot be sampled by LogBuffer. Only "
+                    "quantities with native getters of attached operations "
+                    "can be sampled.")
+            self._cpp_obj.addQuantity(cpp_obj, entry.attr)
+            self._columns.append((key, entry.category, index))
+            index += 1
+
+        if self.filename is not None:
+            self._cpp_obj.setFlushCallback(_flush_callback(self))
+
+    def _detach_hook(self):
+        if self.filename is not None:
+            self._write_file()
+
+    @property
+    def timesteps(self):
+        """(*N*, ) `numpy.ndarray` of ``numpy.uint64``: Timesteps of the \
+        stored samples in chronological order.
+
+        The array is a copy of the buffer and is not modified by later
+        samples.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.run(1_000)
+            timesteps = log_buffer.timesteps
+        """
+        if not self._attached:
+            raise hoomd.error.DataAccessError("timesteps")
+        return np.array(self._cpp_obj.timesteps)
+
+    @property
+    def data(self):
+        """dict: Stored samples of the logged quantities in chronological \
+        order.
+
+        The nested dictionary has the same structure as
+        `hoomd.logging.Logger.log`. Each value is a `numpy.ndarray` that holds
+        a copy of the buffer and is not modified by later samples. Scalar
+        quantities have the shape (*N*, ) and sequence quantities have the
+        shape (*N*, *width*).
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            data = log_buffer.data
+        """
+        if not self._attached:
+            raise hoomd.error.DataAccessError("data")
+        data = hoomd.util._SafeNamespaceDict()
+        for key, values in self._iter_columns():
+            data[key] = np.array(values)
+        return data._dict
+
+    def flush(self):
+        """Write the samples that have not been written to the file.
+
+        Does nothing when `filename` is `None`.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            log_buffer.flush()
+        """
+        if self._attached and self.filename is not None:
+            self._write_file()
+
+    def _iter_columns(self):
+        """Yield the namespace and stored samples of every quantity.
+
+        The yielded arrays reference the buffer and are valid until the next
+        sample.
+        """
+        for key, category, index in self._columns:
+            if index is None:
+                yield key, self._readonly(self._cpp_obj.timesteps)
+                continue
+            values = self._readonly(self._cpp_obj.getData(index))
+            if category == logging.LoggerCategories.scalar:
+                values = values[:, 0]
+            yield key, values
+
+    @staticmethod
+    def _readonly(array):
+        array.flags.writeable = False
+        return array
+
+    def _write_file(self):
+        """Append the unflushed samples to the HDF5 file.
+
+        Only the root rank writes. It broadcasts any error so that all ranks
+        raise instead of waiting for each other.
+        """
+        n_unflushed = self._cpp_obj.num_unflushed
+        if n_unflushed == 0:
+            return
+
+        device = self._simulation.device
+        error = None
+        if device.communicator.rank == 0:
+            try:
+                self._append_to_file(n_unflushed)
+            except Exception as exception:
+                error = exception
+
+        message = "" if error is None else f"{type(error).__name__}: {error}"
+        message = _hoomd.mpi_bcast_str(message, device._cpp_exec_conf)
+        if error is not None:
+            raise error
+        if message:
+            raise RuntimeError(message)
+        self._cpp_obj.markFlushed()
+
+    def _append_to_file(self, n_unflushed):
+        """Append the last *n_unflushed* samples to the HDF5 file."""
+        with h5py.File(self.filename, mode="a") as fh:
+            group = self._require_group(fh)
+            frame = group.attrs["frames"]
+            for key, values in self._iter_columns():
+                name = "/".join(key)
+                if name not in group and frame == 0:
+                    self._create_dataset(group, name, values)
+                dataset = group.get(name)
+                if dataset is None or dataset.shape[1:] != values.shape[1:]:
+                    raise RuntimeError(
+                        "The logged quantities cannot change within a file.")
+                dataset.resize(frame + n_unflushed, axis=0)
+                dataset[frame:] = values[-n_unflushed:]
+            group.attrs["frames"] = frame + n_unflushed
+
+    @staticmethod
+    def _require_group(fh):
+        """Get the hoomd-data group, validating the schema like HDF5Log."""
+        if "hoomd-data" in fh:
+            group = fh["hoomd-data"]
+            if "hoomd-schema" not in group.attrs:
+                raise RuntimeError("Validation of existing HDF5 file failed.")
+            return group
+        group = fh.create_group("hoomd-data")
+        group.attrs["hoomd-schema"] = [0, 1]
+        group.attrs["frames"] = 0
+        return group
+
+    def _create_dataset(self, group, name, values):
+        """Create a resizable dataset with the chunking used by HDF5Log."""
+        shape = (0,) + values.shape[1:]
+        if len(shape) == 1:
+            chunks = (self._SCALAR_CHUNK,)
+        else:
+            row_bytes = values.dtype.itemsize * int(np.prod(shape[1:]))
+            chunks = (max(self._MULTIFRAME_ARRAY_CHUNK_MAXIMUM // row_bytes,
+                          1),) + shape[1:]
+        group.create_dataset(name,
+                             shape,
+                             dtype=values.dtype,
+                             chunks=chunks,
+                             maxshape=(None,) + shape[1:])
+
+
+__all__ = ["LogBuffer"]
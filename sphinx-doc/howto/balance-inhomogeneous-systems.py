@@ -0,0 +1,70 @@
+import hoomd
+import argparse
+import itertools
+import numpy
+
+kT = 1.2
+
+# Parse command line arguments.
+parser = argparse.ArgumentParser()
+parser.add_argument('--weights',
+                    default=['particles', 'time'],
+                    type=str,
+                    nargs='+')
+parser.add_argument('--n', default=32, type=int)
+parser.add_argument('--steps', default=2_000, type=int)
+args = parser.parse_args()
+
+device = hoomd.device.CPU()
+
+# Place n**3 particles on a lattice with a dense slab (density 0.9) and a
+# dilute vapor (density 0.1) that each hold half of the particles.
+n_slab = args.n // 2
+L = args.n * 0.9**(-1 / 3)
+dense_spacing = L / args.n
+Lz = n_slab * dense_spacing + n_slab * 9 * dense_spacing
+x = numpy.linspace(-L / 2, L / 2, args.n, endpoint=False)
+z_dense = -Lz / 2 + dense_spacing * numpy.arange(n_slab)
+z_dilute = -Lz / 2 + n_slab * dense_spacing + 9 * dense_spacing * numpy.arange(
+    n_slab)
+z = numpy.concatenate((z_dense, z_dilute))
+
+snapshot = hoomd.Snapshot(device.communicator)
+if snapshot.communicator.rank == 0:
+    snapshot.particles.N = args.n**3
+    snapshot.particles.position[:] = list(itertools.product(x, x, z))
+    snapshot.particles.types = ['A']
+    snapshot.configuration.box = [L, L, Lz, 0, 0, 0]
+
+for weight in args.weights:
+    # Create LJ MD simulation, decomposed along the inhomogeneous direction.
+    simulation = hoomd.Simulation(device=device, seed=1)
+    simulation.create_state_from_snapshot(
+        snapshot, domain_decomposition=(1, 1, device.communicator.num_ranks))
+    simulation.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                                 kT=kT)
+
+    cell = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=cell)
+    lj.params[('A', 'A')] = dict(sigma=1, epsilon=1)
+    lj.r_cut[('A', 'A')] = 2.5
+
+    constant_volume = hoomd.md.methods.ConstantVolume(
+        filter=hoomd.filter.All(),
+        thermostat=hoomd.md.methods.thermostats.Bussi(kT=kT))
+
+    simulation.operations.integrator = hoomd.md.Integrator(
+        dt=0.001, methods=[constant_volume], forces=[lj])
+
+    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(100),
+                                      weight=weight)
+    simulation.operations.tuners.append(balance)
+
+    # Balance the domains and warm up memory caches.
+    simulation.run(args.steps)
+
+    # Run the benchmark and print the performance.
+    simulation.run(args.steps)
+    device.notice(f'weight={weight} '
+                  f'time_imbalance: {balance.time_imbalance:0.3g} '
+                  f'TPS: {simulation.tps:0.5g}')
@@ -0,0 +1,91 @@
+import hoomd
+import argparse
+import numpy
+
+kT = 1.2
+
+# Parse command line arguments.
+parser = argparse.ArgumentParser()
+parser.add_argument('--threads', default=[1, 2, 4, 8], type=int, nargs='+')
+parser.add_argument('--chains', default=1_000, type=int)
+parser.add_argument('--chain-length', default=32, type=int)
+parser.add_argument('--steps', default=1_000, type=int)
+args = parser.parse_args()
+
+device = hoomd.device.CPU()
+
+# Place straight chains on a square grid at a monomer density of about 0.5.
+bond_length = 0.97
+spacing = 2.0
+chain_extent = args.chain_length * bond_length
+chains_per_layer = max(1, int(numpy.sqrt(args.chains * spacing**2 * 2.0
+                                          / chain_extent)))
+n_layers = int(numpy.ceil(args.chains / chains_per_layer**2))
+L_xy = chains_per_layer * spacing
+L_z = n_layers * (chain_extent + spacing)
+
+snapshot = hoomd.Snapshot(device.communicator)
+if snapshot.communicator.rank == 0:
+    N = args.chains * args.chain_length
+    snapshot.configuration.box = [L_xy, L_xy, L_z, 0, 0, 0]
+    snapshot.particles.N = N
+    snapshot.particles.types = ['A']
+
+    chain = numpy.arange(args.chains)
+    x = (chain % chains_per_layer + 0.5) * spacing - L_xy / 2
+    y = ((chain // chains_per_layer) % chains_per_layer + 0.5) * spacing
+    y -= L_xy / 2
+    z = (chain // chains_per_layer**2) * (chain_extent + spacing) - L_z / 2
+    monomer = numpy.arange(args.chain_length)
+    position = numpy.zeros((args.chains, args.chain_length, 3))
+    position[:, :, 0] = x[:, numpy.newaxis]
+    position[:, :, 1] = y[:, numpy.newaxis]
+    position[:, :, 2] = z[:, numpy.newaxis] + monomer * bond_length
+    snapshot.particles.position[:] = position.reshape((N, 3))
+
+    # Bond, angle, and dihedral groups along each chain.
+    first = chain[:, numpy.newaxis] * args.chain_length
+    for group_data, size, type_name in ((snapshot.bonds, 2, 'A-A'),
+                                        (snapshot.angles, 3, 'A-A-A'),
+                                        (snapshot.dihedrals, 4, 'A-A-A-A')):
+        start = (first + numpy.arange(args.chain_length - size + 1)).flatten()
+        group_data.N = len(start)
+        group_data.types = [type_name]
+        group_data.group[:] = start[:, numpy.newaxis] + numpy.arange(size)
+
+for num_cpu_threads in args.threads:
+    device.num_cpu_threads = num_cpu_threads
+
+    # Create a bead-spring polymer melt simulation.
+    simulation = hoomd.Simulation(device=device, seed=1)
+    simulation.create_state_from_snapshot(snapshot)
+    simulation.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                                 kT=kT)
+
+    cell = hoomd.md.nlist.Cell(buffer=0.4, exclusions=['bond', '1-3', '1-4'])
+    lj = hoomd.md.pair.LJ(nlist=cell, mode='shift')
+    lj.params[('A', 'A')] = dict(sigma=1, epsilon=1)
+    lj.r_cut[('A', 'A')] = 2**(1 / 6)
+
+    harmonic = hoomd.md.bond.Harmonic()
+    harmonic.params['A-A'] = dict(k=400.0, r0=bond_length)
+    angle = hoomd.md.angle.Harmonic()
+    angle.params['A-A-A'] = dict(k=5.0, t0=numpy.pi)
+    dihedral = hoomd.md.dihedral.OPLS()
+    dihedral.params['A-A-A-A'] = dict(k1=1.0, k2=-0.5, k3=0.5, k4=0.0)
+
+    constant_volume = hoomd.md.methods.ConstantVolume(
+        filter=hoomd.filter.All(),
+        thermostat=hoomd.md.methods.thermostats.Bussi(kT=kT))
+
+    simulation.operations.integrator = hoomd.md.Integrator(
+        dt=0.002,
+        methods=[constant_volume],
+        forces=[lj, harmonic, angle, dihedral])
+
+    # Warm up memory caches and pre-computed quantities.
+    simulation.run(args.steps)
+
+    # Run the benchmark and print the performance.
+    simulation.run(args.steps)
+    device.notice(f'threads={num_cpu_threads} TPS: {simulation.tps:0.5g}')
@@ -0,0 +1,60 @@
+import hoomd
+import argparse
+import itertools
+import numpy
+
+kT = 1.2
+
+# Parse command line arguments.
+parser = argparse.ArgumentParser()
+parser.add_argument('--threads', default=[1, 2, 4, 8], type=int, nargs='+')
+parser.add_argument('--densities',
+                    default=[0.4, 0.6, 0.8],
+                    type=float,
+                    nargs='+')
+parser.add_argument('--n', default=32, type=int)
+parser.add_argument('--steps', default=1_000, type=int)
+args = parser.parse_args()
+
+device = hoomd.device.CPU()
+
+for density in args.densities:
+    # Place n**3 particles on a simple cubic lattice at the given density.
+    spacing = density**(-1 / 3)
+    L = args.n * spacing
+    x = numpy.linspace(-L / 2, L / 2, args.n, endpoint=False)
+    snapshot = hoomd.Snapshot(device.communicator)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.N = args.n**3
+        snapshot.particles.position[:] = list(itertools.product(x, repeat=3))
+        snapshot.particles.types = ['A']
+        snapshot.configuration.box = [L, L, L, 0, 0, 0]
+
+    for num_cpu_threads in args.threads:
+        device.num_cpu_threads = num_cpu_threads
+
+        # Create LJ MD simulation.
+        simulation = hoomd.Simulation(device=device, seed=1)
+        simulation.create_state_from_snapshot(snapshot)
+        simulation.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                                     kT=kT)
+
+        cell = hoomd.md.nlist.Cell(buffer=0.4)
+        lj = hoomd.md.pair.LJ(nlist=cell)
+        lj.params[('A', 'A')] = dict(sigma=1, epsilon=1)
+        lj.r_cut[('A', 'A')] = 2.5
+
+        constant_volume = hoomd.md.methods.ConstantVolume(
+            filter=hoomd.filter.All(),
+            thermostat=hoomd.md.methods.thermostats.Bussi(kT=kT))
+
+        simulation.operations.integrator = hoomd.md.Integrator(
+            dt=0.001, methods=[constant_volume], forces=[lj])
+
+        # Warm up memory caches and pre-computed quantities.
+        simulation.run(args.steps)
+
+        # Run the benchmark and print the performance.
+        simulation.run(args.steps)
+        device.notice(f'density={density} threads={num_cpu_threads} '
+                      f'TPS: {simulation.tps:0.5g}')